@@ -0,0 +1,86 @@
+--  Benchmark: call cost of each parameter-passing style per record size
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time;     use Ada.Real_Time;
+with Ada.Text_IO;       use Ada.Text_IO;
+with Passing_Styles;
+with Passing_Instances; use Passing_Instances;
+
+procedure Bench is
+
+   Checksum : Long_Long_Integer := 0;
+
+   procedure Report (Label : String; Style : String;
+                     Elapsed : Time_Span; Calls : Positive) is
+      Ns : constant Long_Float :=
+         Long_Float (To_Duration (Elapsed)) * 1.0E9 / Long_Float (Calls);
+   begin
+      Put_Line (Label & " " & Style & ":" & Long_Float'Image (Ns) &
+                " ns/call");
+   end Report;
+
+   generic
+      with package Styles is new Passing_Styles (<>);
+      Label : String;
+   procedure Run;
+
+   procedure Run is
+      use Styles;
+
+      --  Fewer calls for bigger records keeps each row around a second
+      Calls : constant Positive := Positive'Max (200_000, 100_000_000 / Words);
+      Item  : Record_Type := Fill_Return (0);
+      Sink  : Integer := 0;
+      Start : Time;
+   begin
+      Start := Clock;
+      for I in 1 .. Calls loop
+         Fill_Out (I, Item);
+      end loop;
+      Report (Label, "out parameter  ", Clock - Start, Calls);
+      Sink := Integer'Max (Sink, Item.Data (Words));
+
+      Start := Clock;
+      for I in 1 .. Calls loop
+         Item := Fill_Return (I);
+      end loop;
+      Report (Label, "function return", Clock - Start, Calls);
+      Sink := Integer'Max (Sink, Item.Data (Words));
+
+      Start := Clock;
+      for I in 1 .. Calls loop
+         Touch_In_Out (Item, I);
+      end loop;
+      Report (Label, "in out update  ", Clock - Start, Calls);
+      Sink := Integer'Max (Sink, Item.Data (Words));
+
+      Start := Clock;
+      for I in 1 .. Calls loop
+         Item := Touched (Item, I);
+      end loop;
+      Report (Label, "return update  ", Clock - Start, Calls);
+      Sink := Integer'Max (Sink, Item.Data (Words));
+
+      Start := Clock;
+      for I in 1 .. Calls loop
+         Sink := Integer'Max (Sink, Max_Ends (Item));
+      end loop;
+      Report (Label, "in read        ", Clock - Start, Calls);
+
+      Checksum := Checksum + Long_Long_Integer (Sink);
+   end Run;
+
+   procedure Run_8    is new Run (Size_8,    "   8 B");
+   procedure Run_64   is new Run (Size_64,   "  64 B");
+   procedure Run_512  is new Run (Size_512,  " 512 B");
+   procedure Run_4096 is new Run (Size_4096, "4096 B");
+
+begin
+   Run_8;
+   Run_64;
+   Run_512;
+   Run_4096;
+   Put_Line ("checksum:" & Long_Long_Integer'Image (Checksum));
+end Bench;
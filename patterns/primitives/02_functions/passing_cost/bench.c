@@ -0,0 +1,62 @@
+/*
+ * Benchmark: call cost of each parameter-passing style per struct size
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "passing_styles.h"
+
+static long long checksum = 0;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void report(const char *label, const char *style, double start, int calls) {
+    printf("%s %s: %.3f ns/call\n", label, style, (now_ns() - start) / calls);
+}
+
+// Fewer calls for bigger structs keeps each row around a second
+#define RUN(BYTES, LABEL)                                                   \
+    do {                                                                    \
+        int calls = 100000000 / WORDS_##BYTES;                              \
+        if (calls < 200000) calls = 200000;                                 \
+        rec_##BYTES item = fill_return_##BYTES(0);                          \
+        int sink = 0;                                                       \
+        double start = now_ns();                                            \
+        for (int i = 1; i <= calls; i++) fill_out_##BYTES(i, &item);        \
+        report(LABEL, "output pointer ", start, calls);                     \
+        start = now_ns();                                                   \
+        for (int i = 1; i <= calls; i++) item = fill_return_##BYTES(i);     \
+        report(LABEL, "struct return  ", start, calls);                     \
+        start = now_ns();                                                   \
+        for (int i = 1; i <= calls; i++) touch_ptr_##BYTES(&item, i);       \
+        report(LABEL, "pointer update ", start, calls);                     \
+        start = now_ns();                                                   \
+        for (int i = 1; i <= calls; i++) item = touched_##BYTES(item, i);   \
+        report(LABEL, "by-value update", start, calls);                     \
+        start = now_ns();                                                   \
+        for (int i = 1; i <= calls; i++) {                                  \
+            int m = max_ends_ptr_##BYTES(&item);                            \
+            sink = m > sink ? m : sink;                                     \
+        }                                                                   \
+        report(LABEL, "const ptr read ", start, calls);                     \
+        start = now_ns();                                                   \
+        for (int i = 1; i <= calls; i++) {                                  \
+            int m = max_ends_value_##BYTES(item);                           \
+            sink = m > sink ? m : sink;                                     \
+        }                                                                   \
+        report(LABEL, "by-value read  ", start, calls);                     \
+        checksum += sink;                                                   \
+    } while (0)
+
+int main(void) {
+    RUN(8,    "   8 B");
+    RUN(64,   "  64 B");
+    RUN(512,  " 512 B");
+    RUN(4096, "4096 B");
+    printf("checksum: %lld\n", checksum);
+    return 0;
+}
@@ -0,0 +1,33 @@
+--  Parameter-passing styles for records
+--  Same operations as out parameters, record returns and in out updates
+
+with Ada.Text_IO;       use Ada.Text_IO;
+with Passing_Instances; use Passing_Instances;
+
+procedure Example is
+
+   --  Two Integers: the size of Point and Div_Result
+   use Size_8;
+
+   A, B : Record_Type;
+
+begin
+   --  Producing a record: out parameter vs function return
+   Fill_Out (17, A);
+   B := Fill_Return (5);
+   Put_Line ("Fill_Out:    " & Integer'Image (A.Data (1)) &
+             Integer'Image (A.Data (2)));
+   Put_Line ("Fill_Return: " & Integer'Image (B.Data (1)) &
+             Integer'Image (B.Data (2)));
+
+   --  Updating: in out vs functional update
+   Touch_In_Out (A, 3);
+   B := Touched (B, 4);
+   Put_Line ("Touch_In_Out:" & Integer'Image (A.Data (1)) &
+             Integer'Image (A.Data (2)));
+   Put_Line ("Touched:     " & Integer'Image (B.Data (1)) &
+             Integer'Image (B.Data (2)));
+
+   --  Reading: in mode
+   Put_Line ("Max_Ends:    " & Integer'Image (Max_Ends (A)));
+end Example;
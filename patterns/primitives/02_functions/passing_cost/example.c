@@ -0,0 +1,30 @@
+/*
+ * Parameter-passing styles for structs
+ * Output pointers, struct returns, pointer updates and by-value copies
+ */
+
+#include <stdio.h>
+#include "passing_styles.h"
+
+int main(void) {
+    // Two ints: the size of Point and the div_mod results
+    rec_8 a, b;
+
+    // Producing a struct: output pointer vs return by value
+    fill_out_8(17, &a);
+    b = fill_return_8(5);
+    printf("fill_out:       %d %d\n", a.data[0], a.data[1]);
+    printf("fill_return:    %d %d\n", b.data[0], b.data[1]);
+
+    // Updating: through a pointer vs by value
+    touch_ptr_8(&a, 3);
+    b = touched_8(b, 4);
+    printf("touch_ptr:      %d %d\n", a.data[0], a.data[1]);
+    printf("touched:        %d %d\n", b.data[0], b.data[1]);
+
+    // Reading: const pointer vs by value
+    printf("max_ends_ptr:   %d\n", max_ends_ptr_8(&a));
+    printf("max_ends_value: %d\n", max_ends_value_8(a));
+
+    return 0;
+}
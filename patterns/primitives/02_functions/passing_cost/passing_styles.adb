@@ -0,0 +1,33 @@
+package body Passing_Styles is
+
+   procedure Fill_Out (Seed : Integer; Result : out Record_Type) is
+   begin
+      Result := (Data => (others => Seed));
+   end Fill_Out;
+
+   function Fill_Return (Seed : Integer) return Record_Type is
+   begin
+      return (Data => (others => Seed));
+   end Fill_Return;
+
+   procedure Touch_In_Out (Item : in out Record_Type; Value : Integer) is
+   begin
+      Item.Data (1)     := Value;
+      Item.Data (Words) := Value;
+   end Touch_In_Out;
+
+   function Touched (Item : Record_Type; Value : Integer) return Record_Type
+   is
+      Result : Record_Type := Item;
+   begin
+      Result.Data (1)     := Value;
+      Result.Data (Words) := Value;
+      return Result;
+   end Touched;
+
+   function Max_Ends (Item : Record_Type) return Integer is
+   begin
+      return Integer'Max (Item.Data (1), Item.Data (Words));
+   end Max_Ends;
+
+end Passing_Styles;
@@ -0,0 +1,67 @@
+/*
+ * Parameter-passing styles for a struct of a given size
+ * Each function does almost no work, so a call measures the passing cost
+ */
+
+#ifndef PASSING_STYLES_H
+#define PASSING_STYLES_H
+
+// Keep every call a real call: no inlining, no cloning, no
+// interprocedural constant propagation across the benchmark
+#define NOIPA __attribute__((noipa))
+
+#define DEFINE_PASSING_STYLES(BYTES)                                        \
+    typedef struct {                                                        \
+        int data[(BYTES) / sizeof(int)];                                    \
+    } rec_##BYTES;                                                          \
+                                                                            \
+    enum { WORDS_##BYTES = (BYTES) / sizeof(int) };                         \
+                                                                            \
+    /* Producing a whole struct: output pointer (div_mod style) */          \
+    NOIPA void fill_out_##BYTES(int seed, rec_##BYTES *result) {            \
+        for (int i = 0; i < WORDS_##BYTES; i++) {                           \
+            result->data[i] = seed;                                         \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    /* Producing a whole struct: return by value */                         \
+    NOIPA rec_##BYTES fill_return_##BYTES(int seed) {                       \
+        rec_##BYTES result;                                                 \
+        for (int i = 0; i < WORDS_##BYTES; i++) {                           \
+            result.data[i] = seed;                                          \
+        }                                                                   \
+        return result;                                                      \
+    }                                                                       \
+                                                                            \
+    /* Updating two words through a pointer */                              \
+    NOIPA void touch_ptr_##BYTES(rec_##BYTES *item, int value) {            \
+        item->data[0] = value;                                              \
+        item->data[WORDS_##BYTES - 1] = value;                              \
+    }                                                                       \
+                                                                            \
+    /* Updating two words by value: item = touched(item, value) */          \
+    NOIPA rec_##BYTES touched_##BYTES(rec_##BYTES item, int value) {        \
+        item.data[0] = value;                                               \
+        item.data[WORDS_##BYTES - 1] = value;                               \
+        return item;                                                        \
+    }                                                                       \
+                                                                            \
+    /* Reading through a const pointer */                                   \
+    NOIPA int max_ends_ptr_##BYTES(const rec_##BYTES *item) {               \
+        int a = item->data[0], b = item->data[WORDS_##BYTES - 1];           \
+        return a > b ? a : b;                                               \
+    }                                                                       \
+                                                                            \
+    /* Reading a struct passed by value */                                  \
+    NOIPA int max_ends_value_##BYTES(rec_##BYTES item) {                    \
+        int a = item.data[0], b = item.data[WORDS_##BYTES - 1];             \
+        return a > b ? a : b;                                               \
+    }
+
+// Sizes from a Point / div_mod result (two ints) up to 4 KB
+DEFINE_PASSING_STYLES(8)
+DEFINE_PASSING_STYLES(64)
+DEFINE_PASSING_STYLES(512)
+DEFINE_PASSING_STYLES(4096)
+
+#endif
@@ -0,0 +1,107 @@
+--  Benchmark: per-element swap vs block swap, arrays and records
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Block_Swap;    use Block_Swap;
+
+procedure Bench is
+
+   Small        : constant := 4_096;      --  2 x 16 KB: fits in L1/L2
+   Large        : constant := 1_048_576;  --  2 x 4 MB: streams from memory
+   Record_Swaps : constant := 2_000_000;
+
+   type Array_Access is access Integer_Array;
+   type Record_Access is access Large_Record;
+
+   Arr : constant Array_Access := new Integer_Array (1 .. 2 * Large);
+
+   --  Separate allocations, so the two records are not exactly 4 KB apart
+   Rec_A : constant Record_Access :=
+      new Large_Record'(Key => 1, Payload => (others => 1));
+   Rec_B : constant Record_Access :=
+      new Large_Record'(Key => 2, Payload => (others => 2));
+
+   --  The Swap from 06_pointer_elimination, once per element
+   procedure Swap (A : in out Integer; B : in out Integer) is
+      Temp : constant Integer := A;
+   begin
+      A := B;
+      B := Temp;
+   end Swap;
+
+   procedure Swap_Each (N : Positive) is
+   begin
+      for I in 1 .. N loop
+         Swap (Arr (I), Arr (N + I));
+      end loop;
+   end Swap_Each;
+   pragma Machine_Attribute (Swap_Each, "noipa");
+
+   procedure Swap_Block (N : Positive) is
+   begin
+      Swap_Ranges (Arr.all, From_A => 1, From_B => N + 1, Length => N);
+   end Swap_Block;
+   pragma Machine_Attribute (Swap_Block, "noipa");
+
+   procedure Swap_Copy (A, B : in out Large_Record) is
+      Tmp : constant Large_Record := A;
+   begin
+      A := B;
+      B := Tmp;
+   end Swap_Copy;
+   pragma Machine_Attribute (Swap_Copy, "noipa");
+
+   procedure Bench_Arrays (N : Positive; Rounds : Positive) is
+      Start : Time := Clock;
+   begin
+      for R in 1 .. Rounds loop
+         Swap_Each (N);
+      end loop;
+      Put_Line (Integer'Image (N) & " elements, per-element swap:" &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Rounds)) &
+                " ns/element");
+
+      Start := Clock;
+      for R in 1 .. Rounds loop
+         Swap_Block (N);
+      end loop;
+      Put_Line (Integer'Image (N) & " elements, block swap      :" &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Rounds)) &
+                " ns/element");
+   end Bench_Arrays;
+
+   Start : Time;
+
+begin
+   for I in Arr'Range loop
+      Arr (I) := I;
+   end loop;
+
+   Bench_Arrays (Small, 20_000);
+   Bench_Arrays (Large, 50);
+
+   Start := Clock;
+   for R in 1 .. Record_Swaps loop
+      Swap_Copy (Rec_A.all, Rec_B.all);
+   end loop;
+   Put_Line ("4 KB records, temp-copy swap     :" &
+             Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                               * 1.0E9 / Long_Float (Record_Swaps)) &
+             " ns/swap");
+
+   Start := Clock;
+   for R in 1 .. Record_Swaps loop
+      Swap_Records (Rec_A.all, Rec_B.all);
+   end loop;
+   Put_Line ("4 KB records, block swap         :" &
+             Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                               * 1.0E9 / Long_Float (Record_Swaps)) &
+             " ns/swap");
+
+   Put_Line ("checksum:" & Integer'Image (Arr (Small / 2) + Rec_A.Key));
+end Bench;
@@ -0,0 +1,108 @@
+package body Block_Swap is
+
+   subtype Block is Integer_Array (1 .. Block_Size);
+
+   procedure Swap_Arrays (A, B : in out Integer_Array) is
+      Done : Natural := 0;
+   begin
+      --  Whole blocks: each slice copy compiles to one vector load/store
+      while A'Length - Done >= Block_Size loop
+         pragma Loop_Invariant (Done <= A'Length);
+         pragma Loop_Invariant
+            (for all K in 0 .. Done - 1 =>
+               A (A'First + K) = B'Old (B'First + K)
+               and B (B'First + K) = A'Old (A'First + K));
+         pragma Loop_Invariant
+            (for all K in Done .. A'Length - 1 =>
+               A (A'First + K) = A'Old (A'First + K)
+               and B (B'First + K) = B'Old (B'First + K));
+         pragma Loop_Variant (Increases => Done);
+         declare
+            Tmp : constant Block :=
+               A (A'First + Done .. A'First + Done + Block_Size - 1);
+         begin
+            A (A'First + Done .. A'First + Done + Block_Size - 1) :=
+               B (B'First + Done .. B'First + Done + Block_Size - 1);
+            B (B'First + Done .. B'First + Done + Block_Size - 1) := Tmp;
+         end;
+         Done := Done + Block_Size;
+      end loop;
+
+      --  Tail: fewer than Block_Size elements, one at a time
+      for K in Done .. A'Length - 1 loop
+         declare
+            Tmp : constant Integer := A (A'First + K);
+         begin
+            A (A'First + K) := B (B'First + K);
+            B (B'First + K) := Tmp;
+         end;
+         pragma Loop_Invariant
+            (for all J in 0 .. K =>
+               A (A'First + J) = B'Old (B'First + J)
+               and B (B'First + J) = A'Old (A'First + J));
+         pragma Loop_Invariant
+            (for all J in K + 1 .. A'Length - 1 =>
+               A (A'First + J) = A'Old (A'First + J)
+               and B (B'First + J) = B'Old (B'First + J));
+      end loop;
+   end Swap_Arrays;
+
+   procedure Swap_Ranges
+      (Arr    : in out Integer_Array;
+       From_A : Index_Type;
+       From_B : Index_Type;
+       Length : Natural)
+   is
+      Done : Natural := 0;
+   begin
+      while Length - Done >= Block_Size loop
+         pragma Loop_Invariant (Done <= Length);
+         pragma Loop_Invariant
+            (for all K in 0 .. Done - 1 =>
+               Arr (From_A + K) = Arr'Old (From_B + K)
+               and Arr (From_B + K) = Arr'Old (From_A + K));
+         pragma Loop_Invariant
+            (for all I in Arr'Range =>
+               (if I not in From_A .. From_A + Done - 1
+                   and I not in From_B .. From_B + Done - 1
+                then Arr (I) = Arr'Old (I)));
+         pragma Loop_Variant (Increases => Done);
+         declare
+            Tmp : constant Block :=
+               Arr (From_A + Done .. From_A + Done + Block_Size - 1);
+         begin
+            Arr (From_A + Done .. From_A + Done + Block_Size - 1) :=
+               Arr (From_B + Done .. From_B + Done + Block_Size - 1);
+            Arr (From_B + Done .. From_B + Done + Block_Size - 1) := Tmp;
+         end;
+         Done := Done + Block_Size;
+      end loop;
+
+      for K in Done .. Length - 1 loop
+         declare
+            Tmp : constant Integer := Arr (From_A + K);
+         begin
+            Arr (From_A + K) := Arr (From_B + K);
+            Arr (From_B + K) := Tmp;
+         end;
+         pragma Loop_Invariant
+            (for all J in 0 .. K =>
+               Arr (From_A + J) = Arr'Old (From_B + J)
+               and Arr (From_B + J) = Arr'Old (From_A + J));
+         pragma Loop_Invariant
+            (for all I in Arr'Range =>
+               (if I not in From_A .. From_A + K
+                   and I not in From_B .. From_B + K
+                then Arr (I) = Arr'Old (I)));
+      end loop;
+   end Swap_Ranges;
+
+   procedure Swap_Records (A, B : in out Large_Record) is
+      Key : constant Integer := A.Key;
+   begin
+      A.Key := B.Key;
+      B.Key := Key;
+      Swap_Arrays (A.Payload, B.Payload);
+   end Swap_Records;
+
+end Block_Swap;
@@ -0,0 +1,63 @@
+/*
+ * Block swap of equal-length ranges and of large structs
+ * Exchanges data one vector-width block at a time instead of per element
+ */
+
+#ifndef BLOCK_SWAP_H
+#define BLOCK_SWAP_H
+
+#include <stddef.h>
+#include <string.h>
+
+// 32 bytes = one AVX2 register; memcpy of a constant 32 bytes
+// compiles to a single vector load and store
+#define BLOCK_BYTES 32
+
+// Baseline: the swap() from 06_pointer_elimination, once per element
+static inline void swap_int(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static inline void swap_each(int *a, int *b, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        swap_int(&a[i], &b[i]);
+    }
+}
+
+// ⚠️ The ranges must not overlap; restrict makes that the caller's promise
+static inline void swap_bytes(void *restrict a, void *restrict b, size_t bytes) {
+    unsigned char *pa = a;
+    unsigned char *pb = b;
+    unsigned char tmp[BLOCK_BYTES];
+    size_t i = 0;
+
+    for (; i + BLOCK_BYTES <= bytes; i += BLOCK_BYTES) {
+        memcpy(tmp, pa + i, BLOCK_BYTES);
+        memcpy(pa + i, pb + i, BLOCK_BYTES);
+        memcpy(pb + i, tmp, BLOCK_BYTES);
+    }
+    for (; i < bytes; i++) {
+        unsigned char t = pa[i];
+        pa[i] = pb[i];
+        pb[i] = t;
+    }
+}
+
+// Two non-overlapping ranges of ints (same or different arrays)
+static inline void swap_ranges(int *restrict a, int *restrict b, size_t count) {
+    swap_bytes(a, b, count * sizeof(int));
+}
+
+// A 4 KB struct: key plus payload
+typedef struct {
+    int key;
+    int payload[1023];
+} large_record;
+
+static inline void swap_records(large_record *restrict a, large_record *restrict b) {
+    swap_bytes(a, b, sizeof(large_record));
+}
+
+#endif
@@ -0,0 +1,39 @@
+--  Block swap of array ranges and records
+--  Building block for in-place rotation and partitioning
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Block_Swap;  use Block_Swap;
+
+procedure Example is
+
+   procedure Print (Label : String; Arr : Integer_Array) is
+   begin
+      Put (Label);
+      for I in Arr'Range loop
+         Put (Integer'Image (Arr (I)) & " ");
+      end loop;
+      New_Line;
+   end Print;
+
+   Arr  : Integer_Array (1 .. 20) := (others => 0);
+   A, B : Large_Record;
+
+begin
+   for I in Arr'Range loop
+      Arr (I) := I;
+   end loop;
+
+   --  Swap two ranges of 9 elements: one full block plus a tail
+   Print ("Before: ", Arr);
+   Swap_Ranges (Arr, From_A => 1, From_B => 11, Length => 9);
+   Print ("After:  ", Arr);
+
+   --  Swap two large records
+   A := (Key => 1, Payload => (others => 10));
+   B := (Key => 2, Payload => (others => 20));
+   Swap_Records (A, B);
+   Put_Line ("Records: A.Key=" & Integer'Image (A.Key) &
+             " A.Payload (1)=" & Integer'Image (A.Payload (1)) &
+             ", B.Key=" & Integer'Image (B.Key) &
+             " B.Payload (1)=" & Integer'Image (B.Payload (1)));
+end Example;
@@ -0,0 +1,35 @@
+/*
+ * Block swap of array ranges and records
+ * Building block for in-place rotation and partitioning
+ */
+
+#include <stdio.h>
+#include "block_swap.h"
+
+static void print_array(const char *label, const int *arr, int size) {
+    printf("%s", label);
+    for (int i = 0; i < size; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+int main(void) {
+    int arr[20];
+    for (int i = 0; i < 20; i++) {
+        arr[i] = i + 1;
+    }
+
+    // Swap two ranges of 9 elements: one full block plus a tail
+    print_array("Before: ", arr, 20);
+    swap_ranges(&arr[0], &arr[10], 9);
+    print_array("After:  ", arr, 20);
+
+    // Swap two large records
+    static large_record a = {1, {10}}, b = {2, {20}};
+    swap_records(&a, &b);
+    printf("Records: a.key=%d a.payload[0]=%d, b.key=%d b.payload[0]=%d\n",
+           a.key, a.payload[0], b.key, b.payload[0]);
+
+    return 0;
+}
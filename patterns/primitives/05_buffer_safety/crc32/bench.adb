@@ -0,0 +1,81 @@
+--  Benchmark: CRC32.Update (slicing-by-8) against Update_Bytewise on the
+--  1 MB random buffer of bench.c, in GB/s
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Byte_Buffers;  use Byte_Buffers;
+with CRC32;         use CRC32;
+
+procedure Bench is
+
+   Size   : constant := 2 ** 20;
+   Passes : constant := 200;
+
+   subtype Block is Buffer_Array (1 .. Size);
+   type Block_Access is access Block;
+
+   type CRC_Kernel is access function (Data : Block) return Unsigned_32;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   function Run_Bytewise (Data : Block) return Unsigned_32 is
+     (not Update_Bytewise (16#FFFF_FFFF#, Data));
+   pragma Machine_Attribute (Run_Bytewise, "noipa");
+
+   function Run_Slicing (Data : Block) return Unsigned_32 is
+     (Checksum (Data));
+   pragma Machine_Attribute (Run_Slicing, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Buffer : constant Block_Access := new Block;
+
+   Check : Unsigned_32 := 0;
+
+   package Hex_IO is new Modular_IO (Unsigned_32);
+
+   procedure Run (Label : String; K : CRC_Kernel) is
+      CRC   : Unsigned_32 := 0;
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         CRC := K (Buffer.all);
+         Check := Check + CRC;
+      end loop;
+      Put (Label &
+           Long_Float'Image (Long_Float (Size) * Long_Float (Passes)
+                             / Long_Float (To_Duration (Clock - Start))
+                             / 1.0E9) &
+           " GB/s  crc ");
+      Hex_IO.Put (CRC, Width => 0, Base => 16);
+      New_Line;
+   end Run;
+
+begin
+   for I in Buffer'Range loop
+      Buffer (I) := Unsigned_8'Mod (Next_Random);
+   end loop;
+
+   Run ("bytewise table    :", Run_Bytewise'Access);
+   Run ("slicing-by-8      :", Run_Slicing'Access);
+
+   Put_Line ("checksum:" & Unsigned_32'Image (Check));
+end Bench;
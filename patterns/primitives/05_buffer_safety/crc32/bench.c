@@ -0,0 +1,94 @@
+/*
+ * Benchmark: CRC-32 of a 1 MB random buffer, in GB/s
+ * - bitwise: the definition, eight shift/xor steps per byte
+ * - bytewise: one table lookup per byte
+ * - slicing-by-8: crc32_update
+ * - crc32c_hw_update: the SSE4.2 instruction, CRC-32C polynomial
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "crc32.h"
+
+#define SIZE   (1 << 20)
+#define PASSES 200
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- kernels ---- */
+
+__attribute__((noipa)) static uint32_t run_bitwise(const uint8_t *p,
+                                                   size_t n) {
+    return ~crc32_bitwise(0xffffffffu, p, n);
+}
+
+__attribute__((noipa)) static uint32_t run_bytewise(const uint8_t *p,
+                                                    size_t n) {
+    return ~crc32_bytewise(0xffffffffu, p, n);
+}
+
+__attribute__((noipa)) static uint32_t run_slicing(const uint8_t *p,
+                                                   size_t n) {
+    return crc32(p, n);
+}
+
+#ifdef __SSE4_2__
+__attribute__((noipa)) static uint32_t run_hardware(const uint8_t *p,
+                                                    size_t n) {
+    return crc32c(p, n);
+}
+#endif
+
+/* ---- driver ---- */
+
+static uint32_t checksum;
+
+static void run(const char *label, uint32_t (*kernel)(const uint8_t *,
+                                                      size_t),
+                const uint8_t *buffer, int passes) {
+    uint32_t crc = 0;
+    double start = now_ns();
+    for (int p = 0; p < passes; p++) {
+        crc = kernel(buffer, SIZE);
+        checksum += crc;
+    }
+    double elapsed = now_ns() - start;
+    printf("%-22s: %6.2f GB/s  crc %08x\n", label,
+           (double)SIZE * passes / elapsed, crc);
+}
+
+int main(void) {
+    uint8_t *buffer = malloc(SIZE);
+    if (!buffer) {
+        return 1;
+    }
+    for (size_t i = 0; i < SIZE; i++) {
+        buffer[i] = (uint8_t)next_random();
+    }
+
+    // The bitwise loop is over 20x slower than slicing: fewer passes
+    run("bitwise", run_bitwise, buffer, PASSES / 20);
+    run("bytewise table", run_bytewise, buffer, PASSES);
+    run("slicing-by-8", run_slicing, buffer, PASSES);
+#ifdef __SSE4_2__
+    run("crc32c, SSE4.2", run_hardware, buffer, PASSES);
+#endif
+
+    printf("checksum: %u\n", checksum);
+    free(buffer);
+    return 0;
+}
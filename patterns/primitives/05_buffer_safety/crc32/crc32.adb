@@ -0,0 +1,375 @@
+with CRC32.Tables; use CRC32.Tables;
+
+package body CRC32 is
+
+   --  Byte K of X, K = 0 the lowest
+   function Byte (X : Unsigned_32; K : Natural) return Unsigned_8 is
+     (Unsigned_8 (Shift_Right (X, 8 * K) and 16#FF#))
+   with Pre => K <= 3;
+
+   --  The four bytes from J, little-endian: GCC merges the ors into one
+   --  load
+   function Word (Data : Buffer_Array; J : Positive) return Unsigned_32 is
+     (Unsigned_32 (Data (J))
+      or Shift_Left (Unsigned_32 (Data (J + 1)), 8)
+      or Shift_Left (Unsigned_32 (Data (J + 2)), 16)
+      or Shift_Left (Unsigned_32 (Data (J + 3)), 24))
+   with Pre => J in Data'Range and then Data'Last - J >= 3;
+
+   -----------
+   -- Ghost --
+   -----------
+
+   --  One zero byte through the definition
+   function Zero_Step (C : Unsigned_32) return Unsigned_32 is
+     (Byte_Step (C, 0))
+   with Ghost;
+
+   --  N zero bytes
+   function Zeros (C : Unsigned_32; N : Natural) return Unsigned_32 is
+     (if N = 0 then C else Zeros (Zero_Step (C), N - 1))
+   with Ghost,
+        Subprogram_Variant => (Decreases => N);
+
+   ------------
+   -- Lemmas --
+   ------------
+
+   --  The first table is the definition applied to each byte value: the
+   --  bit-vector solver checks it against all 256 entries
+   procedure Lemma_Table (I : Unsigned_8)
+   with Ghost,
+        Post => Table (0, I) = Byte_Step (0, I)
+   is
+   begin
+      null;
+   end Lemma_Table;
+
+   --  The rule the other tables are generated by, checked entry by entry
+   procedure Lemma_Table_Next (K : Natural; I : Unsigned_8)
+   with Ghost,
+        Pre  => K in 1 .. 7,
+        Post => Table (K, I) = Zero_Step (Table (K - 1, I))
+   is
+   begin
+      null;
+   end Lemma_Table_Next;
+
+   --  The definition is linear: the bits of C above its low byte only
+   --  shift, and the low byte, xored with B, goes through the eight
+   --  steps on its own. The bit-vector solver proves it
+   procedure Lemma_Byte_Step (C : Unsigned_32; B : Unsigned_8)
+   with Ghost,
+        Post => Byte_Step (C, B)
+                = (Shift_Right (C, 8) xor Byte_Step (0, Byte (C, 0) xor B))
+   is
+   begin
+      null;
+   end Lemma_Byte_Step;
+
+   --  A byte is xored in before the steps. The bit-vector solver proves
+   --  this and the next two
+   procedure Lemma_Step_Zero (C : Unsigned_32; B : Unsigned_8)
+   with Ghost,
+        Post => Byte_Step (C, B) = Zero_Step (C xor Unsigned_32 (B))
+   is
+   begin
+      null;
+   end Lemma_Step_Zero;
+
+   --  Each bit step is a shift and a conditional xor, so it is linear
+   procedure Lemma_Zero_Linear (A, B : Unsigned_32)
+   with Ghost,
+        Post => Zero_Step (A xor B) = (Zero_Step (A) xor Zero_Step (B))
+   is
+   begin
+      null;
+   end Lemma_Zero_Linear;
+
+   --  With a zero low byte, no polynomial is xored in: the steps only
+   --  shift
+   procedure Lemma_Zero_Shift (X : Unsigned_32)
+   with Ghost,
+        Pre  => X < 2 ** 24,
+        Post => Zero_Step (Shift_Left (X, 8)) = X
+   is
+   begin
+      null;
+   end Lemma_Zero_Shift;
+
+   procedure Lemma_Zeros_Linear (A, B : Unsigned_32; N : Natural)
+   with Ghost,
+        Post               => Zeros (A xor B, N)
+                              = (Zeros (A, N) xor Zeros (B, N)),
+        Subprogram_Variant => (Decreases => N)
+   is
+   begin
+      if N > 0 then
+         Lemma_Zero_Linear (A, B);
+         Lemma_Zeros_Linear (Zero_Step (A), Zero_Step (B), N - 1);
+      end if;
+   end Lemma_Zeros_Linear;
+
+   --  Zeros takes the first step first; this takes the last one
+   procedure Lemma_Zeros_Last (C : Unsigned_32; N : Natural)
+   with Ghost,
+        Pre                => N >= 1,
+        Post               => Zeros (C, N) = Zero_Step (Zeros (C, N - 1)),
+        Subprogram_Variant => (Decreases => N)
+   is
+   begin
+      if N > 1 then
+         Lemma_Zeros_Last (Zero_Step (C), N - 1);
+      end if;
+   end Lemma_Zeros_Last;
+
+   --  Table (K, I) is byte I and then K zero bytes
+   procedure Lemma_Table_Zeros (K : Natural; I : Unsigned_8)
+   with Ghost,
+        Pre                => K <= 7,
+        Post               => Table (K, I) = Zeros (Unsigned_32 (I), K + 1),
+        Subprogram_Variant => (Decreases => K)
+   is
+   begin
+      if K = 0 then
+         Lemma_Table (I);
+         Lemma_Step_Zero (0, I);
+      else
+         Lemma_Table_Zeros (K - 1, I);
+         Lemma_Table_Next (K, I);
+         Lemma_Zeros_Last (Unsigned_32 (I), K + 1);
+      end if;
+   end Lemma_Table_Zeros;
+
+   --  Byte X placed K bytes up reaches the low byte after K zero steps
+   procedure Lemma_Shifted_Byte (X : Unsigned_8; K, N : Natural)
+   with Ghost,
+        Pre                => K <= 3 and then N >= K,
+        Post               => Zeros (Shift_Left (Unsigned_32 (X), 8 * K), N)
+                              = Zeros (Unsigned_32 (X), N - K),
+        Subprogram_Variant => (Decreases => K)
+   is
+   begin
+      if K > 0 then
+         Lemma_Zero_Shift (Shift_Left (Unsigned_32 (X), 8 * (K - 1)));
+         pragma Assert
+           (Shift_Left (Unsigned_32 (X), 8 * K)
+            = Shift_Left (Shift_Left (Unsigned_32 (X), 8 * (K - 1)), 8));
+         Lemma_Shifted_Byte (X, K - 1, N - 1);
+      end if;
+   end Lemma_Shifted_Byte;
+
+   --  One of the first four bytes of a block: after K bytes the register
+   --  is the bytes so far, each in its place, through K zero steps
+   procedure Lemma_Step_Low (S, P : Unsigned_32; K : Natural; B : Unsigned_8)
+   with Ghost,
+        Pre  => K <= 3 and then S = Zeros (P, K),
+        Post => Byte_Step (S, B)
+                = Zeros (P xor Shift_Left (Unsigned_32 (B), 8 * K), K + 1)
+   is
+   begin
+      Lemma_Step_Zero (S, B);
+      Lemma_Zero_Linear (S, Unsigned_32 (B));
+      Lemma_Zeros_Linear (P, Shift_Left (Unsigned_32 (B), 8 * K), K + 1);
+      Lemma_Zeros_Last (P, K + 1);
+      Lemma_Shifted_Byte (B, K, K + 1);
+   end Lemma_Step_Low;
+
+   --  One of the last four bytes: the register is the first four
+   --  through K zero steps, xor the later bytes, T, through fewer
+   procedure Lemma_Step_High
+     (S, Low, T : Unsigned_32;
+      K         : Natural;
+      B         : Unsigned_8)
+   with Ghost,
+        Pre  => K in 4 .. 7 and then S = (Zeros (Low, K) xor T),
+        Post => Byte_Step (S, B)
+                = (Zeros (Low, K + 1) xor Zero_Step (T)
+                   xor Zero_Step (Unsigned_32 (B)))
+   is
+   begin
+      Lemma_Step_Zero (S, B);
+      Lemma_Zero_Linear (S, Unsigned_32 (B));
+      Lemma_Zero_Linear (Zeros (Low, K), T);
+      Lemma_Zeros_Last (Low, K + 1);
+   end Lemma_Step_High;
+
+   --  One slicing step is eight steps of the definition
+   procedure Lemma_Block
+     (C, R, Low : Unsigned_32;
+      Data      : Buffer_Array;
+      J         : Positive)
+   with Ghost,
+        Pre  => J in Data'Range
+                and then Data'Last - J >= 7
+                and then R = Bitwise (C, Data (Data'First .. J - 1))
+                and then Low = (R xor Word (Data, J)),
+        Post => Bitwise (C, Data (Data'First .. J + 7))
+                = (Table (7, Byte (Low, 0)) xor Table (6, Byte (Low, 1))
+                   xor Table (5, Byte (Low, 2)) xor Table (4, Byte (Low, 3))
+                   xor Table (3, Data (J + 4)) xor Table (2, Data (J + 5))
+                   xor Table (1, Data (J + 6)) xor Table (0, Data (J + 7)))
+   is
+      D0 : constant Unsigned_32 := Unsigned_32 (Data (J));
+      D1 : constant Unsigned_32 := Shift_Left (Unsigned_32 (Data (J + 1)), 8);
+      D2 : constant Unsigned_32 :=
+        Shift_Left (Unsigned_32 (Data (J + 2)), 16);
+      D3 : constant Unsigned_32 :=
+        Shift_Left (Unsigned_32 (Data (J + 3)), 24);
+
+      B0 : constant Unsigned_8 := Byte (Low, 0);
+      B1 : constant Unsigned_8 := Byte (Low, 1);
+      B2 : constant Unsigned_8 := Byte (Low, 2);
+      B3 : constant Unsigned_8 := Byte (Low, 3);
+
+      --  The definition, one byte at a time
+      S1 : constant Unsigned_32 := Byte_Step (R, Data (J));
+      S2 : constant Unsigned_32 := Byte_Step (S1, Data (J + 1));
+      S3 : constant Unsigned_32 := Byte_Step (S2, Data (J + 2));
+      S4 : constant Unsigned_32 := Byte_Step (S3, Data (J + 3));
+      S5 : constant Unsigned_32 := Byte_Step (S4, Data (J + 4));
+      S6 : constant Unsigned_32 := Byte_Step (S5, Data (J + 5));
+      S7 : constant Unsigned_32 := Byte_Step (S6, Data (J + 6));
+      S8 : constant Unsigned_32 := Byte_Step (S7, Data (J + 7));
+   begin
+      pragma Assert (S1 = Bitwise (C, Data (Data'First .. J)));
+      pragma Assert (S2 = Bitwise (C, Data (Data'First .. J + 1)));
+      pragma Assert (S3 = Bitwise (C, Data (Data'First .. J + 2)));
+      pragma Assert (S4 = Bitwise (C, Data (Data'First .. J + 3)));
+      pragma Assert (S5 = Bitwise (C, Data (Data'First .. J + 4)));
+      pragma Assert (S6 = Bitwise (C, Data (Data'First .. J + 5)));
+      pragma Assert (S7 = Bitwise (C, Data (Data'First .. J + 6)));
+      pragma Assert (S8 = Bitwise (C, Data (Data'First .. J + 7)));
+
+      --  The first four bytes: the register is Low through four zero
+      --  steps
+      Lemma_Step_Low (R, R, 0, Data (J));
+      Lemma_Step_Low (S1, R xor D0, 1, Data (J + 1));
+      Lemma_Step_Low (S2, R xor D0 xor D1, 2, Data (J + 2));
+      Lemma_Step_Low (S3, R xor D0 xor D1 xor D2, 3, Data (J + 3));
+      pragma Assert (Low = (R xor D0 xor D1 xor D2 xor D3));
+      pragma Assert (S4 = Zeros (Low, 4));
+
+      --  The last four: each is looked up in the table for the zero
+      --  bytes after it
+      Lemma_Step_High (S4, Low, 0, 4, Data (J + 4));
+      Lemma_Table_Zeros (0, Data (J + 4));
+      pragma Assert (S5 = (Zeros (Low, 5) xor Table (0, Data (J + 4))));
+
+      Lemma_Step_High (S5, Low, Table (0, Data (J + 4)), 5, Data (J + 5));
+      Lemma_Table_Next (1, Data (J + 4));
+      Lemma_Table_Zeros (0, Data (J + 5));
+      pragma Assert
+        (S6 = (Zeros (Low, 6) xor Table (1, Data (J + 4))
+               xor Table (0, Data (J + 5))));
+
+      Lemma_Step_High
+        (S6, Low, Table (1, Data (J + 4)) xor Table (0, Data (J + 5)),
+         6, Data (J + 6));
+      Lemma_Zero_Linear (Table (1, Data (J + 4)), Table (0, Data (J + 5)));
+      Lemma_Table_Next (2, Data (J + 4));
+      Lemma_Table_Next (1, Data (J + 5));
+      Lemma_Table_Zeros (0, Data (J + 6));
+      pragma Assert
+        (S7 = (Zeros (Low, 7) xor Table (2, Data (J + 4))
+               xor Table (1, Data (J + 5)) xor Table (0, Data (J + 6))));
+
+      Lemma_Step_High
+        (S7, Low,
+         Table (2, Data (J + 4)) xor Table (1, Data (J + 5))
+         xor Table (0, Data (J + 6)),
+         7, Data (J + 7));
+      Lemma_Zero_Linear
+        (Table (2, Data (J + 4)) xor Table (1, Data (J + 5)),
+         Table (0, Data (J + 6)));
+      Lemma_Zero_Linear (Table (2, Data (J + 4)), Table (1, Data (J + 5)));
+      Lemma_Table_Next (3, Data (J + 4));
+      Lemma_Table_Next (2, Data (J + 5));
+      Lemma_Table_Next (1, Data (J + 6));
+      Lemma_Table_Zeros (0, Data (J + 7));
+
+      --  Low through eight zero steps: each of its bytes through the
+      --  steps that remain after its place
+      pragma Assert
+        (Low = (Unsigned_32 (B0)
+                xor Shift_Left (Unsigned_32 (B1), 8)
+                xor Shift_Left (Unsigned_32 (B2), 16)
+                xor Shift_Left (Unsigned_32 (B3), 24)));
+      Lemma_Zeros_Linear
+        (Unsigned_32 (B0) xor Shift_Left (Unsigned_32 (B1), 8)
+         xor Shift_Left (Unsigned_32 (B2), 16),
+         Shift_Left (Unsigned_32 (B3), 24), 8);
+      Lemma_Zeros_Linear
+        (Unsigned_32 (B0) xor Shift_Left (Unsigned_32 (B1), 8),
+         Shift_Left (Unsigned_32 (B2), 16), 8);
+      Lemma_Zeros_Linear
+        (Unsigned_32 (B0), Shift_Left (Unsigned_32 (B1), 8), 8);
+      Lemma_Shifted_Byte (B1, 1, 8);
+      Lemma_Shifted_Byte (B2, 2, 8);
+      Lemma_Shifted_Byte (B3, 3, 8);
+      Lemma_Table_Zeros (7, B0);
+      Lemma_Table_Zeros (6, B1);
+      Lemma_Table_Zeros (5, B2);
+      Lemma_Table_Zeros (4, B3);
+   end Lemma_Block;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   function Update_Bytewise
+     (C    : Unsigned_32;
+      Data : Buffer_Array) return Unsigned_32
+   is
+      R : Unsigned_32 := C;
+   begin
+      for I in Data'Range loop
+         Lemma_Byte_Step (R, Data (I));
+         Lemma_Table (Byte (R, 0) xor Data (I));
+         R := Shift_Right (R, 8) xor Table (0, Byte (R, 0) xor Data (I));
+         pragma Loop_Invariant (R = Bitwise (C, Data (Data'First .. I)));
+      end loop;
+      return R;
+   end Update_Bytewise;
+
+   --  The register is xored into the first four bytes of each eight.
+   --  Table (K, I) is byte I followed by K zero bytes, so each byte is
+   --  looked up in the table for the bytes that follow it
+   function Update (C : Unsigned_32; Data : Buffer_Array) return Unsigned_32
+   is
+      Words : constant Natural := Data'Length / 8;
+      Rest  : constant Natural := Data'Length mod 8;
+
+      R   : Unsigned_32 := C;
+      J   : Positive;
+      Low : Unsigned_32;
+   begin
+      for K in 0 .. Words - 1 loop
+         J := Data'First + 8 * K;
+         Low := R xor Word (Data, J);
+         Lemma_Block (C, R, Low, Data, J);
+
+         R := Table (7, Byte (Low, 0)) xor Table (6, Byte (Low, 1))
+              xor Table (5, Byte (Low, 2)) xor Table (4, Byte (Low, 3))
+              xor Table (3, Data (J + 4)) xor Table (2, Data (J + 5))
+              xor Table (1, Data (J + 6)) xor Table (0, Data (J + 7));
+         pragma Loop_Invariant
+           (R = Bitwise (C, Data (Data'First .. Data'First + 8 * K + 7)));
+      end loop;
+      pragma Assert (R = Bitwise (C, Data (Data'First .. Data'Last - Rest)));
+
+      --  The last 0 .. 7 bytes, as Update_Bytewise. Data'Last - (Rest - 1),
+      --  not Data'First + 8 * Words: the second overflows when Data ends
+      --  at Positive'Last
+      if Rest > 0 then
+         for I in Data'Last - (Rest - 1) .. Data'Last loop
+            Lemma_Byte_Step (R, Data (I));
+            Lemma_Table (Byte (R, 0) xor Data (I));
+            R := Shift_Right (R, 8) xor Table (0, Byte (R, 0) xor Data (I));
+            pragma Loop_Invariant (R = Bitwise (C, Data (Data'First .. I)));
+         end loop;
+      end if;
+      return R;
+   end Update;
+
+end CRC32;
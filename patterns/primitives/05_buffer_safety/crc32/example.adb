@@ -0,0 +1,61 @@
+--  CRC-32: the check value, a buffer in pieces, and slicing-by-8 against
+--  the byte-at-a-time version
+
+with Ada.Text_IO;  use Ada.Text_IO;
+with Interfaces;   use Interfaces;
+with Byte_Buffers; use Byte_Buffers;
+with CRC32;        use CRC32;
+
+procedure Example is
+
+   package Hex_IO is new Modular_IO (Unsigned_32);
+
+   --  The bytes of a String, as Character'Pos
+   function To_Buffer (S : String) return Buffer_Array is
+      B : Buffer_Array (S'Range);
+   begin
+      for I in S'Range loop
+         B (I) := Character'Pos (S (I));
+      end loop;
+      return B;
+   end To_Buffer;
+
+   Check : constant Buffer_Array := To_Buffer ("123456789");
+
+   Data       : Buffer_Array (1 .. 72);
+   C          : Unsigned_32;
+   Mismatches : Natural := 0;
+
+   procedure Put_Hex (Label : String; X : Unsigned_32) is
+   begin
+      Put (Label);
+      Hex_IO.Put (X, Width => 0, Base => 16);
+      New_Line;
+   end Put_Hex;
+
+begin
+   --  The standard check value: 16#CBF43926#
+   Put_Hex ("Checksum (""123456789""): ", Checksum (Check));
+
+   --  The register carries over: 4 bytes, then 5, as one buffer
+   C := Update (16#FFFF_FFFF#, Check (1 .. 4));
+   C := Update (C, Check (5 .. 9));
+   Put_Hex ("In two pieces:          ", not C);
+
+   --  Slicing-by-8 against the proven byte-at-a-time version, for every
+   --  length and alignment up to 64 bytes
+   for I in Data'Range loop
+      Data (I) := Unsigned_8'Mod (I * 37 + 11);
+   end loop;
+   for Start in 1 .. 8 loop
+      for N in 0 .. 64 loop
+         if Update (16#FFFF_FFFF#, Data (Start .. Start + N - 1))
+            /= Update_Bytewise (16#FFFF_FFFF#, Data (Start .. Start + N - 1))
+         then
+            Mismatches := Mismatches + 1;
+         end if;
+      end loop;
+   end loop;
+   Put_Line ("Mismatches against Update_Bytewise:" &
+             Natural'Image (Mismatches));
+end Example;
@@ -0,0 +1,100 @@
+/*
+ * Benchmark: FNV-1a and XXH64 on short and long inputs
+ * - short: 1M random 16-byte keys, as a hash map or Bloom filter sees
+ *   them, in ns per hash
+ * - long: a 1 MB random buffer, in GB/s
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "hash.h"
+
+#define KEYS       (1 << 20)
+#define KEY_LENGTH 16
+#define SIZE       (1 << 20)
+#define PASSES     20
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- kernels ---- */
+
+__attribute__((noipa)) static uint64_t run_fnv1a(const uint8_t *p,
+                                                 size_t n) {
+    return fnv1a64(p, n);
+}
+
+__attribute__((noipa)) static uint64_t run_xxh64(const uint8_t *p,
+                                                 size_t n) {
+    return xxh64(p, n, 0);
+}
+
+/* ---- driver ---- */
+
+static uint64_t checksum;
+
+static void run_short(const char *label,
+                      uint64_t (*kernel)(const uint8_t *, size_t),
+                      const uint8_t *keys) {
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        for (size_t k = 0; k < KEYS; k++) {
+            checksum += kernel(keys + k * KEY_LENGTH, KEY_LENGTH);
+        }
+    }
+    double elapsed = now_ns() - start;
+    printf("%-16s: %6.2f ns/hash\n", label,
+           elapsed / ((double)KEYS * PASSES));
+}
+
+static void run_long(const char *label,
+                     uint64_t (*kernel)(const uint8_t *, size_t),
+                     const uint8_t *buffer) {
+    double start = now_ns();
+    for (int p = 0; p < 10 * PASSES; p++) {
+        checksum += kernel(buffer, SIZE);
+    }
+    double elapsed = now_ns() - start;
+    printf("%-16s: %6.2f GB/s\n", label,
+           (double)SIZE * 10 * PASSES / elapsed);
+}
+
+int main(void) {
+    uint8_t *keys = malloc((size_t)KEYS * KEY_LENGTH);
+    uint8_t *buffer = malloc(SIZE);
+    if (!keys || !buffer) {
+        return 1;
+    }
+    for (size_t i = 0; i < (size_t)KEYS * KEY_LENGTH; i++) {
+        keys[i] = (uint8_t)next_random();
+    }
+    for (size_t i = 0; i < SIZE; i++) {
+        buffer[i] = (uint8_t)next_random();
+    }
+
+    printf("16-byte keys\n");
+    run_short("fnv1a64", run_fnv1a, keys);
+    run_short("xxh64", run_xxh64, keys);
+
+    printf("1 MB buffer\n");
+    run_long("fnv1a64", run_fnv1a, buffer);
+    run_long("xxh64", run_xxh64, buffer);
+
+    printf("checksum: %llu\n", (unsigned long long)checksum);
+    free(keys);
+    free(buffer);
+    return 0;
+}
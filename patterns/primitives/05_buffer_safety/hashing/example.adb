@@ -0,0 +1,78 @@
+--  FNV-1a and XXH64: the reference values, a String against the
+--  Buffer_Array of its bytes, and the seed
+
+with Ada.Text_IO;  use Ada.Text_IO;
+with Interfaces;   use Interfaces;
+with Byte_Buffers; use Byte_Buffers;
+with Hashes;       use Hashes;
+
+procedure Example is
+
+   package Hex_IO is new Modular_IO (Unsigned_64);
+
+   --  The bytes of a String, as Character'Pos
+   function To_Buffer (S : String) return Buffer_Array is
+      B : Buffer_Array (S'Range);
+   begin
+      for I in S'Range loop
+         B (I) := Character'Pos (S (I));
+      end loop;
+      return B;
+   end To_Buffer;
+
+   Long : constant String := "Nobody inspects the spammish repetition";
+
+   Data      : Buffer_Array (1 .. 40);
+   Before    : Unsigned_64;
+   Unchanged : Natural := 0;
+
+   procedure Put_Hashes (S : String) is
+   begin
+      Put ("""" & S & """");
+      Set_Col (45);
+      Hex_IO.Put (FNV_1a (S), Width => 0, Base => 16);
+      Put ("  ");
+      Hex_IO.Put (XXH64 (S), Width => 0, Base => 16);
+      New_Line;
+   end Put_Hashes;
+
+begin
+   --  XXH64: 16#EF46DB3751D8E999#, 16#D24EC4F1A98C6E5B#,
+   --  16#44BC2CF5AD770999# and, through the 32-byte stripes,
+   --  16#FBCEA83C8A378BF1#
+   Put_Line ("Input, FNV-1a, XXH64");
+   Put_Hashes ("");
+   Put_Hashes ("a");
+   Put_Hashes ("abc");
+   Put_Hashes (Long);
+
+   --  A String and its bytes hash alike
+   Put_Line ("String and Buffer_Array agree: " &
+             Boolean'Image (FNV_1a (Long) = FNV_1a (To_Buffer (Long))
+                            and XXH64 (Long) = XXH64 (To_Buffer (Long))));
+
+   --  A seed gives an independent hash of the same bytes, e.g. for the
+   --  k functions of a Bloom filter
+   Put ("XXH64 (""abc""), seeds 0 to 2:");
+   for Seed in Unsigned_64 range 0 .. 2 loop
+      Put (" ");
+      Hex_IO.Put (XXH64 ("abc", Seed), Width => 0, Base => 16);
+   end loop;
+   New_Line;
+
+   --  Every length from 1 to 40 takes a different mix of the 32-, 8-, 4-
+   --  and 1-byte steps; a changed last byte changes every hash
+   for I in Data'Range loop
+      Data (I) := Unsigned_8'Mod (I * 37 + 11);
+   end loop;
+   for N in Data'Range loop
+      Before := XXH64 (Data (1 .. N));
+      Data (N) := Data (N) xor 1;
+      if XXH64 (Data (1 .. N)) = Before then
+         Unchanged := Unchanged + 1;
+      end if;
+      Data (N) := Data (N) xor 1;
+   end loop;
+   Put_Line ("Unchanged hashes after a bit flip:" &
+             Natural'Image (Unchanged));
+end Example;
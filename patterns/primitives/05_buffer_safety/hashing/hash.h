@@ -0,0 +1,114 @@
+/*
+ * Non-cryptographic 64-bit hashes over a byte buffer
+ * - fnv1a64: FNV-1a, one xor and one multiply per byte
+ * - xxh64: XXH64, four independent multiply-rotate lanes over 32-byte
+ *   stripes, then a final mix; the same results as the reference xxHash
+ * Words are read little-endian with memcpy, as the Ada version
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define FNV64_OFFSET 0xcbf29ce484222325u
+#define FNV64_PRIME  0x00000100000001b3u
+
+static inline uint64_t fnv1a64(const uint8_t *p, size_t n) {
+    uint64_t h = FNV64_OFFSET;
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= FNV64_PRIME;
+    }
+    return h;
+}
+
+#define XXH_P1 0x9e3779b185ebca87u
+#define XXH_P2 0xc2b2ae3d27d4eb4fu
+#define XXH_P3 0x165667b19e3779f9u
+#define XXH_P4 0x85ebca77c2b2ae63u
+#define XXH_P5 0x27d4eb2f165667c5u
+
+static inline uint64_t xxh_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t xxh_read64(const uint8_t *p) {
+    uint64_t x;
+    memcpy(&x, p, 8);
+    return x;
+}
+
+static inline uint32_t xxh_read32(const uint8_t *p) {
+    uint32_t x;
+    memcpy(&x, p, 4);
+    return x;
+}
+
+static inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_P2;
+    acc = xxh_rotl(acc, 31);
+    return acc * XXH_P1;
+}
+
+static inline uint64_t xxh_merge(uint64_t h, uint64_t acc) {
+    h ^= xxh_round(0, acc);
+    return h * XXH_P1 + XXH_P4;
+}
+
+static inline uint64_t xxh64(const uint8_t *p, size_t n, uint64_t seed) {
+    const uint8_t *end = p + n;
+    uint64_t h;
+
+    if (n >= 32) {
+        uint64_t v1 = seed + XXH_P1 + XXH_P2;
+        uint64_t v2 = seed + XXH_P2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_P1;
+        // The four lanes do not depend on each other: their multiplies
+        // overlap in the pipeline
+        do {
+            v1 = xxh_round(v1, xxh_read64(p));
+            v2 = xxh_round(v2, xxh_read64(p + 8));
+            v3 = xxh_round(v3, xxh_read64(p + 16));
+            v4 = xxh_round(v4, xxh_read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        h = xxh_rotl(v1, 1) + xxh_rotl(v2, 7) + xxh_rotl(v3, 12)
+            + xxh_rotl(v4, 18);
+        h = xxh_merge(h, v1);
+        h = xxh_merge(h, v2);
+        h = xxh_merge(h, v3);
+        h = xxh_merge(h, v4);
+    } else {
+        h = seed + XXH_P5;
+    }
+    h += n;
+
+    while (end - p >= 8) {
+        h ^= xxh_round(0, xxh_read64(p));
+        h = xxh_rotl(h, 27) * XXH_P1 + XXH_P4;
+        p += 8;
+    }
+    if (end - p >= 4) {
+        h ^= xxh_read32(p) * XXH_P1;
+        h = xxh_rotl(h, 23) * XXH_P2 + XXH_P3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= *p++ * XXH_P5;
+        h = xxh_rotl(h, 11) * XXH_P1;
+    }
+
+    // Avalanche: every input bit reaches every output bit
+    h ^= h >> 33;
+    h *= XXH_P2;
+    h ^= h >> 29;
+    h *= XXH_P3;
+    h ^= h >> 32;
+    return h;
+}
+
+#endif
@@ -0,0 +1,167 @@
+package body Hashes is
+
+   P1 : constant Unsigned_64 := 16#9E37_79B1_85EB_CA87#;
+   P2 : constant Unsigned_64 := 16#C2B2_AE3D_27D4_EB4F#;
+   P3 : constant Unsigned_64 := 16#1656_67B1_9E37_79F9#;
+   P4 : constant Unsigned_64 := 16#85EB_CA77_C2B2_AE63#;
+   P5 : constant Unsigned_64 := 16#27D4_EB2F_1656_67C5#;
+
+   --  One lane step: add the input, rotate, multiply
+   function Round (Acc, Input : Unsigned_64) return Unsigned_64 is
+     (Rotate_Left (Acc + Input * P2, 31) * P1);
+
+   --  Folds a lane into the hash once the stripes are done
+   function Merge (H, Acc : Unsigned_64) return Unsigned_64 is
+     ((H xor Round (0, Acc)) * P1 + P4);
+
+   --  The kernels are written once, for any array of 8-bit elements, and
+   --  instantiated for Buffer_Array and String. Each instance is proven
+   --  on its own
+   generic
+      type Element is (<>);
+      type Element_Array is array (Positive range <>) of Element;
+   package Generic_Hashes is
+
+      function FNV_1a (Data : Element_Array) return Unsigned_64;
+
+      function XXH64
+        (Data : Element_Array;
+         Seed : Unsigned_64) return Unsigned_64;
+
+   end Generic_Hashes;
+
+   package body Generic_Hashes is
+
+      function Byte (E : Element) return Unsigned_64 is
+        (Unsigned_64 (Element'Pos (E)));
+
+      --  The 4 or 8 elements from Data'First + Offset, little-endian.
+      --  GCC merges the ors into one load
+      function Read_32 (Data : Element_Array; Offset : Natural)
+         return Unsigned_64
+      with Pre => Offset <= Data'Length and then Data'Length - Offset >= 4
+      is
+         J : constant Positive := Data'First + Offset;
+      begin
+         return Byte (Data (J))
+                or Shift_Left (Byte (Data (J + 1)), 8)
+                or Shift_Left (Byte (Data (J + 2)), 16)
+                or Shift_Left (Byte (Data (J + 3)), 24);
+      end Read_32;
+
+      function Read_64 (Data : Element_Array; Offset : Natural)
+         return Unsigned_64
+      with Pre => Offset <= Data'Length and then Data'Length - Offset >= 8
+      is
+      begin
+         return Read_32 (Data, Offset)
+                or Shift_Left (Read_32 (Data, Offset + 4), 32);
+      end Read_64;
+
+      ------------
+      -- FNV_1a --
+      ------------
+
+      function FNV_1a (Data : Element_Array) return Unsigned_64 is
+         H : Unsigned_64 := FNV_Offset;
+      begin
+         for I in Data'Range loop
+            H := (H xor Byte (Data (I))) * FNV_Prime;
+         end loop;
+         return H;
+      end FNV_1a;
+
+      -----------
+      -- XXH64 --
+      -----------
+
+      function XXH64
+        (Data : Element_Array;
+         Seed : Unsigned_64) return Unsigned_64
+      is
+         N      : constant Natural := Data'Length;
+         Offset : Natural := 0;
+         H      : Unsigned_64;
+
+         V1, V2, V3, V4 : Unsigned_64;
+      begin
+         if N >= 32 then
+            V1 := Seed + P1 + P2;
+            V2 := Seed + P2;
+            V3 := Seed;
+            V4 := Seed - P1;
+
+            --  The four lanes do not depend on each other: their
+            --  multiplies overlap in the pipeline
+            while N - Offset >= 32 loop
+               pragma Loop_Invariant (Offset <= N);
+               pragma Loop_Variant (Increases => Offset);
+               V1 := Round (V1, Read_64 (Data, Offset));
+               V2 := Round (V2, Read_64 (Data, Offset + 8));
+               V3 := Round (V3, Read_64 (Data, Offset + 16));
+               V4 := Round (V4, Read_64 (Data, Offset + 24));
+               Offset := Offset + 32;
+            end loop;
+
+            H := Rotate_Left (V1, 1) + Rotate_Left (V2, 7)
+                 + Rotate_Left (V3, 12) + Rotate_Left (V4, 18);
+            H := Merge (H, V1);
+            H := Merge (H, V2);
+            H := Merge (H, V3);
+            H := Merge (H, V4);
+         else
+            H := Seed + P5;
+         end if;
+         H := H + Unsigned_64 (N);
+
+         while N - Offset >= 8 loop
+            pragma Loop_Invariant (Offset <= N);
+            pragma Loop_Variant (Increases => Offset);
+            H := H xor Round (0, Read_64 (Data, Offset));
+            H := Rotate_Left (H, 27) * P1 + P4;
+            Offset := Offset + 8;
+         end loop;
+
+         if N - Offset >= 4 then
+            H := H xor Read_32 (Data, Offset) * P1;
+            H := Rotate_Left (H, 23) * P2 + P3;
+            Offset := Offset + 4;
+         end if;
+
+         while Offset < N loop
+            pragma Loop_Variant (Increases => Offset);
+            H := H xor Byte (Data (Data'First + Offset)) * P5;
+            H := Rotate_Left (H, 11) * P1;
+            Offset := Offset + 1;
+         end loop;
+
+         --  Avalanche: every input bit reaches every output bit
+         H := (H xor Shift_Right (H, 33)) * P2;
+         H := (H xor Shift_Right (H, 29)) * P3;
+         return H xor Shift_Right (H, 32);
+      end XXH64;
+
+   end Generic_Hashes;
+
+   package Byte_Hashes is new Generic_Hashes (Unsigned_8, Buffer_Array);
+   package String_Hashes is new Generic_Hashes (Character, String);
+
+   function FNV_1a (Data : Buffer_Array) return Unsigned_64 is
+     (Byte_Hashes.FNV_1a (Data));
+
+   function FNV_1a (S : String) return Unsigned_64 is
+     (String_Hashes.FNV_1a (S));
+
+   function XXH64
+     (Data : Buffer_Array;
+      Seed : Unsigned_64 := 0) return Unsigned_64
+   is
+     (Byte_Hashes.XXH64 (Data, Seed));
+
+   function XXH64
+     (S    : String;
+      Seed : Unsigned_64 := 0) return Unsigned_64
+   is
+     (String_Hashes.XXH64 (S, Seed));
+
+end Hashes;
@@ -0,0 +1,92 @@
+/*
+ * Batch division: quotient and remainder arrays in one pass
+ * Float-reciprocal estimate with an integer correction step, so the
+ * loop has no divide instruction and vectorises
+ */
+
+#ifndef BATCH_DIV_MOD_H
+#define BATCH_DIV_MOD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Baseline: what callers of divide_with_remainder do today.
+static inline void div_mod_loop(const int32_t *dividends, int32_t divisor,
+                                int32_t *quotients, int32_t *remainders,
+                                size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        quotients[i]  = dividends[i] / divisor;
+        remainders[i] = dividends[i] % divisor;
+    }
+}
+
+// Truncating n * recip is exact except when n / d is itself an integer and
+// the product lands just short of it; then the remainder equals +d or -d.
+// One compare in each direction repairs that case.
+static inline int32_t div_estimate(int32_t n, int32_t d, double recip,
+                                   int32_t *remainder) {
+    int64_t q = (int64_t)((double)n * recip);
+    int64_t r = (int64_t)n - q * d;
+    int64_t fix = (int64_t)(r == d) - (int64_t)(r == -(int64_t)d);
+
+    *remainder = (int32_t)(r - fix * d);
+    return (int32_t)(q + fix);
+}
+
+// One divisor for the whole column.
+// ⚠️ divisor == 0 or INT32_MIN / -1 are undefined, as with `/`.
+static inline void div_mod_scalar(const int32_t *dividends, int32_t divisor,
+                                  int32_t *quotients, int32_t *remainders,
+                                  size_t count) {
+    const double recip = 1.0 / (double)divisor;
+
+    for (size_t i = 0; i < count; i++) {
+        quotients[i] = div_estimate(dividends[i], divisor, recip, &remainders[i]);
+    }
+}
+
+// A divisor per element: the reciprocal becomes a vector divide, which is
+// still far cheaper than a scalar integer divide per element.
+static inline void div_mod_each(const int32_t *dividends, const int32_t *divisors,
+                                int32_t *quotients, int32_t *remainders,
+                                size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        quotients[i] = div_estimate(dividends[i], divisors[i],
+                                    1.0 / (double)divisors[i], &remainders[i]);
+    }
+}
+
+#ifdef __AVX2__
+// Explicit AVX2 version of div_mod_scalar: four lanes per step.
+// cvttpd truncates like the C cast; the fix-up uses lane masks.
+static inline void div_mod_scalar_avx2(const int32_t *dividends, int32_t divisor,
+                                       int32_t *quotients, int32_t *remainders,
+                                       size_t count) {
+    const __m256d recip = _mm256_set1_pd(1.0 / (double)divisor);
+    const __m128i d     = _mm_set1_epi32(divisor);
+    const __m128i neg_d = _mm_sub_epi32(_mm_setzero_si128(), d);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i n = _mm_loadu_si128((const __m128i *)&dividends[i]);
+        __m128i q = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(n), recip));
+        __m128i r = _mm_sub_epi32(n, _mm_mullo_epi32(q, d));
+
+        // Compare masks are -1 where true: q - mask_pos + mask_neg
+        __m128i up   = _mm_cmpeq_epi32(r, d);
+        __m128i down = _mm_andnot_si128(up, _mm_cmpeq_epi32(r, neg_d));
+        q = _mm_add_epi32(_mm_sub_epi32(q, up), down);
+        r = _mm_sub_epi32(n, _mm_mullo_epi32(q, d));
+
+        _mm_storeu_si128((__m128i *)&quotients[i], q);
+        _mm_storeu_si128((__m128i *)&remainders[i], r);
+    }
+    div_mod_scalar(dividends + i, divisor, quotients + i, remainders + i, count - i);
+}
+#endif
+
+#endif
@@ -0,0 +1,213 @@
+package body Batch_Division is
+
+   subtype Wide is Long_Long_Integer;
+
+   function Clamp (X : Wide) return Integer is
+     (Integer (Wide'Max (Wide (Integer'First),
+                         Wide'Min (X, Wide (Integer'Last)))));
+
+   --  Truncating division is unique: any pair passing Is_Div_Mod is the
+   --  pair that "/" and "rem" produce
+   procedure Lemma_Unique (Dividend, Divisor, Quotient, Remainder : Integer)
+      with Ghost,
+           Pre  => Divisor /= 0
+                   and then not (Dividend = Integer'First and Divisor = -1)
+                   and then Is_Div_Mod (Dividend, Divisor, Quotient, Remainder),
+           Post => Quotient = Dividend / Divisor
+               and Remainder = Dividend rem Divisor
+   is
+      Q : constant Wide := Wide (Dividend) / Wide (Divisor);
+      R : constant Wide := Wide (Dividend) rem Wide (Divisor);
+   begin
+      --  Both remainders have the sign of Dividend and are below |Divisor|,
+      --  so their difference (Q - Quotient) * Divisor is too
+      pragma Assert (Q * Wide (Divisor) + R = Wide (Dividend));
+      pragma Assert ((Q - Wide (Quotient)) * Wide (Divisor)
+                     = Wide (Remainder) - R);
+      pragma Assert (abs (Wide (Remainder) - R) < abs (Wide (Divisor)));
+      pragma Assert (Q = Wide (Quotient));
+   end Lemma_Unique;
+
+   procedure Lemma_Unique_Scalar
+      (Dividends  : Integer_Array;
+       Divisor    : Integer;
+       Quotients  : Integer_Array;
+       Remainders : Integer_Array)
+      with Ghost,
+           Pre  => Divisor /= 0
+                   and then Quotients'First = Dividends'First
+                   and then Quotients'Last = Dividends'Last
+                   and then Remainders'First = Dividends'First
+                   and then Remainders'Last = Dividends'Last
+                   and then (for all I in Dividends'Range =>
+                               not (Dividends (I) = Integer'First
+                                    and Divisor = -1)
+                               and then Is_Div_Mod (Dividends (I), Divisor,
+                                                    Quotients (I),
+                                                    Remainders (I))),
+           Post => (for all I in Dividends'Range =>
+                      Quotients (I) = Dividends (I) / Divisor
+                      and Remainders (I) = Dividends (I) rem Divisor)
+   is
+   begin
+      for I in Dividends'Range loop
+         Lemma_Unique (Dividends (I), Divisor, Quotients (I), Remainders (I));
+         pragma Loop_Invariant
+            (for all J in Dividends'First .. I =>
+               Quotients (J) = Dividends (J) / Divisor
+               and Remainders (J) = Dividends (J) rem Divisor);
+      end loop;
+   end Lemma_Unique_Scalar;
+
+   procedure Lemma_Unique_Each
+      (Dividends  : Integer_Array;
+       Divisors   : Integer_Array;
+       Quotients  : Integer_Array;
+       Remainders : Integer_Array)
+      with Ghost,
+           Pre  => Divisors'First = Dividends'First
+                   and then Divisors'Last = Dividends'Last
+                   and then Quotients'First = Dividends'First
+                   and then Quotients'Last = Dividends'Last
+                   and then Remainders'First = Dividends'First
+                   and then Remainders'Last = Dividends'Last
+                   and then (for all I in Dividends'Range =>
+                               Divisors (I) /= 0
+                               and then not (Dividends (I) = Integer'First
+                                             and Divisors (I) = -1)
+                               and then Is_Div_Mod (Dividends (I), Divisors (I),
+                                                    Quotients (I),
+                                                    Remainders (I))),
+           Post => (for all I in Dividends'Range =>
+                      Quotients (I) = Dividends (I) / Divisors (I)
+                      and Remainders (I) = Dividends (I) rem Divisors (I))
+   is
+   begin
+      for I in Dividends'Range loop
+         Lemma_Unique (Dividends (I), Divisors (I),
+                       Quotients (I), Remainders (I));
+         pragma Loop_Invariant
+            (for all J in Dividends'First .. I =>
+               Quotients (J) = Dividends (J) / Divisors (J)
+               and Remainders (J) = Dividends (J) rem Divisors (J));
+      end loop;
+   end Lemma_Unique_Each;
+
+   --  Truncated float estimate, then one correction step: the product can
+   --  only fall short when the quotient is exact, which leaves a remainder
+   --  of +Divisor or -Divisor. No divide instruction, so loops calling this
+   --  vectorise. Exactness is not assumed here; callers check Is_Div_Mod
+   procedure Estimate
+      (Dividend  : Integer;
+       Divisor   : Integer;
+       Recip     : Long_Float;
+       Quotient  : out Integer;
+       Remainder : out Integer)
+      with Inline,
+           Pre => Divisor /= 0 and then Recip in -1.0 .. 1.0
+   is
+      Q : Wide := Wide (Clamp (Wide (Long_Float'Truncation
+                                       (Long_Float (Dividend) * Recip))));
+      R : Wide := Wide (Dividend) - Q * Wide (Divisor);
+   begin
+      if R = Wide (Divisor) then
+         Q := Q + 1;
+      elsif R = -Wide (Divisor) then
+         Q := Q - 1;
+      end if;
+      Quotient  := Clamp (Q);
+      R         := Wide (Dividend) - Wide (Quotient) * Wide (Divisor);
+      Remainder := Clamp (R);
+   end Estimate;
+
+   procedure Div_Mod_Scalar
+      (Dividends  : Integer_Array;
+       Divisor    : Integer;
+       Quotients  : in out Integer_Array;
+       Remainders : in out Integer_Array)
+   is
+      Recip  : constant Long_Float := 1.0 / Long_Float (Divisor);
+      All_Ok : Boolean := True;
+   begin
+      --  Pass 1: estimates, vectorisable
+      for I in Dividends'Range loop
+         Estimate (Dividends (I), Divisor, Recip,
+                   Quotients (I), Remainders (I));
+      end loop;
+
+      --  Pass 2: integer check of every estimate, a branch-free reduction
+      for I in Dividends'Range loop
+         All_Ok := All_Ok
+            and Is_Div_Mod (Dividends (I), Divisor,
+                            Quotients (I), Remainders (I));
+         pragma Loop_Invariant
+            (All_Ok = (for all J in Dividends'First .. I =>
+                         Is_Div_Mod (Dividends (J), Divisor,
+                                     Quotients (J), Remainders (J))));
+      end loop;
+
+      --  Pass 3: the error analysis in NOTES.md says this never runs, but
+      --  the proof does not depend on float rounding
+      if not All_Ok then
+         for I in Dividends'Range loop
+            if not Is_Div_Mod (Dividends (I), Divisor,
+                               Quotients (I), Remainders (I))
+            then
+               Quotients (I)  := Dividends (I) / Divisor;
+               Remainders (I) := Dividends (I) rem Divisor;
+            end if;
+            pragma Loop_Invariant
+               (for all J in Dividends'First .. I =>
+                  Is_Div_Mod (Dividends (J), Divisor,
+                              Quotients (J), Remainders (J)));
+         end loop;
+      end if;
+
+      Lemma_Unique_Scalar (Dividends, Divisor, Quotients, Remainders);
+   end Div_Mod_Scalar;
+
+   procedure Div_Mod_Each
+      (Dividends  : Integer_Array;
+       Divisors   : Integer_Array;
+       Quotients  : in out Integer_Array;
+       Remainders : in out Integer_Array)
+   is
+      All_Ok : Boolean := True;
+   begin
+      --  Pass 1: the reciprocal becomes a vector divide, still far cheaper
+      --  than one scalar integer divide per element
+      for I in Dividends'Range loop
+         Estimate (Dividends (I), Divisors (I),
+                   1.0 / Long_Float (Divisors (I)),
+                   Quotients (I), Remainders (I));
+      end loop;
+
+      for I in Dividends'Range loop
+         All_Ok := All_Ok
+            and Is_Div_Mod (Dividends (I), Divisors (I),
+                            Quotients (I), Remainders (I));
+         pragma Loop_Invariant
+            (All_Ok = (for all J in Dividends'First .. I =>
+                         Is_Div_Mod (Dividends (J), Divisors (J),
+                                     Quotients (J), Remainders (J))));
+      end loop;
+
+      if not All_Ok then
+         for I in Dividends'Range loop
+            if not Is_Div_Mod (Dividends (I), Divisors (I),
+                               Quotients (I), Remainders (I))
+            then
+               Quotients (I)  := Dividends (I) / Divisors (I);
+               Remainders (I) := Dividends (I) rem Divisors (I);
+            end if;
+            pragma Loop_Invariant
+               (for all J in Dividends'First .. I =>
+                  Is_Div_Mod (Dividends (J), Divisors (J),
+                              Quotients (J), Remainders (J)));
+         end loop;
+      end if;
+
+      Lemma_Unique_Each (Dividends, Divisors, Quotients, Remainders);
+   end Div_Mod_Each;
+
+end Batch_Division;
@@ -0,0 +1,97 @@
+/*
+ * Benchmark: scalar / and % loop vs float-reciprocal batch kernels
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "batch_div_mod.h"
+
+#define COUNT  1000000
+#define ROUNDS 50
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void report(const char *name, double start) {
+    printf("%-24s: %.3f ns/element\n", name,
+           (now_ns() - start) / ((double)COUNT * ROUNDS));
+}
+
+// Baseline for the per-element divisor case
+static void div_mod_each_loop(const int32_t *dividends, const int32_t *divisors,
+                              int32_t *quotients, int32_t *remainders) {
+    for (size_t i = 0; i < COUNT; i++) {
+        quotients[i]  = dividends[i] / divisors[i];
+        remainders[i] = dividends[i] % divisors[i];
+    }
+}
+
+int main(void) {
+    int32_t *dividends  = malloc(COUNT * sizeof(int32_t));
+    int32_t *divisors   = malloc(COUNT * sizeof(int32_t));
+    int32_t *quotients  = malloc(COUNT * sizeof(int32_t));
+    int32_t *remainders = malloc(COUNT * sizeof(int32_t));
+    if (!dividends || !divisors || !quotients || !remainders) {
+        return 1;
+    }
+
+    // Volatile so the compiler cannot fold the divisor into the loop
+    volatile int32_t runtime_divisor = 7;
+    int32_t divisor = runtime_divisor;
+
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < COUNT; i++) {
+        seed = seed * 1103515245u + 12345u;
+        dividends[i] = (int32_t)seed;
+        divisors[i] = (int32_t)((seed >> 16) % 1000) + 1;
+    }
+
+    long long checksum = 0;
+    double start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        div_mod_loop(dividends, divisor, quotients, remainders, COUNT);
+        checksum += quotients[r];
+    }
+    report("scalar / and %", start);
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        div_mod_scalar(dividends, divisor, quotients, remainders, COUNT);
+        checksum += quotients[r];
+    }
+    report("float reciprocal", start);
+
+#ifdef __AVX2__
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        div_mod_scalar_avx2(dividends, divisor, quotients, remainders, COUNT);
+        checksum += quotients[r];
+    }
+    report("float reciprocal (AVX2)", start);
+#endif
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        div_mod_each_loop(dividends, divisors, quotients, remainders);
+        checksum += quotients[r];
+    }
+    report("per-element / and %", start);
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        div_mod_each(dividends, divisors, quotients, remainders, COUNT);
+        checksum += quotients[r];
+    }
+    report("per-element reciprocal", start);
+
+    printf("checksum: %lld\n", checksum);
+    free(dividends);
+    free(divisors);
+    free(quotients);
+    free(remainders);
+    return 0;
+}
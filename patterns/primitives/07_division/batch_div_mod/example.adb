@@ -0,0 +1,33 @@
+--  Batch division over arrays
+--  Quotient and remainder columns without a divide instruction per element
+
+with Ada.Text_IO;    use Ada.Text_IO;
+with Batch_Division; use Batch_Division;
+
+procedure Example is
+
+   Dividends  : constant Integer_Array :=
+      (17, -17, 0, 49, Integer'First, Integer'Last);
+   Divisors   : constant Integer_Array (Dividends'Range) :=
+      (5, 5, 3, 7, 2, -1);
+   Quotients  : Integer_Array (Dividends'Range) := (others => 0);
+   Remainders : Integer_Array (Dividends'Range) := (others => 0);
+
+begin
+   --  One divisor for the whole column
+   Div_Mod_Scalar (Dividends, 7, Quotients, Remainders);
+   for I in Dividends'Range loop
+      Put_Line (Integer'Image (Dividends (I)) & " / 7 = " &
+                Integer'Image (Quotients (I)) & " remainder " &
+                Integer'Image (Remainders (I)));
+   end loop;
+
+   --  A divisor per element
+   Div_Mod_Each (Dividends, Divisors, Quotients, Remainders);
+   for I in Dividends'Range loop
+      Put_Line (Integer'Image (Dividends (I)) & " /" &
+                Integer'Image (Divisors (I)) & " = " &
+                Integer'Image (Quotients (I)) & " remainder " &
+                Integer'Image (Remainders (I)));
+   end loop;
+end Example;
@@ -0,0 +1,31 @@
+/*
+ * Batch division over arrays
+ * Quotient and remainder columns without a divide instruction per element
+ */
+
+#include <stdio.h>
+#include <limits.h>
+#include "batch_div_mod.h"
+
+int main(void) {
+    int32_t dividends[] = {17, -17, 0, 49, INT_MIN, INT_MAX};
+    int32_t divisors[]  = {5, 5, 3, 7, 2, -1};
+    int count = sizeof(dividends) / sizeof(dividends[0]);
+    int32_t quotients[6], remainders[6];
+
+    // One divisor for the whole column
+    div_mod_scalar(dividends, 7, quotients, remainders, count);
+    for (int i = 0; i < count; i++) {
+        printf("%d / 7 = %d remainder %d\n",
+               dividends[i], quotients[i], remainders[i]);
+    }
+
+    // A divisor per element
+    div_mod_each(dividends, divisors, quotients, remainders, count);
+    for (int i = 0; i < count; i++) {
+        printf("%d / %d = %d remainder %d\n",
+               dividends[i], divisors[i], quotients[i], remainders[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Benchmark: hardware / and % vs precomputed divider
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "divider.h"
+
+#define COUNT  1000000
+#define ROUNDS 50
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void hardware_loop(const int32_t *dividends, int32_t *quotients,
+                          int32_t *remainders, int32_t divisor) {
+    for (size_t i = 0; i < COUNT; i++) {
+        quotients[i]  = dividends[i] / divisor;
+        remainders[i] = dividends[i] % divisor;
+    }
+}
+
+int main(void) {
+    int32_t *dividends  = malloc(COUNT * sizeof(int32_t));
+    int32_t *quotients  = malloc(COUNT * sizeof(int32_t));
+    int32_t *remainders = malloc(COUNT * sizeof(int32_t));
+    if (!dividends || !quotients || !remainders) {
+        return 1;
+    }
+
+    // Volatile so the compiler cannot fold the divisor into the loop
+    volatile int32_t runtime_divisor = 7;
+    int32_t divisor = runtime_divisor;
+    divider d = divider_make(divisor);
+
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < COUNT; i++) {
+        seed = seed * 1103515245u + 12345u;
+        dividends[i] = (int32_t)seed;
+    }
+
+    long long checksum = 0;
+    double start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        hardware_loop(dividends, quotients, remainders, divisor);
+        checksum += quotients[r];
+    }
+    printf("hardware / and %%     : %.3f ns/element\n",
+           (now_ns() - start) / ((double)COUNT * ROUNDS));
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        divider_div_mod_all(&d, dividends, quotients, remainders, COUNT);
+        checksum += quotients[r];
+    }
+    printf("precomputed divider  : %.3f ns/element\n",
+           (now_ns() - start) / ((double)COUNT * ROUNDS));
+
+    printf("checksum: %lld\n", checksum);
+    free(dividends);
+    free(quotients);
+    free(remainders);
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Precomputed divider: division by a runtime-constant divisor
+ * Replaces the 20-90 cycle hardware divide with multiply + shift
+ */
+
+#ifndef DIVIDER_H
+#define DIVIDER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+    int32_t  divisor;
+    uint64_t magnitude;  // |divisor|, 1 .. 2^31
+    uint64_t magic;      // ceil(2^shift / magnitude), at most 2^32
+    unsigned shift;      // 31 + ceil(log2(magnitude))
+} divider;
+
+// Compute the magic multiplier and shift once per divisor.
+// ⚠️ divisor == 0 is undefined behaviour, just like `x / 0`.
+static inline divider divider_make(int32_t divisor) {
+    divider d;
+    unsigned s = 0;
+
+    d.divisor = divisor;
+    d.magnitude = divisor < 0 ? (uint64_t)0 - (uint64_t)(int64_t)divisor
+                              : (uint64_t)divisor;
+    while (((uint64_t)1 << s) < d.magnitude) {
+        s++;
+    }
+    d.shift = 31 + s;
+    d.magic = (((uint64_t)1 << d.shift) + d.magnitude - 1) / d.magnitude;
+    return d;
+}
+
+// Truncating quotient of a magnitude, shared by the scalar and batch paths.
+// |dividend| <= 2^31 and magic <= 2^32, so the product fits in 64 bits.
+// The sign is applied branch-free: mask is all ones when the signs differ.
+static inline int32_t divider_apply(uint64_t magic, unsigned shift,
+                                    int32_t divisor, int32_t dividend) {
+    uint64_t n = dividend < 0 ? (uint64_t)0 - (uint64_t)(int64_t)dividend
+                              : (uint64_t)dividend;
+    uint32_t q = (uint32_t)((n * magic) >> shift);
+    uint32_t mask = (uint32_t)((dividend ^ divisor) >> 31);
+    return (int32_t)((q ^ mask) - mask);
+}
+
+// Same result as `dividend / divisor`.
+// ⚠️ INT32_MIN / -1 overflows, exactly as the hardware divide does.
+static inline int32_t divider_div(const divider *d, int32_t dividend) {
+    return divider_apply(d->magic, d->shift, d->divisor, dividend);
+}
+
+// Remainder with the sign of the dividend, same result as `%`.
+static inline int32_t divider_rem(const divider *d, int32_t dividend) {
+    int32_t q = divider_div(d, dividend);
+    return (int32_t)((uint32_t)dividend - (uint32_t)q * (uint32_t)d->divisor);
+}
+
+// Batch kernel: one divisor, many dividends.
+// Constants are hoisted into locals so they stay in registers.
+static inline void divider_div_mod_all(const divider *d, const int32_t *dividends,
+                                       int32_t *quotients, int32_t *remainders,
+                                       size_t count) {
+    const uint64_t magic = d->magic;
+    const unsigned shift = d->shift;
+    const int32_t divisor = d->divisor;
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t q = divider_apply(magic, shift, divisor, dividends[i]);
+        quotients[i]  = q;
+        remainders[i] = (int32_t)((uint32_t)dividends[i]
+                                  - (uint32_t)q * (uint32_t)divisor);
+    }
+}
+
+#endif
@@ -0,0 +1,118 @@
+package body Dividers is
+
+   subtype Wide is Long_Long_Long_Integer;
+
+   --  Ceiling division by Magnitude never reaches 2**32: Shift is chosen as
+   --  31 + Log with 2**(Log - 1) < Magnitude <= 2**Log
+   procedure Lemma_Magic_Bound (M : Magnitude_Type; Log : Natural)
+      with Ghost,
+           Pre  => Log <= 31
+                   and then M <= 2 ** Log
+                   and then (Log = 0 or else 2 ** (Log - 1) < M),
+           Post => (2 ** (31 + Log) + M - 1) / M < 2 ** 32
+   is
+      Num : constant Wide := 2 ** (31 + Log) + Wide (M) - 1;
+   begin
+      if Log = 0 then
+         pragma Assert (M = 1);
+         pragma Assert (Num = 2 ** 31);
+      else
+         pragma Assert (Wide (2) ** (31 + Log) = 2 ** 32 * Wide (2) ** (Log - 1));
+         pragma Assert (Wide (2) ** (Log - 1) + 1 <= Wide (M));
+         pragma Assert (Num < 2 ** 32 * Wide (M));
+      end if;
+      pragma Assert (Num / Wide (M) < 2 ** 32);
+   end Lemma_Magic_Bound;
+
+   --  Core argument: with N <= 2**31 the error term E * N stays below
+   --  2**Shift, so it can never carry the product past the next multiple
+   procedure Lemma_Magic_Quotient
+      (N     : Long_Long_Integer;
+       M     : Magnitude_Type;
+       Magic : Magic_Type;
+       Shift : Shift_Type)
+      with Ghost,
+           Pre  => N in 0 .. 2 ** 31
+                   and then M <= 2 ** (Shift - 31)
+                   and then Magic * M >= 2 ** Shift
+                   and then Magic * M - 2 ** Shift < M,
+           Post => (N * Magic) / 2 ** Shift = N / M
+   is
+      K : constant Wide := 2 ** Shift;
+      E : constant Wide := Wide (Magic) * Wide (M) - K;
+      Q : constant Wide := Wide (N) / Wide (M);
+      R : constant Wide := Wide (N) - Q * Wide (M);
+      P : constant Wide := Wide (N) * Wide (Magic);
+   begin
+      pragma Assert (R in 0 .. Wide (M) - 1);
+      pragma Assert (Wide (2) ** (Shift - 31) * 2 ** 31 = K);
+      pragma Assert (E * Wide (N) < K);
+      --  P * M = N * (K + E) = (Q * M + R) * K + E * N
+      pragma Assert (P * Wide (M) = (Q * Wide (M) + R) * K + E * Wide (N));
+      --  hence Q * K <= P < (Q + 1) * K
+      pragma Assert (P >= Q * K);
+      pragma Assert (P < (Q + 1) * K);
+      pragma Assert (P / K = Q);
+   end Lemma_Magic_Quotient;
+
+   function Make_Divider (Divisor : Integer) return Divider is
+      M   : constant Magnitude_Type := abs (Long_Long_Integer (Divisor));
+      Log : Natural := 0;
+   begin
+      --  Smallest Log with M <= 2**Log
+      while Long_Long_Integer (2) ** Log < M loop
+         pragma Loop_Invariant (Log < 31);
+         pragma Loop_Invariant (Long_Long_Integer (2) ** Log < M);
+         pragma Loop_Variant (Increases => Log);
+         Log := Log + 1;
+      end loop;
+
+      Lemma_Magic_Bound (M, Log);
+
+      return (Divisor   => Divisor,
+              Magnitude => M,
+              Magic     => (2 ** (31 + Log) + M - 1) / M,
+              Shift     => 31 + Log);
+   end Make_Divider;
+
+   function Quotient (D : Divider; Dividend : Integer) return Integer is
+      N : constant Long_Long_Integer := abs (Long_Long_Integer (Dividend));
+      Q : Long_Long_Integer;
+   begin
+      Lemma_Magic_Quotient (N, D.Magnitude, D.Magic, D.Shift);
+
+      --  Division by a power of two: GNAT emits a shift
+      Q := (N * D.Magic) / 2 ** D.Shift;
+      pragma Assert (Q = N / D.Magnitude);
+
+      if (Dividend < 0) = (D.Divisor < 0) then
+         return Integer (Q);
+      else
+         return Integer (-Q);
+      end if;
+   end Quotient;
+
+   function Remainder (D : Divider; Dividend : Integer) return Integer is
+   begin
+      --  Ada defines rem as A - (A / B) * B
+      return Dividend - Quotient (D, Dividend) * D.Divisor;
+   end Remainder;
+
+   procedure Div_Mod_All
+      (D          : Divider;
+       Dividends  : Integer_Array;
+       Quotients  : in out Integer_Array;
+       Remainders : in out Integer_Array)
+   is
+   begin
+      for I in Dividends'Range loop
+         Quotients (I)  := Quotient (D, Dividends (I));
+         Remainders (I) := Dividends (I) - Quotients (I) * D.Divisor;
+         pragma Loop_Invariant
+            (for all J in Dividends'First .. I =>
+               Quotients (J) = Dividends (J) / Divisor_Of (D)
+               and Remainders (J) = Dividends (J) rem Divisor_Of (D));
+      end loop;
+   end Div_Mod_All;
+
+end Dividers;
@@ -0,0 +1,31 @@
+--  Division by a runtime-constant divisor
+--  Demonstrates a precomputed divider replacing hardware division
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Dividers;    use Dividers;
+
+procedure Example is
+
+   By_Five   : constant Divider := Make_Divider (5);
+   By_Minus7 : constant Divider := Make_Divider (-7);
+
+   Values     : constant Integer_Array :=
+      (17, -17, 0, 4, Integer'First, Integer'Last);
+   Quotients  : Integer_Array (Values'Range) := (others => 0);
+   Remainders : Integer_Array (Values'Range) := (others => 0);
+
+begin
+   --  Single division, same contract as Div_Mod
+   Put_Line ("17 / 5 = " & Integer'Image (Quotient (By_Five, 17)) &
+             " remainder " & Integer'Image (Remainder (By_Five, 17)));
+   Put_Line ("17 / -7 = " & Integer'Image (Quotient (By_Minus7, 17)) &
+             " remainder " & Integer'Image (Remainder (By_Minus7, 17)));
+
+   --  Batch kernel: one divisor, a whole column of dividends
+   Div_Mod_All (By_Minus7, Values, Quotients, Remainders);
+   for I in Values'Range loop
+      Put_Line (Integer'Image (Values (I)) & " / -7 = " &
+                Integer'Image (Quotients (I)) & " remainder " &
+                Integer'Image (Remainders (I)));
+   end loop;
+end Example;
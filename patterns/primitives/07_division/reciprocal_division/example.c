@@ -0,0 +1,32 @@
+/*
+ * Division by a runtime-constant divisor
+ * Demonstrates a precomputed divider replacing hardware division
+ */
+
+#include <stdio.h>
+#include <limits.h>
+#include "divider.h"
+
+int main(void) {
+    divider by_five = divider_make(5);
+    divider by_minus7 = divider_make(-7);
+
+    // Single division, same results as div_mod
+    printf("17 / 5 = %d remainder %d\n",
+           divider_div(&by_five, 17), divider_rem(&by_five, 17));
+    printf("17 / -7 = %d remainder %d\n",
+           divider_div(&by_minus7, 17), divider_rem(&by_minus7, 17));
+
+    // Batch kernel: one divisor, a whole column of dividends
+    int32_t values[] = {17, -17, 0, 4, INT_MIN, INT_MAX};
+    int count = sizeof(values) / sizeof(values[0]);
+    int32_t quotients[6], remainders[6];
+
+    divider_div_mod_all(&by_minus7, values, quotients, remainders, count);
+    for (int i = 0; i < count; i++) {
+        printf("%d / -7 = %d remainder %d\n",
+               values[i], quotients[i], remainders[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+--  Benchmark: Bitsets against an array of Boolean, one byte per bit, on
+--  the same data as bench.c
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Bitsets;       use Bitsets;
+
+procedure Bench is
+
+   Bits   : constant := 2 ** 24;
+   Passes : constant := 20;
+   Probes : constant := 1_000_000;
+
+   type Bool_Array is array (0 .. Bits - 1) of Boolean;
+   type Probe_Array is array (1 .. Probes) of Natural;
+
+   type Bitset_Access is access Bitset;
+   type Bool_Access is access Bool_Array;
+   type Probe_Access is access Probe_Array;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   ------------
+   -- Bitset --
+   ------------
+
+   function Test_Bitset (A : Bitset; At_Bit : Probe_Array) return Natural is
+      Hits : Natural := 0;
+   begin
+      for I in At_Bit'Range loop
+         Hits := Hits + Boolean'Pos (Test (A, At_Bit (I)));
+      end loop;
+      return Hits;
+   end Test_Bitset;
+   pragma Machine_Attribute (Test_Bitset, "noipa");
+
+   procedure Set_Bitset (A : in out Bitset; At_Bit : Probe_Array) is
+   begin
+      for I in At_Bit'Range loop
+         Set (A, At_Bit (I));
+      end loop;
+   end Set_Bitset;
+   pragma Machine_Attribute (Set_Bitset, "noipa");
+
+   function Count_Bitset (A : Bitset) return Natural is (Count (A));
+   pragma Machine_Attribute (Count_Bitset, "noipa");
+
+   procedure Union_Bitset (A : in out Bitset; B : Bitset) is
+   begin
+      Union (A, B);
+   end Union_Bitset;
+   pragma Machine_Attribute (Union_Bitset, "noipa");
+
+   procedure Difference_Bitset (A : in out Bitset; B : Bitset) is
+   begin
+      Difference (A, B);
+   end Difference_Bitset;
+   pragma Machine_Attribute (Difference_Bitset, "noipa");
+
+   procedure Intersect_Bitset (A : in out Bitset; B : Bitset) is
+   begin
+      Intersect (A, B);
+   end Intersect_Bitset;
+   pragma Machine_Attribute (Intersect_Bitset, "noipa");
+
+   ----------------------
+   -- Array of Boolean --
+   ----------------------
+
+   function Test_Bool (A : Bool_Array; At_Bit : Probe_Array) return Natural
+   is
+      Hits : Natural := 0;
+   begin
+      for I in At_Bit'Range loop
+         Hits := Hits + Boolean'Pos (A (At_Bit (I)));
+      end loop;
+      return Hits;
+   end Test_Bool;
+   pragma Machine_Attribute (Test_Bool, "noipa");
+
+   procedure Set_Bool (A : in out Bool_Array; At_Bit : Probe_Array) is
+   begin
+      for I in At_Bit'Range loop
+         A (At_Bit (I)) := True;
+      end loop;
+   end Set_Bool;
+   pragma Machine_Attribute (Set_Bool, "noipa");
+
+   function Count_Bool (A : Bool_Array) return Natural is
+      Count : Natural := 0;
+   begin
+      for I in A'Range loop
+         Count := Count + Boolean'Pos (A (I));
+      end loop;
+      return Count;
+   end Count_Bool;
+   pragma Machine_Attribute (Count_Bool, "noipa");
+
+   procedure Union_Bool (A : in out Bool_Array; B : Bool_Array) is
+   begin
+      for I in A'Range loop
+         A (I) := A (I) or B (I);
+      end loop;
+   end Union_Bool;
+   pragma Machine_Attribute (Union_Bool, "noipa");
+
+   procedure Difference_Bool (A : in out Bool_Array; B : Bool_Array) is
+   begin
+      for I in A'Range loop
+         A (I) := A (I) and not B (I);
+      end loop;
+   end Difference_Bool;
+   pragma Machine_Attribute (Difference_Bool, "noipa");
+
+   procedure Intersect_Bool (A : in out Bool_Array; B : Bool_Array) is
+   begin
+      for I in A'Range loop
+         A (I) := A (I) and B (I);
+      end loop;
+   end Intersect_Bool;
+   pragma Machine_Attribute (Intersect_Bool, "noipa");
+
+   A      : constant Bitset_Access := new Bitset (Word_Count => Bits / 64);
+   B      : constant Bitset_Access := new Bitset (Word_Count => Bits / 64);
+   X      : constant Bool_Access := new Bool_Array;
+   Y      : constant Bool_Access := new Bool_Array;
+   At_Bit : constant Probe_Access := new Probe_Array;
+
+   Check : Natural := 0;
+   Start : Time;
+
+   procedure Report (Label : String; Units : Positive; Unit : String) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Units * Passes)) &
+                " " & Unit);
+   end Report;
+
+begin
+   --  The same random bits in both representations, half of them set
+   for I in Bool_Array'Range loop
+      X (I) := (Next_Random and 1) = 1;
+      Y (I) := (Next_Random and 1) = 1;
+      if X (I) then
+         Set (A.all, I);
+      end if;
+      if Y (I) then
+         Set (B.all, I);
+      end if;
+   end loop;
+   for I in At_Bit'Range loop
+      At_Bit (I) := Natural (Next_Random mod Bits);
+   end loop;
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Test_Bitset (A.all, At_Bit.all);
+   end loop;
+   Report ("test, bitset             :", Probes, "ns/probe");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Test_Bool (X.all, At_Bit.all);
+   end loop;
+   Report ("test, Boolean array      :", Probes, "ns/probe");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Count_Bitset (A.all);
+   end loop;
+   Report ("count, bitset            :", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Count_Bool (X.all);
+   end loop;
+   Report ("count, Boolean array     :", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Union_Bitset (A.all, B.all);
+   end loop;
+   Report ("union, bitset            :", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Union_Bool (X.all, Y.all);
+   end loop;
+   Report ("union, Boolean array     :", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Difference_Bitset (A.all, B.all);
+   end loop;
+   Report ("difference, bitset       :", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Difference_Bool (X.all, Y.all);
+   end loop;
+   Report ("difference, Boolean array:", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Set_Bitset (A.all, At_Bit.all);
+   end loop;
+   Report ("set, bitset              :", Probes, "ns/probe");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Set_Bool (X.all, At_Bit.all);
+   end loop;
+   Report ("set, Boolean array       :", Probes, "ns/probe");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Intersect_Bitset (A.all, B.all);
+   end loop;
+   Report ("intersect, bitset        :", Bits / 1024, "ns/Kbit");
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Intersect_Bool (X.all, Y.all);
+   end loop;
+   Report ("intersect, Boolean array :", Bits / 1024, "ns/Kbit");
+
+   --  Both representations went through the same operations
+   Put_Line ("counts:" & Natural'Image (Count (A.all)) & ","
+             & Natural'Image (Count_Bool (X.all))
+             & "  (check" & Natural'Image (Check) & ")");
+end Bench;
@@ -0,0 +1,219 @@
+/*
+ * Benchmark: bitset.h against an array of bool, one byte per bit
+ * - union, intersection, difference and count over 16M bits: 2 MB of
+ *   words against 16 MB of bytes
+ * - test and set at 1M random positions
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bitset.h"
+
+#define BITS    (1 << 24)
+#define WORDS   (BITS / 64)
+#define PASSES  20
+#define PROBES  1000000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- bitset ---- */
+
+__attribute__((noipa)) static void union_bitset(bitset *a, const bitset *b) {
+    bs_union(a, b);
+}
+
+__attribute__((noipa)) static void intersect_bitset(bitset *a,
+                                                    const bitset *b) {
+    bs_intersect(a, b);
+}
+
+__attribute__((noipa)) static void difference_bitset(bitset *a,
+                                                     const bitset *b) {
+    bs_difference(a, b);
+}
+
+__attribute__((noipa)) static size_t count_bitset(const bitset *a) {
+    return bs_count(a);
+}
+
+__attribute__((noipa)) static size_t test_bitset(const bitset *a,
+                                                 const uint32_t *at, int n) {
+    size_t hits = 0;
+    for (int i = 0; i < n; i++) {
+        hits += bs_test(a, at[i]);
+    }
+    return hits;
+}
+
+__attribute__((noipa)) static void set_bitset(bitset *a, const uint32_t *at,
+                                              int n) {
+    for (int i = 0; i < n; i++) {
+        bs_set(a, at[i]);
+    }
+}
+
+/* ---- array of bool ---- */
+
+__attribute__((noipa)) static void union_bool(bool *a, const bool *b) {
+    for (int i = 0; i < BITS; i++) {
+        a[i] = a[i] | b[i];
+    }
+}
+
+__attribute__((noipa)) static void intersect_bool(bool *a, const bool *b) {
+    for (int i = 0; i < BITS; i++) {
+        a[i] = a[i] & b[i];
+    }
+}
+
+__attribute__((noipa)) static void difference_bool(bool *a, const bool *b) {
+    for (int i = 0; i < BITS; i++) {
+        a[i] = a[i] & !b[i];
+    }
+}
+
+__attribute__((noipa)) static size_t count_bool(const bool *a) {
+    size_t count = 0;
+    for (int i = 0; i < BITS; i++) {
+        count += a[i];
+    }
+    return count;
+}
+
+__attribute__((noipa)) static size_t test_bool(const bool *a,
+                                               const uint32_t *at, int n) {
+    size_t hits = 0;
+    for (int i = 0; i < n; i++) {
+        hits += a[at[i]];
+    }
+    return hits;
+}
+
+__attribute__((noipa)) static void set_bool(bool *a, const uint32_t *at,
+                                            int n) {
+    for (int i = 0; i < n; i++) {
+        a[at[i]] = true;
+    }
+}
+
+static void report(const char *label, double start, double units,
+                   const char *unit) {
+    printf("%-24s: %8.3f %s\n", label,
+           (now_ns() - start) / (units * PASSES), unit);
+}
+
+int main(void) {
+    bitset a, b;
+    bool *x = malloc(BITS * sizeof *x);
+    bool *y = malloc(BITS * sizeof *y);
+    uint32_t *at = malloc(PROBES * sizeof *at);
+    if (!bs_init(&a, WORDS) || !bs_init(&b, WORDS) || !x || !y || !at) {
+        return 1;
+    }
+    // The same random bits in both representations, half of them set
+    for (int i = 0; i < BITS; i++) {
+        x[i] = next_random() & 1;
+        y[i] = next_random() & 1;
+        if (x[i]) {
+            bs_set(&a, (size_t)i);
+        }
+        if (y[i]) {
+            bs_set(&b, (size_t)i);
+        }
+    }
+    for (int i = 0; i < PROBES; i++) {
+        at[i] = next_random() % BITS;
+    }
+
+    size_t check = 0;
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        check += test_bitset(&a, at, PROBES);
+    }
+    report("test, bitset", start, PROBES, "ns/probe");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        check += test_bool(x, at, PROBES);
+    }
+    report("test, bool array", start, PROBES, "ns/probe");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        check += count_bitset(&a);
+    }
+    report("count, bitset", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        check += count_bool(x);
+    }
+    report("count, bool array", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        union_bitset(&a, &b);
+    }
+    report("union, bitset", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        union_bool(x, y);
+    }
+    report("union, bool array", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        difference_bitset(&a, &b);
+    }
+    report("difference, bitset", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        difference_bool(x, y);
+    }
+    report("difference, bool array", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        set_bitset(&a, at, PROBES);
+    }
+    report("set, bitset", start, PROBES, "ns/probe");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        set_bool(x, at, PROBES);
+    }
+    report("set, bool array", start, PROBES, "ns/probe");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        intersect_bitset(&a, &b);
+    }
+    report("intersect, bitset", start, BITS / 1024, "ns/Kbit");
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        intersect_bool(x, y);
+    }
+    report("intersect, bool array", start, BITS / 1024, "ns/Kbit");
+
+    // Both representations went through the same operations
+    printf("counts: %zu, %zu  (check %zu)\n", count_bitset(&a), count_bool(x),
+           check);
+    return 0;
+}
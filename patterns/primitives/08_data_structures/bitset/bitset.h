@@ -0,0 +1,81 @@
+/*
+ * Fixed-size bitset packed 64 bits to a word
+ * Set operations work a word at a time; the size is a whole number of
+ * words, so no operation has a partial last word to mask
+ */
+
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t word_count;   // size in bits is 64 * word_count
+    uint64_t *words;
+} bitset;
+
+// All bits clear. Returns false if the allocation fails
+static inline bool bs_init(bitset *s, size_t word_count) {
+    s->word_count = word_count;
+    s->words = calloc(word_count, sizeof *s->words);
+    return s->words != NULL || word_count == 0;
+}
+
+static inline void bs_free(bitset *s) {
+    free(s->words);
+    s->words = NULL;
+    s->word_count = 0;
+}
+
+// i < 64 * word_count: nothing checks it
+static inline bool bs_test(const bitset *s, size_t i) {
+    return (s->words[i / 64] >> (i % 64)) & 1;
+}
+
+static inline void bs_set(bitset *s, size_t i) {
+    s->words[i / 64] |= (uint64_t)1 << (i % 64);
+}
+
+static inline void bs_clear(bitset *s, size_t i) {
+    s->words[i / 64] &= ~((uint64_t)1 << (i % 64));
+}
+
+// The binary operations require equal sizes: nothing checks that either
+static inline void bs_union(bitset *target, const bitset *source) {
+    for (size_t i = 0; i < target->word_count; i++) {
+        target->words[i] |= source->words[i];
+    }
+}
+
+static inline void bs_intersect(bitset *target, const bitset *source) {
+    for (size_t i = 0; i < target->word_count; i++) {
+        target->words[i] &= source->words[i];
+    }
+}
+
+static inline void bs_difference(bitset *target, const bitset *source) {
+    for (size_t i = 0; i < target->word_count; i++) {
+        target->words[i] &= ~source->words[i];
+    }
+}
+
+// Four independent sums, as in 09_integer_arithmetic/bits
+static inline size_t bs_count(const bitset *s) {
+    size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    size_t i = 0;
+    for (; i + 4 <= s->word_count; i += 4) {
+        c0 += (size_t)__builtin_popcountll(s->words[i]);
+        c1 += (size_t)__builtin_popcountll(s->words[i + 1]);
+        c2 += (size_t)__builtin_popcountll(s->words[i + 2]);
+        c3 += (size_t)__builtin_popcountll(s->words[i + 3]);
+    }
+    for (; i < s->word_count; i++) {
+        c0 += (size_t)__builtin_popcountll(s->words[i]);
+    }
+    return c0 + c1 + c2 + c3;
+}
+
+#endif
@@ -0,0 +1,209 @@
+package body Bitsets is
+
+   -----------------
+   -- Word lemmas --
+   -----------------
+
+   --  What each word operation does to each bit. The bodies are empty:
+   --  the bit-vector solver proves the postconditions, and the set
+   --  operations below reason about bits through them, not about words
+
+   procedure Lemma_Or (X, Y : Unsigned_64)
+      with Ghost,
+           Post => (for all B in Bit_Index =>
+                      Is_Set (X or Y, B) = (Is_Set (X, B) or Is_Set (Y, B)))
+   is
+   begin
+      null;
+   end Lemma_Or;
+
+   procedure Lemma_And (X, Y : Unsigned_64)
+      with Ghost,
+           Post => (for all B in Bit_Index =>
+                      Is_Set (X and Y, B) = (Is_Set (X, B) and Is_Set (Y, B)))
+   is
+   begin
+      null;
+   end Lemma_And;
+
+   procedure Lemma_And_Not (X, Y : Unsigned_64)
+      with Ghost,
+           Post => (for all B in Bit_Index =>
+                      Is_Set (X and not Y, B)
+                      = (Is_Set (X, B) and not Is_Set (Y, B)))
+   is
+   begin
+      null;
+   end Lemma_And_Not;
+
+   procedure Lemma_Set_Bit (X : Unsigned_64; K : Bit_Index)
+      with Ghost,
+           Post => (for all B in Bit_Index =>
+                      Is_Set (X or Shift_Left (1, K), B)
+                      = (Is_Set (X, B) or B = K))
+   is
+   begin
+      null;
+   end Lemma_Set_Bit;
+
+   procedure Lemma_Clear_Bit (X : Unsigned_64; K : Bit_Index)
+      with Ghost,
+           Post => (for all B in Bit_Index =>
+                      Is_Set (X and not Shift_Left (1, K), B)
+                      = (Is_Set (X, B) and B /= K))
+   is
+   begin
+      null;
+   end Lemma_Clear_Bit;
+
+   ----------------
+   -- Single bit --
+   ----------------
+
+   procedure Set (S : in out Bitset; I : Natural) is
+      W : constant Positive := I / 64 + 1;
+   begin
+      Lemma_Set_Bit (S.Words (W), I mod 64);
+      S.Words (W) := S.Words (W) or Shift_Left (1, I mod 64);
+   end Set;
+
+   procedure Clear (S : in out Bitset; I : Natural) is
+      W : constant Positive := I / 64 + 1;
+   begin
+      Lemma_Clear_Bit (S.Words (W), I mod 64);
+      S.Words (W) := S.Words (W) and not Shift_Left (1, I mod 64);
+   end Clear;
+
+   --------------------
+   -- Set operations --
+   --------------------
+
+   --  Each loop proves its operation word by word; the postcondition
+   --  then reads any position J off word J / 64 + 1
+
+   procedure Union (Target : in out Bitset; Source : Bitset) is
+   begin
+      for W in 1 .. Target.Word_Count loop
+         Lemma_Or (Target.Words (W), Source.Words (W));
+         Target.Words (W) := Target.Words (W) or Source.Words (W);
+         pragma Loop_Invariant
+            (for all V in 1 .. W =>
+               (for all B in Bit_Index =>
+                  Is_Set (Target.Words (V), B)
+                  = (Is_Set (Target'Loop_Entry.Words (V), B)
+                     or Is_Set (Source.Words (V), B))));
+         pragma Loop_Invariant
+            (for all V in W + 1 .. Target.Word_Count =>
+               Target.Words (V) = Target'Loop_Entry.Words (V));
+      end loop;
+   end Union;
+
+   procedure Intersect (Target : in out Bitset; Source : Bitset) is
+   begin
+      for W in 1 .. Target.Word_Count loop
+         Lemma_And (Target.Words (W), Source.Words (W));
+         Target.Words (W) := Target.Words (W) and Source.Words (W);
+         pragma Loop_Invariant
+            (for all V in 1 .. W =>
+               (for all B in Bit_Index =>
+                  Is_Set (Target.Words (V), B)
+                  = (Is_Set (Target'Loop_Entry.Words (V), B)
+                     and Is_Set (Source.Words (V), B))));
+         pragma Loop_Invariant
+            (for all V in W + 1 .. Target.Word_Count =>
+               Target.Words (V) = Target'Loop_Entry.Words (V));
+      end loop;
+   end Intersect;
+
+   procedure Difference (Target : in out Bitset; Source : Bitset) is
+   begin
+      for W in 1 .. Target.Word_Count loop
+         Lemma_And_Not (Target.Words (W), Source.Words (W));
+         Target.Words (W) := Target.Words (W) and not Source.Words (W);
+         pragma Loop_Invariant
+            (for all V in 1 .. W =>
+               (for all B in Bit_Index =>
+                  Is_Set (Target.Words (V), B)
+                  = (Is_Set (Target'Loop_Entry.Words (V), B)
+                     and not Is_Set (Source.Words (V), B))));
+         pragma Loop_Invariant
+            (for all V in W + 1 .. Target.Word_Count =>
+               Target.Words (V) = Target'Loop_Entry.Words (V));
+      end loop;
+   end Difference;
+
+   -----------
+   -- Count --
+   -----------
+
+   --  Ghost: the number of set bits among the low N bits of X
+   function Ones (X : Unsigned_64; N : Natural) return Natural is
+     (if N = 0 then 0
+      else Ones (X, N - 1) + Boolean'Pos (Is_Set (X, N - 1)))
+   with Ghost,
+        Pre                => N <= 64,
+        Post               => Ones'Result <= N,
+        Subprogram_Variant => (Decreases => N);
+
+   --  The postcondition describes the instruction: it is assumed by
+   --  gnatprove, not proven
+   function Popcount (X : Unsigned_64) return Natural
+      with Import, Convention => Intrinsic,
+           External_Name => "__builtin_popcountll",
+           Global => null,
+           Post   => Popcount'Result = Ones (X, 64);
+
+   --  Word W adds the ones of its low N bits to the count of the words
+   --  before it
+   procedure Lemma_Count_Word (S : Bitset; W : Positive; N : Natural)
+      with Ghost,
+           Pre                => W <= S.Word_Count and then N <= 64,
+           Post               => Count_Below (S, 64 * (W - 1) + N)
+                                 = Count_Below (S, 64 * (W - 1))
+                                   + Ones (S.Words (W), N),
+           Subprogram_Variant => (Decreases => N)
+   is
+   begin
+      if N > 0 then
+         Lemma_Count_Word (S, W, N - 1);
+         pragma Assert ((64 * (W - 1) + N - 1) / 64 + 1 = W
+                        and (64 * (W - 1) + N - 1) mod 64 = N - 1);
+      end if;
+   end Lemma_Count_Word;
+
+   --  Four independent sums, as in bitset.h
+   function Count (S : Bitset) return Natural is
+      C0, C1, C2, C3 : Natural := 0;
+      W              : Positive := 1;
+   begin
+      while W + 3 <= S.Word_Count loop
+         pragma Loop_Invariant (W <= S.Word_Count - 3);
+         pragma Loop_Invariant
+            (C0 + C1 + C2 + C3 = Count_Below (S, 64 * (W - 1)));
+         pragma Loop_Variant (Increases => W);
+
+         Lemma_Count_Word (S, W, 64);
+         Lemma_Count_Word (S, W + 1, 64);
+         Lemma_Count_Word (S, W + 2, 64);
+         Lemma_Count_Word (S, W + 3, 64);
+         C0 := C0 + Popcount (S.Words (W));
+         C1 := C1 + Popcount (S.Words (W + 1));
+         C2 := C2 + Popcount (S.Words (W + 2));
+         C3 := C3 + Popcount (S.Words (W + 3));
+         W := W + 4;
+      end loop;
+
+      C0 := C0 + C1 + C2 + C3;
+      while W <= S.Word_Count loop
+         pragma Loop_Invariant (W <= S.Word_Count);
+         pragma Loop_Invariant (C0 = Count_Below (S, 64 * (W - 1)));
+         pragma Loop_Variant (Increases => W);
+
+         Lemma_Count_Word (S, W, 64);
+         C0 := C0 + Popcount (S.Words (W));
+         W := W + 1;
+      end loop;
+      return C0;
+   end Count;
+
+end Bitsets;
@@ -0,0 +1,37 @@
+--  Packed bitset: 128 flags in two words instead of 128 bytes
+--  Primes below 128 by sieving, then set operations on whole words
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Bitsets;     use Bitsets;
+
+procedure Example is
+
+   Primes : Bitset (Word_Count => 2);
+   Odd    : Bitset (Word_Count => 2);
+
+begin
+   for I in 2 .. Size (Primes) - 1 loop
+      Set (Primes, I);
+   end loop;
+   for I in 2 .. 11 loop
+      if Test (Primes, I) then
+         for J in I .. (Size (Primes) - 1) / I loop
+            Clear (Primes, I * J);
+         end loop;
+      end if;
+   end loop;
+   for I in 0 .. Size (Odd) / 2 - 1 loop
+      Set (Odd, 2 * I + 1);
+   end loop;
+   Put_Line ("Primes below 128:  " & Natural'Image (Count (Primes)));
+   Put_Line ("Is 97 prime:        " & Boolean'Image (Test (Primes, 97)));
+   Put_Line ("Odd numbers:       " & Natural'Image (Count (Odd)));
+
+   --  Two words per operation, not 128 bytes
+   Difference (Odd, Primes);
+   Put_Line ("Odd and not prime: " & Natural'Image (Count (Odd)));
+   Intersect (Primes, Odd);
+   Put_Line ("Primes among them: " & Natural'Image (Count (Primes)));
+
+   --  Test (Primes, 128) is rejected by the prover: Pre => I < Size (S)
+end Example;
@@ -0,0 +1,41 @@
+/*
+ * Packed bitset: 128 flags in two words instead of 128 bytes
+ * Primes below 128 by sieving, then set operations on whole words
+ */
+
+#include <stdio.h>
+#include "bitset.h"
+
+int main(void) {
+    bitset primes, odd;
+    if (!bs_init(&primes, 2) || !bs_init(&odd, 2)) {
+        return 1;
+    }
+    for (size_t i = 2; i < 128; i++) {
+        bs_set(&primes, i);
+    }
+    for (size_t i = 2; i * i < 128; i++) {
+        if (bs_test(&primes, i)) {
+            for (size_t j = i * i; j < 128; j += i) {
+                bs_clear(&primes, j);
+            }
+        }
+    }
+    for (size_t i = 1; i < 128; i += 2) {
+        bs_set(&odd, i);
+    }
+    printf("Primes below 128:     %zu\n", bs_count(&primes));
+    printf("Is 97 prime:          %s\n", bs_test(&primes, 97) ? "yes" : "no");
+    printf("Odd numbers:          %zu\n", bs_count(&odd));
+
+    // Two words per operation, not 128 bytes
+    bs_difference(&odd, &primes);
+    printf("Odd and not prime:    %zu\n", bs_count(&odd));
+    bs_intersect(&primes, &odd);
+    printf("Primes among them:    %zu\n", bs_count(&primes));
+
+    // bs_test(&primes, 128) reads past the last word: nothing checks it
+    bs_free(&primes);
+    bs_free(&odd);
+    return 0;
+}
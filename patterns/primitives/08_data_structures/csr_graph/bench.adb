@@ -0,0 +1,136 @@
+--  Benchmark: CSR vs adjacency lists of access values, 10M random edges
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Csr_Graphs;    use Csr_Graphs;
+
+procedure Bench is
+
+   Vertices : constant := 1_000_000;
+   Edges    : constant := 10_000_000;
+   Searches : constant := 5;
+
+   --  The pointer-based layout CSR replaces: one allocation per edge
+   type Edge_Node;
+   type Edge_Access is access Edge_Node;
+   type Edge_Node is record
+      Target : Vertex;
+      Next   : Edge_Access;
+   end record;
+
+   type Head_Array is array (1 .. Vertices) of Edge_Access;
+   type Head_Array_Access is access Head_Array;
+   type Bool_Array is array (1 .. Vertices) of Boolean with Pack;
+   type Int_Array is array (1 .. Vertices) of Integer;
+
+   type Edge_List_Access is access Vertex_Array;
+   type Graph_Access is access Graph;
+   type Search_Access is access Search;
+   type Bool_Array_Access is access Bool_Array;
+   type Int_Array_Access is access Int_Array;
+
+   procedure List_BFS
+      (Heads   : Head_Array;
+       Source  : Vertex;
+       Queue   : in out Int_Array;
+       Visited : in out Bool_Array;
+       Dist    : in out Int_Array)
+   is
+      Tail : Natural := 1;
+      Node : Edge_Access;
+   begin
+      Dist := (others => Unreached);
+      Visited := (others => False);
+      Queue (1) := Source;
+      Visited (Source) := True;
+      Dist (Source) := 0;
+      for Head in Queue'Range loop
+         exit when Head > Tail;
+         Node := Heads (Queue (Head));
+         while Node /= null loop
+            if not Visited (Node.Target) then
+               Visited (Node.Target) := True;
+               Dist (Node.Target) := Dist (Queue (Head)) + 1;
+               Tail := Tail + 1;
+               Queue (Tail) := Node.Target;
+            end if;
+            Node := Node.Next;
+         end loop;
+      end loop;
+   end List_BFS;
+   pragma Machine_Attribute (List_BFS, "noipa");
+
+   procedure Run_BFS (G : Graph; S : in out Search) is
+   begin
+      BFS (G, 1, S);
+   end Run_BFS;
+   pragma Machine_Attribute (Run_BFS, "noipa");
+
+   Sources : constant Edge_List_Access := new Vertex_Array (1 .. Edges);
+   Targets : constant Edge_List_Access := new Vertex_Array (1 .. Edges);
+   G       : constant Graph_Access :=
+      new Graph (Vertex_Count => Vertices, Edge_Count => Edges);
+   S       : constant Search_Access := new Search (Vertex_Count => Vertices);
+   Heads   : constant Head_Array_Access := new Head_Array'(others => null);
+   Queue   : constant Int_Array_Access := new Int_Array;
+   Dist    : constant Int_Array_Access := new Int_Array;
+   Visited : constant Bool_Array_Access := new Bool_Array;
+   Seed    : Unsigned_32 := 12345;
+   Start   : Time;
+   Check   : Long_Long_Integer := 0;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   procedure Report (Label : String; Count : Positive) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Count)) &
+                " ns/edge");
+   end Report;
+
+begin
+   for K in 1 .. Edges loop
+      Sources (K) := Vertex (Next_Random mod Vertices) + 1;
+      Targets (K) := Vertex (Next_Random mod Vertices) + 1;
+   end loop;
+
+   Start := Clock;
+   Build (G.all, Sources.all, Targets.all);
+   Report ("CSR build (counting sort) :", Edges);
+
+   Start := Clock;
+   for K in reverse 1 .. Edges loop
+      Heads (Sources (K)) :=
+         new Edge_Node'(Target => Targets (K), Next => Heads (Sources (K)));
+   end loop;
+   Report ("List build (new per edge) :", Edges);
+
+   Start := Clock;
+   for R in 1 .. Searches loop
+      Run_BFS (G.all, S.all);
+   end loop;
+   Report ("CSR BFS                   :", Edges * Searches);
+
+   Start := Clock;
+   for R in 1 .. Searches loop
+      List_BFS (Heads.all, 1, Queue.all, Visited.all, Dist.all);
+   end loop;
+   Report ("List BFS                  :", Edges * Searches);
+
+   for V in 1 .. Vertices loop
+      Check := Check + Long_Long_Integer (Distance_To (S.all, V))
+                     - Long_Long_Integer (Dist (V));
+   end loop;
+   Put_Line ("distance mismatch (expect 0):" & Long_Long_Integer'Image (Check));
+end Bench;
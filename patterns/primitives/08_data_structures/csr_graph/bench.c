@@ -0,0 +1,121 @@
+/*
+ * Benchmark: CSR vs adjacency lists of pointers, 10M random edges
+ * Build from an edge list, then breadth-first search
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "csr_graph.h"
+
+#define VERTICES 1000000
+#define EDGES    10000000
+#define SEARCHES 5
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static long long dist_sum(const int32_t *dist, uint32_t n) {
+    long long sum = 0;
+    for (uint32_t v = 0; v < n; v++) {
+        sum += dist[v];
+    }
+    return sum;
+}
+
+// Keep the searches out of line so each variant is timed as written
+__attribute__((noipa)) static void run_bfs(const csr_graph *g, bfs_search *s) {
+    bfs(g, 0, s);
+}
+
+__attribute__((noipa)) static void run_bfs_plain(const csr_graph *g, uint32_t *queue,
+                                                 uint64_t *visited, int32_t *dist) {
+    bfs_plain(g, 0, queue, visited, dist);
+}
+
+__attribute__((noipa)) static void run_list_bfs(const list_graph *g, uint32_t *queue,
+                                                uint64_t *visited, int32_t *dist) {
+    list_bfs(g, 0, queue, visited, dist);
+}
+
+int main(void) {
+    uint32_t *src = malloc(EDGES * sizeof *src);
+    uint32_t *dst = malloc(EDGES * sizeof *dst);
+    uint32_t *queue = malloc(VERTICES * sizeof *queue);
+    uint64_t *visited = malloc((VERTICES + 63) / 64 * sizeof *visited);
+    int32_t *dist = malloc(VERTICES * sizeof *dist);
+    bfs_search s;
+    csr_graph g;
+    list_graph lg;
+    if (!src || !dst || !queue || !visited || !dist ||
+        !bfs_search_init(&s, VERTICES)) {
+        return 1;
+    }
+    for (uint32_t k = 0; k < EDGES; k++) {
+        src[k] = next_random() % VERTICES;
+        dst[k] = next_random() % VERTICES;
+    }
+
+    double start = now_ns();
+    if (!csr_build(&g, VERTICES, EDGES, src, dst)) {
+        return 1;
+    }
+    printf("CSR build (counting sort)   : %.2f ns/edge\n",
+           (now_ns() - start) / EDGES);
+
+    start = now_ns();
+    if (!list_build(&lg, VERTICES, EDGES, src, dst)) {
+        return 1;
+    }
+    printf("List build (malloc per edge): %.2f ns/edge\n",
+           (now_ns() - start) / EDGES);
+
+    start = now_ns();
+    for (int r = 0; r < SEARCHES; r++) {
+        run_bfs(&g, &s);
+    }
+    printf("CSR BFS, SPARK twin         : %.2f ns/edge\n",
+           (now_ns() - start) / ((double)EDGES * SEARCHES));
+    long long check_twin = dist_sum(s.dist, VERTICES);
+
+    start = now_ns();
+    for (int r = 0; r < SEARCHES; r++) {
+        run_bfs_plain(&g, queue, visited, dist);
+    }
+    printf("CSR BFS, plain queue        : %.2f ns/edge\n",
+           (now_ns() - start) / ((double)EDGES * SEARCHES));
+    long long check_plain = dist_sum(dist, VERTICES);
+
+    start = now_ns();
+    for (int r = 0; r < SEARCHES; r++) {
+        run_list_bfs(&lg, queue, visited, dist);
+    }
+    printf("List BFS                    : %.2f ns/edge\n",
+           (now_ns() - start) / ((double)EDGES * SEARCHES));
+    long long check_list = dist_sum(dist, VERTICES);
+
+    printf("reached %u vertices, distance sums %lld %lld %lld\n",
+           s.tail, check_twin, check_plain, check_list);
+
+    list_destroy(&lg);
+    csr_destroy(&g);
+    bfs_search_destroy(&s);
+    free(src);
+    free(dst);
+    free(queue);
+    free(visited);
+    free(dist);
+    return 0;
+}
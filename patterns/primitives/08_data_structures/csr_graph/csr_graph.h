@@ -0,0 +1,238 @@
+/*
+ * Compressed sparse row (CSR) graph and breadth-first search
+ * 0-based: the out-edges of v are adjacency[offsets[v] .. offsets[v + 1] - 1]
+ */
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UNREACHED (-1)
+
+typedef struct {
+    uint32_t vertex_count;
+    uint32_t edge_count;
+    uint32_t *offsets;      // vertex_count + 1 entries
+    uint32_t *adjacency;    // edge_count entries
+} csr_graph;
+
+// Counting sort of the edge list by source: two allocations in total.
+// Returns 0 when malloc fails
+static inline int csr_build(csr_graph *g, uint32_t n, uint32_t m,
+                            const uint32_t *src, const uint32_t *dst) {
+    g->vertex_count = n;
+    g->edge_count = m;
+    g->offsets = calloc((size_t)n + 1, sizeof *g->offsets);
+    g->adjacency = malloc((size_t)m * sizeof *g->adjacency);
+    if (!g->offsets || !g->adjacency) {
+        free(g->offsets);
+        free(g->adjacency);
+        return 0;
+    }
+    uint32_t *offsets = g->offsets;
+
+    // 1. Degrees into offsets[v + 1]
+    for (uint32_t k = 0; k < m; k++) {
+        offsets[src[k] + 1]++;
+    }
+    // 2. Prefix sums: offsets[v + 1] is one past the last edge of v
+    for (uint32_t v = 0; v < n; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    // 3. Placement, last edge first, into the top free slot of its
+    //    source: a stable counting sort
+    for (uint32_t k = m; k-- > 0;) {
+        g->adjacency[--offsets[src[k] + 1]] = dst[k];
+    }
+    // 4. offsets[v + 1] is now the first edge of v: shift back
+    for (uint32_t v = 0; v < n; v++) {
+        offsets[v] = offsets[v + 1];
+    }
+    offsets[n] = m;
+    return 1;
+}
+
+static inline void csr_destroy(csr_graph *g) {
+    free(g->offsets);
+    free(g->adjacency);
+}
+
+/* ---- BFS, as in the SPARK version ---- */
+
+// order is a permutation of the vertices: order[0 .. tail - 1] are the
+// reached vertices in BFS order (the queue), pos_of is its inverse
+typedef struct {
+    uint32_t *order;
+    uint32_t *pos_of;
+    uint64_t *visited;
+    int32_t *dist;
+    int64_t *parent;        // -1 for the source and unreached vertices
+    uint32_t tail;
+} bfs_search;
+
+static inline int bfs_search_init(bfs_search *s, uint32_t n) {
+    s->order = malloc((size_t)n * sizeof *s->order);
+    s->pos_of = malloc((size_t)n * sizeof *s->pos_of);
+    s->visited = malloc(((size_t)n + 63) / 64 * sizeof *s->visited);
+    s->dist = malloc((size_t)n * sizeof *s->dist);
+    s->parent = malloc((size_t)n * sizeof *s->parent);
+    return s->order && s->pos_of && s->visited && s->dist && s->parent;
+}
+
+static inline void bfs_search_destroy(bfs_search *s) {
+    free(s->order);
+    free(s->pos_of);
+    free(s->visited);
+    free(s->dist);
+    free(s->parent);
+}
+
+static inline int bit_test(const uint64_t *bits, uint32_t v) {
+    return (bits[v / 64] >> (v % 64)) & 1;
+}
+
+static inline void bit_set(uint64_t *bits, uint32_t v) {
+    bits[v / 64] |= (uint64_t)1 << (v % 64);
+}
+
+static inline void bfs_discover(bfs_search *s, uint32_t v, int32_t dist,
+                                int64_t parent) {
+    uint32_t slot = s->pos_of[v];
+    uint32_t top = s->tail;
+    uint32_t other = s->order[top];
+    s->order[slot] = other;
+    s->pos_of[other] = slot;
+    s->order[top] = v;
+    s->pos_of[v] = top;
+    s->tail = top + 1;
+    bit_set(s->visited, v);
+    s->dist[v] = dist;
+    s->parent[v] = parent;
+}
+
+static inline void bfs(const csr_graph *g, uint32_t source, bfs_search *s) {
+    uint32_t n = g->vertex_count;
+    for (uint32_t v = 0; v < n; v++) {
+        s->order[v] = v;
+        s->pos_of[v] = v;
+        s->dist[v] = UNREACHED;
+        s->parent[v] = -1;
+    }
+    memset(s->visited, 0, ((size_t)n + 63) / 64 * sizeof *s->visited);
+    s->tail = 0;
+
+    bfs_discover(s, source, 0, -1);
+    for (uint32_t head = 0; head < s->tail; head++) {
+        uint32_t u = s->order[head];
+        int32_t next_dist = s->dist[u] + 1;
+        for (uint32_t e = g->offsets[u]; e < g->offsets[u + 1]; e++) {
+            uint32_t w = g->adjacency[e];
+            if (!bit_test(s->visited, w)) {
+                bfs_discover(s, w, next_dist, u);
+            }
+        }
+    }
+}
+
+/* ---- BFS as usually written in C: queue + bitset, no permutation ---- */
+
+static inline void bfs_plain(const csr_graph *g, uint32_t source,
+                             uint32_t *queue, uint64_t *visited, int32_t *dist) {
+    uint32_t n = g->vertex_count;
+    for (uint32_t v = 0; v < n; v++) {
+        dist[v] = UNREACHED;
+    }
+    memset(visited, 0, ((size_t)n + 63) / 64 * sizeof *visited);
+
+    uint32_t tail = 0;
+    queue[tail++] = source;
+    bit_set(visited, source);
+    dist[source] = 0;
+    for (uint32_t head = 0; head < tail; head++) {
+        uint32_t u = queue[head];
+        int32_t next_dist = dist[u] + 1;
+        for (uint32_t e = g->offsets[u]; e < g->offsets[u + 1]; e++) {
+            uint32_t w = g->adjacency[e];
+            if (!bit_test(visited, w)) {
+                bit_set(visited, w);
+                dist[w] = next_dist;
+                queue[tail++] = w;
+            }
+        }
+    }
+}
+
+/* ---- Adjacency lists of pointers: the layout CSR replaces ---- */
+
+typedef struct edge_node {
+    uint32_t target;
+    struct edge_node *next;
+} edge_node;
+
+typedef struct {
+    uint32_t vertex_count;
+    edge_node **heads;
+} list_graph;
+
+// One malloc per edge; returns 0 when malloc fails
+static inline int list_build(list_graph *g, uint32_t n, uint32_t m,
+                             const uint32_t *src, const uint32_t *dst) {
+    g->vertex_count = n;
+    g->heads = calloc(n, sizeof *g->heads);
+    if (!g->heads) {
+        return 0;
+    }
+    for (uint32_t k = m; k-- > 0;) {
+        edge_node *node = malloc(sizeof *node);
+        if (!node) {
+            return 0;
+        }
+        node->target = dst[k];
+        node->next = g->heads[src[k]];
+        g->heads[src[k]] = node;
+    }
+    return 1;
+}
+
+static inline void list_destroy(list_graph *g) {
+    for (uint32_t v = 0; v < g->vertex_count; v++) {
+        edge_node *node = g->heads[v];
+        while (node) {
+            edge_node *next = node->next;
+            free(node);
+            node = next;
+        }
+    }
+    free(g->heads);
+}
+
+static inline void list_bfs(const list_graph *g, uint32_t source,
+                            uint32_t *queue, uint64_t *visited, int32_t *dist) {
+    uint32_t n = g->vertex_count;
+    for (uint32_t v = 0; v < n; v++) {
+        dist[v] = UNREACHED;
+    }
+    memset(visited, 0, ((size_t)n + 63) / 64 * sizeof *visited);
+
+    uint32_t tail = 0;
+    queue[tail++] = source;
+    bit_set(visited, source);
+    dist[source] = 0;
+    for (uint32_t head = 0; head < tail; head++) {
+        uint32_t u = queue[head];
+        int32_t next_dist = dist[u] + 1;
+        for (const edge_node *node = g->heads[u]; node; node = node->next) {
+            uint32_t w = node->target;
+            if (!bit_test(visited, w)) {
+                bit_set(visited, w);
+                dist[w] = next_dist;
+                queue[tail++] = w;
+            }
+        }
+    }
+}
+
+#endif
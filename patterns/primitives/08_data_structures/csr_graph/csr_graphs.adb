@@ -0,0 +1,328 @@
+package body Csr_Graphs is
+
+   ------------------------------------------------------------------
+   --  Ghost counting for Build
+   ------------------------------------------------------------------
+
+   --  Edges among Sources (After + 1 .. Sources'Last) leaving any vertex
+   --  in W .. Vertex_Count
+   function Total_From
+      (Sources      : Vertex_Array;
+       Vertex_Count : Vertex_Count_Range;
+       W            : Positive;
+       After        : Natural) return Long_Long_Integer
+   is
+     (if W > Vertex_Count then 0
+      else Long_Long_Integer (Count_After (Sources, W, After))
+           + Total_From (Sources, Vertex_Count, W + 1, After))
+   with Ghost,
+        Pre                => Sources'First = 1
+                              and then After <= Sources'Last
+                              and then W <= Vertex_Count + 1,
+        Post               => Total_From'Result in
+                                0 .. Long_Long_Integer (Vertex_Count + 1 - W)
+                                     * Max_Edges,
+        Subprogram_Variant => (Decreases => Vertex_Count + 1 - W);
+
+   --  Moving the boundary back over one edge adds it to every total whose
+   --  vertex range contains its source
+   procedure Lemma_Total_Step
+      (Sources      : Vertex_Array;
+       Vertex_Count : Vertex_Count_Range;
+       After        : Natural)
+      with Ghost,
+           Pre  => Sources'First = 1
+                   and then After < Sources'Last
+                   and then (for all K in Sources'Range =>
+                               Sources (K) <= Vertex_Count),
+           Post => (for all W in 1 .. Vertex_Count + 1 =>
+                      Total_From (Sources, Vertex_Count, W, After)
+                        = Total_From (Sources, Vertex_Count, W, After + 1)
+                          + (if Sources (After + 1) >= W then 1 else 0))
+   is
+   begin
+      for W in reverse 1 .. Vertex_Count + 1 loop
+         pragma Loop_Invariant
+            (for all X in W .. Vertex_Count + 1 =>
+               Total_From (Sources, Vertex_Count, X, After)
+                 = Total_From (Sources, Vertex_Count, X, After + 1)
+                   + (if Sources (After + 1) >= X then 1 else 0));
+      end loop;
+   end Lemma_Total_Step;
+
+   --  Every edge leaves exactly one vertex, so the degrees add up to the
+   --  number of edges
+   procedure Lemma_Total
+      (Sources      : Vertex_Array;
+       Vertex_Count : Vertex_Count_Range)
+      with Ghost,
+           Pre  => Sources'First = 1
+                   and then (for all K in Sources'Range =>
+                               Sources (K) <= Vertex_Count),
+           Post => Total_From (Sources, Vertex_Count, 1, 0)
+                     = Long_Long_Integer (Sources'Length)
+   is
+   begin
+      --  No edges after the last one
+      for W in reverse 1 .. Vertex_Count + 1 loop
+         pragma Loop_Invariant
+            (for all X in W .. Vertex_Count + 1 =>
+               Total_From (Sources, Vertex_Count, X, Sources'Last) = 0);
+      end loop;
+
+      for After in reverse 0 .. Sources'Last - 1 loop
+         Lemma_Total_Step (Sources, Vertex_Count, After);
+         pragma Loop_Invariant
+            (Total_From (Sources, Vertex_Count, 1, After)
+               = Long_Long_Integer (Sources'Last - After));
+      end loop;
+   end Lemma_Total;
+
+   --  Fewer edges after a later boundary
+   procedure Lemma_Count_Mono
+      (Sources : Vertex_Array;
+       V       : Vertex;
+       After   : Natural)
+      with Ghost,
+           Pre  => Sources'First = 1 and then After <= Sources'Last,
+           Post => Count_After (Sources, V, After)
+                     <= Count_After (Sources, V, 0)
+   is
+   begin
+      for A in reverse 0 .. After - 1 loop
+         pragma Loop_Invariant
+            (Count_After (Sources, V, After) <= Count_After (Sources, V, A));
+      end loop;
+   end Lemma_Count_Mono;
+
+   -----------
+   -- Build --
+   -----------
+
+   procedure Build
+      (G       : in out Graph;
+       Sources : Vertex_Array;
+       Targets : Vertex_Array)
+   is
+      Vc : constant Vertex_Count_Range := G.Vertex_Count;
+      Ec : constant Edge_Count_Range := G.Edge_Count;
+   begin
+      --  1. Degrees. Counting from the last edge keeps every step a
+      --     single unfolding of Count_After
+      G.Offsets := (others => 0);
+      for K in reverse 1 .. Ec loop
+         G.Offsets (Sources (K)) := G.Offsets (Sources (K)) + 1;
+         pragma Loop_Invariant (G.Offsets (0) = 0);
+         pragma Loop_Invariant
+            (for all V in 1 .. Vc =>
+               G.Offsets (V) = Count_After (Sources, V, K - 1));
+      end loop;
+
+      --  2. Prefix sums: Offsets (V) becomes the last edge of V
+      Lemma_Total (Sources, Vc);
+      for V in 1 .. Vc loop
+         G.Offsets (V) := G.Offsets (V - 1) + G.Offsets (V);
+         pragma Loop_Invariant (G.Offsets (0) = 0);
+         pragma Loop_Invariant
+            (Long_Long_Integer (G.Offsets (V))
+               + Total_From (Sources, Vc, V + 1, 0) = Long_Long_Integer (Ec));
+         pragma Loop_Invariant
+            (for all W in 1 .. V =>
+               G.Offsets (W) = G.Offsets (W - 1) + Count_After (Sources, W, 0)
+               and G.Offsets (W) <= G.Offsets (V));
+         pragma Loop_Invariant
+            (for all W in V + 1 .. Vc =>
+               G.Offsets (W) = Count_After (Sources, W, 0));
+      end loop;
+      pragma Assert (G.Offsets (Vc) = Ec);
+
+      declare
+         Ends : constant Offset_Array (0 .. Vc) := G.Offsets
+            with Ghost;
+      begin
+         --  3. Placement, last edge first, each into the top free slot of
+         --     its source's range: a stable counting sort. G is in out,
+         --     so the slots are reset first: every one then holds a
+         --     vertex before and after it is written
+         G.Adjacency := (others => 1);
+         for K in reverse 1 .. Ec loop
+            declare
+               V   : constant Vertex := Sources (K);
+               Pos : constant Edge_Offset := G.Offsets (V);
+            begin
+               Lemma_Count_Mono (Sources, V, K - 1);
+               pragma Assert (Pos in Ends (V - 1) + 1 .. Ends (V));
+               G.Adjacency (Pos) := Targets (K);
+               G.Offsets (V) := Pos - 1;
+            end;
+            pragma Loop_Invariant (G.Offsets (0) = 0);
+            pragma Loop_Invariant
+               (for all V in 1 .. Vc =>
+                  G.Offsets (V) + Count_After (Sources, V, K - 1) = Ends (V));
+            pragma Loop_Invariant
+               (for all E in 1 .. Ec => G.Adjacency (E) <= Vc);
+         end loop;
+
+         --  4. Offsets (V) is now the last edge of V - 1: shift back
+         pragma Assert
+            (for all V in 1 .. Vc => G.Offsets (V) = Ends (V - 1));
+         for V in 0 .. Vc - 1 loop
+            G.Offsets (V) := G.Offsets (V + 1);
+            pragma Loop_Invariant
+               (for all W in 0 .. V => G.Offsets (W) = Ends (W));
+            pragma Loop_Invariant
+               (for all W in V + 1 .. Vc => G.Offsets (W) = Ends (W - 1));
+         end loop;
+         G.Offsets (Vc) := Ec;
+         pragma Assert (G.Offsets = Ends);
+      end;
+   end Build;
+
+   ---------
+   -- BFS --
+   ---------
+
+   --  Swap V into slot Tail + 1 and record it as reached
+   procedure Discover
+      (S      : in out Search;
+       V      : Vertex;
+       Dist   : Distance;
+       Parent : Natural)
+      with Pre  => Is_Consistent (S)
+                   and then V <= S.Vertex_Count
+                   and then S.Pos_Of (V) > S.Tail
+                   and then Dist in 0 .. S.Tail,
+           Post => Is_Consistent (S)
+               and S.Tail = S.Tail'Old + 1
+               and S.Order (S.Tail) = V
+               and S.Dist (V) = Dist
+               and S.Parent (V) = Parent
+               and (for all I in 1 .. S.Tail'Old =>
+                      S.Order (I) = S.Order'Old (I))
+               and (for all X in 1 .. S.Vertex_Count =>
+                      (if X /= V then
+                         S.Dist (X) = S.Dist'Old (X)
+                         and S.Parent (X) = S.Parent'Old (X)
+                         and (S.Pos_Of (X) <= S.Tail)
+                               = (S.Pos_Of'Old (X) <= S.Tail'Old)))
+   is
+      Slot  : constant Vertex := S.Pos_Of (V);
+      Top   : constant Vertex := S.Tail + 1;
+      Other : constant Vertex := S.Order (Top);
+   begin
+      S.Order (Slot) := Other;
+      S.Pos_Of (Other) := Slot;
+      S.Order (Top) := V;
+      S.Pos_Of (V) := Top;
+      S.Tail := Top;
+      S.Visited (V) := True;
+      S.Dist (V) := Dist;
+      S.Parent (V) := Parent;
+   end Discover;
+
+   procedure BFS (G : Graph; Source : Vertex; S : in out Search) is
+      Vc   : constant Vertex_Count_Range := G.Vertex_Count;
+      Head : Positive := 1;
+   begin
+      --  O(V) reset, as for any visited array
+      for V in 1 .. Vc loop
+         S.Order (V) := V;
+         S.Pos_Of (V) := V;
+         S.Dist (V) := Unreached;
+         S.Parent (V) := 0;
+         pragma Loop_Invariant
+            (for all W in 1 .. V =>
+               S.Order (W) = W and S.Pos_Of (W) = W
+               and S.Dist (W) = Unreached and S.Parent (W) = 0);
+      end loop;
+      S.Visited := (others => False);
+      S.Tail := 0;
+
+      Discover (S, Source, 0, 0);
+
+      while Head <= S.Tail loop
+         pragma Loop_Invariant (Is_Consistent (S));
+         pragma Loop_Invariant (Head <= S.Tail);
+         pragma Loop_Invariant (S.Order (1) = Source and S.Dist (Source) = 0);
+         --  The queue is sorted by distance and spans at most two levels
+         pragma Loop_Invariant
+            (for all I in 1 .. S.Tail =>
+               (for all J in I .. S.Tail =>
+                  S.Dist (S.Order (I)) <= S.Dist (S.Order (J))));
+         pragma Loop_Invariant
+            (S.Dist (S.Order (S.Tail)) <= S.Dist (S.Order (Head)) + 1);
+         --  Distances are lengths of real paths
+         pragma Loop_Invariant
+            (for all V in 1 .. Vc =>
+               (if S.Pos_Of (V) <= S.Tail and V /= Source then
+                  S.Parent (V) in 1 .. Vc
+                  and then S.Pos_Of (S.Parent (V)) <= S.Tail
+                  and then S.Dist (V) = S.Dist (S.Parent (V)) + 1
+                  and then Has_Edge (G, S.Parent (V), V)));
+         --  Every processed vertex has all its neighbours reached, at
+         --  most one step further
+         pragma Loop_Invariant
+            (for all I in 1 .. Head - 1 =>
+               (for all E in G.Offsets (S.Order (I) - 1) + 1
+                             .. G.Offsets (S.Order (I)) =>
+                  S.Pos_Of (G.Adjacency (E)) <= S.Tail
+                  and S.Dist (G.Adjacency (E))
+                        <= S.Dist (S.Order (I)) + 1));
+         pragma Loop_Variant (Increases => Head);
+
+         declare
+            U         : constant Vertex := S.Order (Head);
+            Next_Dist : constant Positive := S.Dist (U) + 1;
+         begin
+            for E in G.Offsets (U - 1) + 1 .. G.Offsets (U) loop
+               declare
+                  W : constant Vertex := G.Adjacency (E);
+               begin
+                  --  The hot test reads one bit
+                  if not S.Visited (W) then
+                     Discover (S, W, Next_Dist, U);
+                  end if;
+               end;
+               pragma Loop_Invariant (Is_Consistent (S));
+               pragma Loop_Invariant (Head <= S.Tail);
+               pragma Loop_Invariant
+                  (for all I in 1 .. S.Tail'Loop_Entry =>
+                     S.Order (I) = S.Order'Loop_Entry (I));
+               pragma Loop_Invariant
+                  (S.Order (1) = Source and S.Dist (Source) = 0);
+               pragma Loop_Invariant
+                  (for all I in 1 .. S.Tail =>
+                     (for all J in I .. S.Tail =>
+                        S.Dist (S.Order (I)) <= S.Dist (S.Order (J))));
+               pragma Loop_Invariant
+                  (S.Dist (S.Order (S.Tail)) <= Next_Dist);
+               pragma Loop_Invariant
+                  (for all V in 1 .. Vc =>
+                     (if S.Pos_Of (V) <= S.Tail and V /= Source then
+                        S.Parent (V) in 1 .. Vc
+                        and then S.Pos_Of (S.Parent (V)) <= S.Tail
+                        and then S.Dist (V) = S.Dist (S.Parent (V)) + 1
+                        and then Has_Edge (G, S.Parent (V), V)));
+               pragma Loop_Invariant
+                  (for all I in 1 .. Head - 1 =>
+                     (for all F in G.Offsets (S.Order (I) - 1) + 1
+                                   .. G.Offsets (S.Order (I)) =>
+                        S.Pos_Of (G.Adjacency (F)) <= S.Tail
+                        and S.Dist (G.Adjacency (F))
+                              <= S.Dist (S.Order (I)) + 1));
+               pragma Loop_Invariant
+                  (for all F in G.Offsets (U - 1) + 1 .. E =>
+                     S.Pos_Of (G.Adjacency (F)) <= S.Tail
+                     and S.Dist (G.Adjacency (F)) <= Next_Dist);
+            end loop;
+         end;
+         Head := Head + 1;
+      end loop;
+
+      --  Head = Tail + 1: every reached vertex has been processed
+      pragma Assert
+         (for all V in 1 .. Vc =>
+            (if S.Pos_Of (V) <= S.Tail then S.Pos_Of (V) < Head));
+   end BFS;
+
+end Csr_Graphs;
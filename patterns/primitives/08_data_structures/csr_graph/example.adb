@@ -0,0 +1,33 @@
+--  CSR graph built from an edge list, then breadth-first search
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Csr_Graphs;  use Csr_Graphs;
+
+procedure Example is
+
+   --  1 -> 2 -> 4 -> 6
+   --  1 -> 3 -> 4,  3 -> 5,  6 -> 1,  7 is isolated
+   Sources : constant Vertex_Array := (1, 1, 2, 3, 3, 4, 6);
+   Targets : constant Vertex_Array := (2, 3, 4, 4, 5, 6, 1);
+
+   G : Graph (Vertex_Count => 7, Edge_Count => 7);
+   S : Search (Vertex_Count => 7);
+
+begin
+   Build (G, Sources, Targets);
+
+   for V in 1 .. G.Vertex_Count loop
+      Put ("Vertex" & Integer'Image (V) & " ->");
+      for E in First_Edge (G, V) .. Last_Edge (G, V) loop
+         Put (Integer'Image (Target (G, E)));
+      end loop;
+      New_Line;
+   end loop;
+
+   BFS (G, Source => 1, S => S);
+   for V in 1 .. G.Vertex_Count loop
+      Put_Line ("Vertex" & Integer'Image (V) &
+                ": distance" & Integer'Image (Distance_To (S, V)) &
+                ", parent" & Integer'Image (Parent_Of (S, V)));
+   end loop;
+end Example;
@@ -0,0 +1,38 @@
+/*
+ * CSR graph built from an edge list, then breadth-first search
+ */
+
+#include <stdio.h>
+#include "csr_graph.h"
+
+int main(void) {
+    //   0 -> 1 -> 3 -> 5
+    //   0 -> 2 -> 3,  2 -> 4,  5 -> 0,  6 is isolated
+    uint32_t src[] = {0, 0, 1, 2, 2, 3, 5};
+    uint32_t dst[] = {1, 2, 3, 3, 4, 5, 0};
+    csr_graph g;
+    bfs_search s;
+    if (!csr_build(&g, 7, 7, src, dst) || !bfs_search_init(&s, 7)) {
+        return 1;
+    }
+
+    printf("Offsets:   ");
+    for (uint32_t v = 0; v <= g.vertex_count; v++) {
+        printf("%u ", g.offsets[v]);
+    }
+    printf("\nAdjacency: ");
+    for (uint32_t e = 0; e < g.edge_count; e++) {
+        printf("%u ", g.adjacency[e]);
+    }
+    printf("\n");
+
+    bfs(&g, 0, &s);
+    for (uint32_t v = 0; v < g.vertex_count; v++) {
+        printf("Vertex %u: distance %d, parent %lld\n",
+               v, s.dist[v], (long long)s.parent[v]);
+    }
+
+    bfs_search_destroy(&s);
+    csr_destroy(&g);
+    return 0;
+}
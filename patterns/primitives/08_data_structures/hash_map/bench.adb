@@ -0,0 +1,241 @@
+--  Benchmark: hash map vs binary search over a sorted array, on the
+--  same key sets. Lookups (half hits), then delete + insert churn
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Containers.Generic_Array_Sort;
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Hash_Maps;     use Hash_Maps;
+
+procedure Bench is
+
+   Churn : constant := 5_000;
+
+   type Key_Array is array (Natural range <>) of Integer;
+   type Key_Array_Access is access Key_Array;
+   type Map_Access is access Map;
+
+   procedure Sort is new Ada.Containers.Generic_Array_Sort
+      (Index_Type   => Natural,
+       Element_Type => Integer,
+       Array_Type   => Key_Array);
+
+   Seed : Unsigned_32;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Reinterprets the 32 random bits as a signed key, like the C cast
+   function Next_Key return Integer is
+      R : constant Unsigned_32 := Next_Random;
+   begin
+      return (if R < 2 ** 31 then Integer (R)
+              else Integer (Long_Long_Integer (R) - 2 ** 32));
+   end Next_Key;
+
+   --  The first position in Arr (0 .. Size - 1) whose element is >= Key
+   function Lower_Bound
+      (Arr : Key_Array; Size : Natural; Key : Integer) return Natural
+   is
+      Left  : Natural := 0;
+      Right : Natural := Size;
+      Mid   : Natural;
+   begin
+      while Left < Right loop
+         Mid := Left + (Right - Left) / 2;
+         if Arr (Mid) < Key then
+            Left := Mid + 1;
+         else
+            Right := Mid;
+         end if;
+      end loop;
+      return Left;
+   end Lower_Bound;
+
+   --  Keep the lookups out of line so each variant is timed as written
+   function Run_Search
+      (Arr : Key_Array; Size : Natural; Key : Integer) return Boolean
+   is
+      I : constant Natural := Lower_Bound (Arr, Size, Key);
+   begin
+      return I < Size and then Arr (I) = Key;
+   end Run_Search;
+   pragma Machine_Attribute (Run_Search, "noipa");
+
+   function Run_Find (M : Map; Key : Integer) return Boolean is
+     (Find (M, Key) /= No_Slot);
+   pragma Machine_Attribute (Run_Find, "noipa");
+
+   --  Keeping the array sorted: slice assignment shifts like memmove
+   procedure Sorted_Delete
+      (Arr : in out Key_Array; Size : in out Natural; Key : Integer)
+   is
+      I : constant Natural := Lower_Bound (Arr, Size, Key);
+   begin
+      if I < Size and then Arr (I) = Key then
+         Arr (I .. Size - 2) := Arr (I + 1 .. Size - 1);
+         Size := Size - 1;
+      end if;
+   end Sorted_Delete;
+
+   procedure Sorted_Insert
+      (Arr : in out Key_Array; Size : in out Natural; Key : Integer)
+   is
+      I : constant Natural := Lower_Bound (Arr, Size, Key);
+   begin
+      if I = Size or else Arr (I) /= Key then
+         Arr (I + 1 .. Size) := Arr (I .. Size - 1);
+         Arr (I) := Key;
+         Size := Size + 1;
+      end if;
+   end Sorted_Insert;
+
+   function Ns_Per (Elapsed : Time_Span; Count : Positive) return String is
+     (Long_Float'Image (Long_Float (To_Duration (Elapsed)) * 1.0E9
+                        / Long_Float (Count)));
+
+   procedure Bench_Size (N : Positive) is
+      Capacity : Capacity_Range := 1;
+   begin
+      while Capacity < 2 * N loop
+         Capacity := Capacity * 2;
+      end loop;
+
+      declare
+         Sorted  : constant Key_Array_Access :=
+            new Key_Array (0 .. N + Churn - 1);
+         Queries : constant Key_Array_Access := new Key_Array (0 .. N - 1);
+         Victims : constant Key_Array_Access := new Key_Array (0 .. N - 1);
+         Fresh   : constant Key_Array_Access := new Key_Array (0 .. Churn - 1);
+         M       : constant Map_Access := new Map (Capacity);
+         Size    : Natural := 0;
+         Moves   : Natural;
+         J       : Natural;
+         Tmp     : Integer;
+         Hits_S  : Natural := 0;
+         Hits_F  : Natural := 0;
+         Start   : Time;
+         Search  : Time_Span;
+         Lookup  : Time_Span;
+      begin
+         Clear (M.all);
+
+         --  N distinct keys, sorted for the binary search
+         Seed := 12345;
+         for I in 0 .. N - 1 loop
+            Sorted (I) := Next_Key;
+         end loop;
+         Sort (Sorted (0 .. N - 1));
+         for I in 0 .. N - 1 loop
+            if Size = 0 or else Sorted (Size - 1) /= Sorted (I) then
+               Sorted (Size) := Sorted (I);
+               Size := Size + 1;
+            end if;
+         end loop;
+         for I in 0 .. Size - 1 loop
+            Insert (M.all, Sorted (I), I);
+         end loop;
+
+         --  Every other query is a stored key, in random order
+         for I in 0 .. N - 1 loop
+            Queries (I) :=
+               (if I mod 2 = 1
+                then Sorted (Natural (Next_Random mod Unsigned_32 (Size)))
+                else Next_Key);
+         end loop;
+
+         Put_Line (Natural'Image (Size) & " keys (hash capacity"
+                   & Natural'Image (Capacity) & ")");
+
+         Start := Clock;
+         for I in 0 .. N - 1 loop
+            if Run_Search (Sorted.all, Size, Queries (I)) then
+               Hits_S := Hits_S + 1;
+            end if;
+         end loop;
+         Search := Clock - Start;
+
+         Start := Clock;
+         for I in 0 .. N - 1 loop
+            if Run_Find (M.all, Queries (I)) then
+               Hits_F := Hits_F + 1;
+            end if;
+         end loop;
+         Lookup := Clock - Start;
+
+         Put_Line ("  lookup: search" & Ns_Per (Search, N) & " ns   hash"
+                   & Ns_Per (Lookup, N) & " ns   (hits"
+                   & Natural'Image (Hits_S) & " /"
+                   & Natural'Image (Hits_F) & ")");
+
+         --  Churn: delete a stored key, insert a fresh one. Victims are
+         --  distinct original keys, so both structures see one sequence
+         Victims (0 .. Size - 1) := Sorted (0 .. Size - 1);
+         Moves := Natural'Min (Size, Churn);
+         for I in 0 .. Moves - 1 loop
+            J := I + Natural (Next_Random mod Unsigned_32 (Size - I));
+            Tmp := Victims (I);
+            Victims (I) := Victims (J);
+            Victims (J) := Tmp;
+            Fresh (I) := Next_Key;
+         end loop;
+
+         Start := Clock;
+         for I in 0 .. Moves - 1 loop
+            Sorted_Delete (Sorted.all, Size, Victims (I));
+            Sorted_Insert (Sorted.all, Size, Fresh (I));
+         end loop;
+         Search := Clock - Start;
+
+         Start := Clock;
+         for I in 0 .. Moves - 1 loop
+            Delete (M.all, Victims (I));
+            Insert (M.all, Fresh (I), I);
+         end loop;
+         Lookup := Clock - Start;
+
+         Put_Line ("  churn:  sorted" & Ns_Per (Search, Moves) & " ns   hash"
+                   & Ns_Per (Lookup, Moves) & " ns   (per delete + insert)");
+
+         --  Lookups again: tombstones left by the churn lengthen probes
+         Hits_S := 0;
+         Hits_F := 0;
+         Start := Clock;
+         for I in 0 .. N - 1 loop
+            if Run_Search (Sorted.all, Size, Queries (I)) then
+               Hits_S := Hits_S + 1;
+            end if;
+         end loop;
+         Search := Clock - Start;
+
+         Start := Clock;
+         for I in 0 .. N - 1 loop
+            if Run_Find (M.all, Queries (I)) then
+               Hits_F := Hits_F + 1;
+            end if;
+         end loop;
+         Lookup := Clock - Start;
+
+         Put_Line ("  lookup: search" & Ns_Per (Search, N) & " ns   hash"
+                   & Ns_Per (Lookup, N) & " ns   (hits"
+                   & Natural'Image (Hits_S) & " /"
+                   & Natural'Image (Hits_F) & ")");
+         if Size /= Length (M.all) or Hits_S /= Hits_F then
+            Put_Line ("  MISMATCH");
+         end if;
+      end;
+   end Bench_Size;
+
+begin
+   Bench_Size (1_000);
+   Bench_Size (65_536);
+   Bench_Size (1_000_000);
+end Bench;
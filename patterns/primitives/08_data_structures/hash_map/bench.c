@@ -0,0 +1,200 @@
+/*
+ * Benchmark: hash map vs binary search over a sorted array, on the
+ * same key sets. Lookups (half hits), then delete + insert churn, which
+ * the sorted array pays for with memmove
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hash_map.h"
+
+#define CHURN 5000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int cmp_int(const void *a, const void *b) {
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// The lower bound of key: the first position whose element is >= key
+static uint32_t lower_bound(const int32_t *arr, uint32_t size, int32_t key) {
+    uint32_t left = 0, right = size;
+    while (left < right) {
+        uint32_t mid = left + (right - left) / 2;
+        if (arr[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+// Keep the lookups out of line so each variant is timed as written
+__attribute__((noipa)) static int run_search(const int32_t *arr, uint32_t size,
+                                             int32_t key) {
+    uint32_t i = lower_bound(arr, size, key);
+    return i < size && arr[i] == key;
+}
+
+__attribute__((noipa)) static int run_find(const hash_map *m, int32_t key) {
+    return hm_find(m, key) != HM_NONE;
+}
+
+static void sorted_delete(int32_t *arr, uint32_t *size, int32_t key) {
+    uint32_t i = lower_bound(arr, *size, key);
+    if (i < *size && arr[i] == key) {
+        memmove(arr + i, arr + i + 1, (*size - i - 1) * sizeof *arr);
+        (*size)--;
+    }
+}
+
+static void sorted_insert(int32_t *arr, uint32_t *size, int32_t key) {
+    uint32_t i = lower_bound(arr, *size, key);
+    if (i == *size || arr[i] != key) {
+        memmove(arr + i + 1, arr + i, (*size - i) * sizeof *arr);
+        arr[i] = key;
+        (*size)++;
+    }
+}
+
+static void bench_size(uint32_t n) {
+    uint32_t capacity = 1;
+    while (capacity < 2 * n) {
+        capacity *= 2;
+    }
+    int32_t *sorted = malloc((n + CHURN) * sizeof *sorted);
+    int32_t *queries = malloc(n * sizeof *queries);
+    hash_map m;
+    if (!sorted || !queries || !hm_init(&m, capacity)) {
+        exit(1);
+    }
+
+    // n distinct keys, sorted for the binary search
+    rng_state = 12345;
+    for (uint32_t i = 0; i < n; i++) {
+        sorted[i] = (int32_t)next_random();
+    }
+    qsort(sorted, n, sizeof *sorted, cmp_int);
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (size == 0 || sorted[size - 1] != sorted[i]) {
+            sorted[size++] = sorted[i];
+        }
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        hm_insert(&m, sorted[i], (int32_t)i);
+    }
+
+    // Every other query is a stored key, in random order
+    for (uint32_t i = 0; i < n; i++) {
+        queries[i] = (i & 1) ? sorted[next_random() % size]
+                             : (int32_t)next_random();
+    }
+
+    printf("%u keys (hash capacity %u)\n", size, capacity);
+
+    long hits_search = 0, hits_find = 0;
+    double start = now_ns();
+    for (uint32_t i = 0; i < n; i++) {
+        hits_search += run_search(sorted, size, queries[i]);
+    }
+    double search_ns = (now_ns() - start) / n;
+
+    start = now_ns();
+    for (uint32_t i = 0; i < n; i++) {
+        hits_find += run_find(&m, queries[i]);
+    }
+    double find_ns = (now_ns() - start) / n;
+
+    printf("  lookup:  search %7.1f ns   hash %6.1f ns   (hits %ld / %ld)\n",
+           search_ns, find_ns, hits_search, hits_find);
+
+    // Churn: delete a stored key, insert a fresh one. Victims are
+    // distinct original keys, so both structures see the same sequence
+    int32_t *victims = malloc(n * sizeof *victims);
+    int32_t *fresh = malloc(CHURN * sizeof *fresh);
+    if (!victims || !fresh) {
+        exit(1);
+    }
+    memcpy(victims, sorted, size * sizeof *victims);
+    uint32_t churn = size < CHURN ? size : CHURN;
+    for (uint32_t i = 0; i < churn; i++) {
+        uint32_t j = i + next_random() % (size - i);
+        int32_t t = victims[i];
+        victims[i] = victims[j];
+        victims[j] = t;
+        fresh[i] = (int32_t)next_random();
+    }
+
+    start = now_ns();
+    for (uint32_t i = 0; i < churn; i++) {
+        sorted_delete(sorted, &size, victims[i]);
+        sorted_insert(sorted, &size, fresh[i]);
+    }
+    double sorted_churn_ns = (now_ns() - start) / churn;
+
+    start = now_ns();
+    for (uint32_t i = 0; i < churn; i++) {
+        hm_delete(&m, victims[i]);
+        hm_insert(&m, fresh[i], (int32_t)i);
+    }
+    double hash_churn_ns = (now_ns() - start) / churn;
+
+    printf("  churn:   sorted %7.1f ns   hash %6.1f ns   (per delete + insert)\n",
+           sorted_churn_ns, hash_churn_ns);
+
+    // Lookups again: tombstones left by the churn lengthen probes
+    hits_search = hits_find = 0;
+    start = now_ns();
+    for (uint32_t i = 0; i < n; i++) {
+        hits_search += run_search(sorted, size, queries[i]);
+    }
+    search_ns = (now_ns() - start) / n;
+
+    start = now_ns();
+    for (uint32_t i = 0; i < n; i++) {
+        hits_find += run_find(&m, queries[i]);
+    }
+    find_ns = (now_ns() - start) / n;
+
+    uint32_t tombstones = 0;
+    for (uint32_t i = 0; i < m.capacity; i++) {
+        tombstones += m.slots[i].state == HM_DELETED;
+    }
+    printf("  lookup:  search %7.1f ns   hash %6.1f ns   (hits %ld / %ld, "
+           "%u tombstones)\n",
+           search_ns, find_ns, hits_search, hits_find, tombstones);
+    if (size != m.length || hits_search != hits_find) {
+        printf("  MISMATCH: %u keys sorted, %u in the map\n", size, m.length);
+    }
+
+    free(victims);
+    free(fresh);
+    hm_destroy(&m);
+    free(sorted);
+    free(queries);
+}
+
+int main(void) {
+    bench_size(1000);
+    bench_size(65536);
+    bench_size(1000000);
+    return 0;
+}
@@ -0,0 +1,36 @@
+--  Hash map with linear probing: insert, update, find and delete
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Hash_Maps;   use Hash_Maps;
+
+procedure Example is
+
+   M : Map (Capacity => 16);
+
+   procedure Show (Key : Integer) is
+      Slot : constant Slot_Or_None := Find (M, Key);
+   begin
+      if Slot = No_Slot then
+         Put_Line (Integer'Image (Key) & " not found");
+      else
+         Put_Line (Integer'Image (Key) & " ->"
+                   & Integer'Image (Value (M, Slot))
+                   & " (slot" & Slot_Index'Image (Slot) & ")");
+      end if;
+   end Show;
+
+begin
+   Clear (M);
+
+   for K in 1 .. 5 loop
+      Insert (M, K * 100, K);
+   end loop;
+   Insert (M, 300, 33);     --  replaces the value
+   Delete (M, 200);
+
+   Show (100);
+   Show (200);
+   Show (300);
+   Show (999);
+   Put_Line ("Length:" & Natural'Image (Length (M)));
+end Example;
@@ -0,0 +1,37 @@
+/*
+ * Hash map with linear probing: insert, update, find and delete
+ */
+
+#include <stdio.h>
+#include "hash_map.h"
+
+static void show(const hash_map *m, int32_t key) {
+    uint32_t slot = hm_find(m, key);
+    if (slot == HM_NONE) {
+        printf("%d not found\n", key);
+    } else {
+        printf("%d -> %d (slot %u)\n", key, m->slots[slot].value, slot);
+    }
+}
+
+int main(void) {
+    hash_map m;
+    if (!hm_init(&m, 16)) {
+        return 1;
+    }
+
+    for (int32_t k = 1; k <= 5; k++) {
+        hm_insert(&m, k * 100, k);
+    }
+    hm_insert(&m, 300, 33);     // replaces the value
+    hm_delete(&m, 200);
+
+    show(&m, 100);
+    show(&m, 200);
+    show(&m, 300);
+    show(&m, 999);
+    printf("Length: %u\n", m.length);
+
+    hm_destroy(&m);
+    return 0;
+}
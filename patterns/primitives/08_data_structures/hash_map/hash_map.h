@@ -0,0 +1,124 @@
+/*
+ * Integer-keyed hash map: open addressing, linear probing, tombstones
+ * Capacity is a power of two; slots are indexed 0 .. capacity - 1
+ */
+
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define HM_NONE UINT32_MAX
+
+enum { HM_EMPTY = 0, HM_LIVE = 1, HM_DELETED = 2 };
+
+typedef struct {
+    int32_t key;
+    int32_t value;
+    uint8_t state;
+} hm_slot;
+
+typedef struct {
+    uint32_t capacity;
+    uint32_t mask;
+    uint32_t length;
+    hm_slot *slots;
+} hash_map;
+
+// MurmurHash3 finaliser: all key bits reach the low bits
+static inline uint32_t hm_hash(int32_t key) {
+    uint32_t h = (uint32_t)key;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// capacity must be a power of two
+static inline int hm_init(hash_map *m, uint32_t capacity) {
+    m->slots = calloc(capacity, sizeof *m->slots);
+    m->capacity = capacity;
+    m->mask = capacity - 1;
+    m->length = 0;
+    return m->slots != NULL;
+}
+
+static inline void hm_destroy(hash_map *m) {
+    free(m->slots);
+}
+
+// Returns the slot holding key, or HM_NONE
+static inline uint32_t hm_find(const hash_map *m, int32_t key) {
+    uint32_t i = hm_hash(key) & m->mask;
+    for (uint32_t d = 0; d < m->capacity; d++) {
+        const hm_slot *s = &m->slots[i];
+        if (s->state == HM_EMPTY) {
+            return HM_NONE;
+        }
+        if (s->state == HM_LIVE && s->key == key) {
+            return i;
+        }
+        i = (i + 1) & m->mask;
+    }
+    return HM_NONE;
+}
+
+// Adds key or replaces its value; returns 0 when the map is full
+static inline int hm_insert(hash_map *m, int32_t key, int32_t value) {
+    uint32_t i = hm_hash(key) & m->mask;
+    uint32_t target = HM_NONE;
+    for (uint32_t d = 0; d < m->capacity; d++) {
+        hm_slot *s = &m->slots[i];
+        if (s->state == HM_LIVE) {
+            if (s->key == key) {
+                s->value = value;
+                return 1;
+            }
+        } else {
+            if (target == HM_NONE) {
+                target = i;
+            }
+            if (s->state == HM_EMPTY) {
+                break;
+            }
+        }
+        i = (i + 1) & m->mask;
+    }
+    if (target == HM_NONE) {
+        return 0;
+    }
+    m->slots[target] = (hm_slot){key, value, HM_LIVE};
+    m->length++;
+    return 1;
+}
+
+// Removes key if present. Tombstones followed by an empty slot are
+// cleared, walking backwards
+static inline void hm_delete(hash_map *m, int32_t key) {
+    uint32_t i = hm_find(m, key);
+    if (i == HM_NONE) {
+        return;
+    }
+    m->slots[i].state = HM_DELETED;
+    m->length--;
+    for (uint32_t step = 0; step < m->capacity; step++) {
+        if (m->slots[i].state != HM_DELETED
+            || m->slots[(i + 1) & m->mask].state != HM_EMPTY) {
+            break;
+        }
+        m->slots[i].state = HM_EMPTY;
+        i = (i - 1) & m->mask;
+    }
+}
+
+static inline void hm_clear(hash_map *m) {
+    for (uint32_t i = 0; i < m->capacity; i++) {
+        m->slots[i] = (hm_slot){0, 0, HM_EMPTY};
+    }
+    m->length = 0;
+}
+
+#endif
@@ -0,0 +1,336 @@
+package body Hash_Maps is
+
+   function Next_Slot (Capacity : Capacity_Range; I : Slot_Index)
+      return Slot_Index
+   is
+     (if I = Capacity then 1 else I + 1)
+   with Pre  => I <= Capacity,
+        Post => Next_Slot'Result <= Capacity;
+
+   function Previous_Slot (Capacity : Capacity_Range; I : Slot_Index)
+      return Slot_Index
+   is
+     (if I = 1 then Capacity else I - 1)
+   with Pre  => I <= Capacity,
+        Post => Previous_Slot'Result <= Capacity
+                and then Next_Slot (Capacity, Previous_Slot'Result) = I;
+
+   function Holds (M : Map; I : Slot_Index; Key : Integer) return Boolean is
+     (M.Slots (I).State = Live and M.Slots (I).Key = Key)
+   with Ghost,
+        Pre => I <= M.Capacity;
+
+   ------------------
+   -- Ghost lemmas --
+   ------------------
+
+   --  Changing the state of one slot changes the live count by at most one
+   procedure Lemma_Count_Update
+      (Old_Slots, New_Slots : Slot_Array;
+       P                    : Slot_Index)
+      with Ghost,
+           Pre  => Old_Slots'First = 1
+                   and then New_Slots'First = 1
+                   and then Old_Slots'Last = New_Slots'Last
+                   and then P <= Old_Slots'Last
+                   and then (for all I in Old_Slots'Range =>
+                               (if I /= P then
+                                  Old_Slots (I).State = New_Slots (I).State)),
+           Post => Live_Count (New_Slots, New_Slots'Last)
+                     = Live_Count (Old_Slots, Old_Slots'Last)
+                       - (if Old_Slots (P).State = Live then 1 else 0)
+                       + (if New_Slots (P).State = Live then 1 else 0)
+   is
+   begin
+      for Upto in 1 .. Old_Slots'Last loop
+         pragma Loop_Invariant
+            (if Upto < P then
+               Live_Count (New_Slots, Upto) = Live_Count (Old_Slots, Upto)
+             else
+               Live_Count (New_Slots, Upto)
+                 = Live_Count (Old_Slots, Upto)
+                   - (if Old_Slots (P).State = Live then 1 else 0)
+                   + (if New_Slots (P).State = Live then 1 else 0));
+      end loop;
+   end Lemma_Count_Update;
+
+   --  Fewer live slots than slots: some slot is free
+   procedure Lemma_Has_Free (Slots : Slot_Array)
+      with Ghost,
+           Pre  => Slots'First = 1
+                   and then Live_Count (Slots, Slots'Last) < Slots'Last,
+           Post => (for some I in Slots'Range => Slots (I).State /= Live)
+   is
+   begin
+      for Upto in 1 .. Slots'Last loop
+         pragma Loop_Invariant
+            (if (for all I in 1 .. Upto => Slots (I).State = Live)
+             then Live_Count (Slots, Upto) = Upto);
+      end loop;
+   end Lemma_Has_Free;
+
+   procedure Lemma_Count_Empty (Slots : Slot_Array)
+      with Ghost,
+           Pre  => Slots'First = 1
+                   and then (for all I in Slots'Range =>
+                               Slots (I).State = Empty),
+           Post => Live_Count (Slots, Slots'Last) = 0
+   is
+   begin
+      for Upto in 1 .. Slots'Last loop
+         pragma Loop_Invariant (Live_Count (Slots, Upto) = 0);
+      end loop;
+   end Lemma_Count_Empty;
+
+   --  A probe for Key that saw no match in its first Stop slots and then
+   --  hit an empty slot (or went all the way round) proves Key absent:
+   --  a live copy further on would have an empty slot on its probe path
+   procedure Lemma_Absent (M : Map; Key : Integer; Stop : Natural)
+      with Ghost,
+           Pre  => Is_Valid (M)
+                   and then Stop <= M.Capacity
+                   and then (for all E in 0 .. Stop - 1 =>
+                               not Holds (M,
+                                          Slot_At (M.Capacity,
+                                                   Home (M.Capacity, Key),
+                                                   E),
+                                          Key))
+                   and then
+                     (Stop = M.Capacity
+                      or else M.Slots (Slot_At (M.Capacity,
+                                                Home (M.Capacity, Key),
+                                                Stop)).State = Empty),
+           Post => not Has_Key (M, Key)
+   is
+      H : constant Slot_Index := Home (M.Capacity, Key);
+   begin
+      for I in 1 .. M.Capacity loop
+         if Holds (M, I, Key) then
+            pragma Assert (Home_Of (M, I) = H);
+            pragma Assert (Is_Reachable (M, I));
+            pragma Assert (Slot_At (M.Capacity, H, Home_Distance (M, I)) = I);
+            if Home_Distance (M, I) >= Stop then
+               pragma Assert
+                  (M.Slots (Slot_At (M.Capacity, H, Stop)).State /= Empty);
+            end if;
+            pragma Assert (False);
+         end if;
+         pragma Loop_Invariant
+            (for all J in 1 .. I => not Holds (M, J, Key));
+      end loop;
+   end Lemma_Absent;
+
+   --  A deleted slot followed by an empty one lies on no live key's probe
+   --  path: a path through it would continue into the empty slot
+   procedure Lemma_Trim (M : Map; C : Slot_Index)
+      with Ghost,
+           Pre  => Is_Valid (M)
+                   and then C <= M.Capacity
+                   and then M.Slots (C).State = Deleted
+                   and then M.Slots (Next_Slot (M.Capacity, C)).State = Empty,
+           Post => (for all I in 1 .. M.Capacity =>
+                      (if M.Slots (I).State = Live then
+                         (for all D in 0 .. Home_Distance (M, I) =>
+                            Slot_At (M.Capacity, Home_Of (M, I), D) /= C)))
+   is
+   begin
+      for I in 1 .. M.Capacity loop
+         if M.Slots (I).State = Live then
+            for D in 0 .. Home_Distance (M, I) loop
+               if Slot_At (M.Capacity, Home_Of (M, I), D) = C then
+                  pragma Assert (D < Home_Distance (M, I));
+                  pragma Assert
+                     (Slot_At (M.Capacity, Home_Of (M, I), D + 1)
+                        = Next_Slot (M.Capacity, C));
+                  pragma Assert (False);
+               end if;
+               pragma Loop_Invariant
+                  (for all E in 0 .. D =>
+                     Slot_At (M.Capacity, Home_Of (M, I), E) /= C);
+            end loop;
+         end if;
+         pragma Loop_Invariant
+            (for all J in 1 .. I =>
+               (if M.Slots (J).State = Live then
+                  (for all D in 0 .. Home_Distance (M, J) =>
+                     Slot_At (M.Capacity, Home_Of (M, J), D) /= C)));
+      end loop;
+   end Lemma_Trim;
+
+   ----------
+   -- Hash --
+   ----------
+
+   --  The 32-bit finaliser of MurmurHash3: every input bit affects every
+   --  output bit, so masking off the low bits is a fair home slot
+   function Hash (Key : Integer) return Unsigned_32 is
+      H : Unsigned_32 := Unsigned_32'Mod (Key);
+   begin
+      H := H xor Shift_Right (H, 16);
+      H := H * 16#85EB_CA6B#;
+      H := H xor Shift_Right (H, 13);
+      H := H * 16#C2B2_AE35#;
+      H := H xor Shift_Right (H, 16);
+      return H;
+   end Hash;
+
+   ----------
+   -- Find --
+   ----------
+
+   function Find (M : Map; Key : Integer) return Slot_Or_None is
+      H      : constant Slot_Index := Home (M.Capacity, Key);
+      Cursor : Slot_Index := H;
+   begin
+      for D in 0 .. M.Capacity - 1 loop
+         pragma Loop_Invariant (Cursor = Slot_At (M.Capacity, H, D));
+         pragma Loop_Invariant
+            (for all E in 0 .. D - 1 =>
+               not Holds (M, Slot_At (M.Capacity, H, E), Key));
+
+         case M.Slots (Cursor).State is
+            when Empty =>
+               Lemma_Absent (M, Key, D);
+               return No_Slot;
+            when Live =>
+               if M.Slots (Cursor).Key = Key then
+                  return Cursor;
+               end if;
+            when Deleted =>
+               null;
+         end case;
+
+         Cursor := Next_Slot (M.Capacity, Cursor);
+      end loop;
+
+      --  Went all the way round: the table has no empty slot
+      Lemma_Absent (M, Key, M.Capacity);
+      return No_Slot;
+   end Find;
+
+   ------------
+   -- Insert --
+   ------------
+
+   procedure Insert (M : in out Map; Key : Integer; Value : Integer) is
+      H         : constant Slot_Index := Home (M.Capacity, Key);
+      Cursor    : Slot_Index := H;
+      Target    : Slot_Or_None := No_Slot;
+      Target_D  : Natural := 0;
+      Stop      : Natural := M.Capacity;
+      Old_Slots : constant Slot_Array := M.Slots with Ghost;
+   begin
+      --  One probe: look for Key, and remember the first free slot
+      for D in 0 .. M.Capacity - 1 loop
+         pragma Loop_Invariant (M.Slots = Old_Slots);
+         pragma Loop_Invariant (Cursor = Slot_At (M.Capacity, H, D));
+         pragma Loop_Invariant
+            (for all E in 0 .. D - 1 =>
+               M.Slots (Slot_At (M.Capacity, H, E)).State /= Empty
+               and not Holds (M, Slot_At (M.Capacity, H, E), Key));
+         pragma Loop_Invariant
+            (if Target = No_Slot then
+               (for all E in 0 .. D - 1 =>
+                  M.Slots (Slot_At (M.Capacity, H, E)).State = Live)
+             else
+               Target_D < D
+               and then Target = Slot_At (M.Capacity, H, Target_D)
+               and then M.Slots (Target).State = Deleted);
+
+         case M.Slots (Cursor).State is
+            when Live =>
+               if M.Slots (Cursor).Key = Key then
+                  M.Slots (Cursor).Value := Value;
+                  return;
+               end if;
+            when Empty =>
+               Stop := D;
+               if Target = No_Slot then
+                  Target := Cursor;
+                  Target_D := D;
+               end if;
+               exit;
+            when Deleted =>
+               if Target = No_Slot then
+                  Target := Cursor;
+                  Target_D := D;
+               end if;
+         end case;
+
+         Cursor := Next_Slot (M.Capacity, Cursor);
+      end loop;
+
+      Lemma_Absent (M, Key, Stop);
+      pragma Assert (not Has_Key (M, Key));
+      pragma Assert (Length (M) < M.Capacity);
+
+      --  A full probe that met no free slot has seen every slot live,
+      --  which the live count rules out
+      if Target = No_Slot then
+         Lemma_Has_Free (M.Slots);
+         pragma Assert
+            (for all I in 1 .. M.Capacity =>
+               I = Slot_At (M.Capacity, H, Distance (M.Capacity, H, I)));
+         pragma Assert (False);
+      end if;
+
+      M.Slots (Target) := (Key => Key, Value => Value, State => Live);
+      M.Length := M.Length + 1;
+      Lemma_Count_Update (Old_Slots, M.Slots, Target);
+      pragma Assert (Home_Distance (M, Target) = Target_D);
+   end Insert;
+
+   ------------
+   -- Delete --
+   ------------
+
+   procedure Delete (M : in out Map; Key : Integer) is
+      Found     : constant Slot_Or_None := Find (M, Key);
+      Cursor    : Slot_Index;
+      Old_Slots : Slot_Array (1 .. M.Capacity) := M.Slots with Ghost;
+   begin
+      if Found = No_Slot then
+         return;
+      end if;
+
+      M.Slots (Found).State := Deleted;
+      M.Length := M.Length - 1;
+      Lemma_Count_Update (Old_Slots, M.Slots, Found);
+
+      --  Trim: a tombstone followed by an empty slot ends no probe path,
+      --  so it can become empty too, and so on backwards
+      Cursor := Found;
+      for Step in 1 .. M.Capacity loop
+         pragma Loop_Invariant (Is_Valid (M));
+         pragma Loop_Invariant (not Has_Key (M, Key));
+         pragma Loop_Invariant (Length (M) = Length (M'Loop_Entry));
+         pragma Loop_Invariant
+            (for all I in 1 .. M.Capacity =>
+               (if M.Slots (I).State = Live then
+                  M.Slots'Loop_Entry (I) = M.Slots (I))
+               and (if M.Slots'Loop_Entry (I).State = Live then
+                      M.Slots (I).State = Live));
+
+         exit when M.Slots (Cursor).State /= Deleted
+           or else M.Slots (Next_Slot (M.Capacity, Cursor)).State /= Empty;
+
+         Lemma_Trim (M, Cursor);
+         Old_Slots := M.Slots;
+         M.Slots (Cursor).State := Empty;
+         Lemma_Count_Update (Old_Slots, M.Slots, Cursor);
+         Cursor := Previous_Slot (M.Capacity, Cursor);
+      end loop;
+   end Delete;
+
+   -----------
+   -- Clear --
+   -----------
+
+   procedure Clear (M : in out Map) is
+   begin
+      M.Slots := (others => (Key => 0, Value => 0, State => Empty));
+      M.Length := 0;
+      Lemma_Count_Empty (M.Slots);
+   end Clear;
+
+end Hash_Maps;
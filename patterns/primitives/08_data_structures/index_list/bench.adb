@@ -0,0 +1,199 @@
+--  Benchmark: access-type list (one allocation per node) vs index list
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Ada.Unchecked_Deallocation;
+with Interfaces;    use Interfaces;
+with Index_Lists;   use Index_Lists;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Churn  : constant := 1_000_000;
+   Passes : constant := 20;
+
+   --  The pointer-based list the index list replaces
+   type Ptr_Node;
+   type Ptr_Node_Access is access Ptr_Node;
+   type Ptr_Node is record
+      Value : Integer;
+      Prev  : Ptr_Node_Access;
+      Next  : Ptr_Node_Access;
+   end record;
+
+   procedure Free is
+      new Ada.Unchecked_Deallocation (Ptr_Node, Ptr_Node_Access);
+
+   type Ptr_List is record
+      Head : Ptr_Node_Access;
+      Tail : Ptr_Node_Access;
+   end record;
+
+   procedure Ptr_Append
+      (L : in out Ptr_List; Value : Integer; Node : out Ptr_Node_Access) is
+   begin
+      Node := new Ptr_Node'(Value => Value, Prev => L.Tail, Next => null);
+      if L.Tail = null then
+         L.Head := Node;
+      else
+         L.Tail.Next := Node;
+      end if;
+      L.Tail := Node;
+   end Ptr_Append;
+
+   procedure Ptr_Insert_After
+      (L     : in out Ptr_List;
+       After : Ptr_Node_Access;
+       Value : Integer;
+       Node  : out Ptr_Node_Access) is
+   begin
+      Node := new Ptr_Node'(Value => Value, Prev => After, Next => After.Next);
+      if After.Next = null then
+         L.Tail := Node;
+      else
+         After.Next.Prev := Node;
+      end if;
+      After.Next := Node;
+   end Ptr_Insert_After;
+
+   procedure Ptr_Remove (L : in out Ptr_List; Node : in out Ptr_Node_Access)
+   is
+   begin
+      if Node.Prev = null then
+         L.Head := Node.Next;
+      else
+         Node.Prev.Next := Node.Next;
+      end if;
+      if Node.Next = null then
+         L.Tail := Node.Prev;
+      else
+         Node.Next.Prev := Node.Prev;
+      end if;
+      Free (Node);
+   end Ptr_Remove;
+
+   function Ptr_Sum (L : Ptr_List) return Long_Long_Integer is
+      Result : Long_Long_Integer := 0;
+      Node   : Ptr_Node_Access := L.Head;
+   begin
+      while Node /= null loop
+         Result := Result + Long_Long_Integer (Node.Value);
+         Node := Node.Next;
+      end loop;
+      return Result;
+   end Ptr_Sum;
+   pragma Machine_Attribute (Ptr_Sum, "noipa");
+
+   function Index_Sum (L : List) return Long_Long_Integer is
+     (Sum (L));
+   pragma Machine_Attribute (Index_Sum, "noipa");
+
+   type List_Access is access List;
+   type Ptr_Handles is array (1 .. N) of Ptr_Node_Access;
+   type Ptr_Handles_Access is access Ptr_Handles;
+   type Index_Handles is array (1 .. N) of Link;
+   type Index_Handles_Access is access Index_Handles;
+
+   PL     : Ptr_List;
+   IL     : constant List_Access := new List (Capacity => N);
+   PH     : constant Ptr_Handles_Access := new Ptr_Handles;
+   IH     : constant Index_Handles_Access := new Index_Handles;
+   Seed   : Unsigned_32;
+   Check  : Long_Long_Integer := 0;
+   Start  : Time;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   procedure Report (Label : String; Count : Positive) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Count)) &
+                " ns/node");
+   end Report;
+
+begin
+   Clear (IL.all);
+
+   --  Build
+   Start := Clock;
+   for I in 1 .. N loop
+      Ptr_Append (PL, I, PH (I));
+   end loop;
+   Report ("access list, append             :", N);
+
+   Start := Clock;
+   for I in 1 .. N loop
+      Append (IL.all, I, IH (I));
+   end loop;
+   Report ("index list, append              :", N);
+
+   --  Traverse in allocation order
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Ptr_Sum (PL);
+   end loop;
+   Report ("access list, traverse (in order):", N * Passes);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Index_Sum (IL.all);
+   end loop;
+   Report ("index list, traverse (in order) :", N * Passes);
+
+   --  Churn: remove a random node, insert after another random node.
+   --  Afterwards the link order no longer follows the memory order
+   Seed := 12345;
+   Start := Clock;
+   for I in 1 .. Churn loop
+      declare
+         K : constant Positive := Positive (Next_Random mod N) + 1;
+         J : constant Positive := Positive (Next_Random mod N) + 1;
+      begin
+         if J /= K then
+            Ptr_Remove (PL, PH (K));
+            Ptr_Insert_After (PL, PH (J), I, PH (K));
+         end if;
+      end;
+   end loop;
+   Report ("access list, remove + insert    :", Churn);
+
+   Seed := 12345;
+   Start := Clock;
+   for I in 1 .. Churn loop
+      declare
+         K : constant Positive := Positive (Next_Random mod N) + 1;
+         J : constant Positive := Positive (Next_Random mod N) + 1;
+      begin
+         if J /= K then
+            Remove (IL.all, IH (K));
+            Insert_After (IL.all, IH (J), I, IH (K));
+         end if;
+      end;
+   end loop;
+   Report ("index list, remove + insert     :", Churn);
+
+   --  Traverse in shuffled order: every step is a dependent cache miss
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Ptr_Sum (PL);
+   end loop;
+   Report ("access list, traverse (shuffled):", N * Passes);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Check := Check + Index_Sum (IL.all);
+   end loop;
+   Report ("index list, traverse (shuffled) :", N * Passes);
+
+   Put_Line ("checksum:" & Long_Long_Integer'Image (Check));
+end Bench;
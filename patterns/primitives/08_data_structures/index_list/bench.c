@@ -0,0 +1,140 @@
+/*
+ * Benchmark: malloc-per-node list vs index list
+ * Build, traverse, random remove/insert churn, traverse again
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "index_list.h"
+
+#define N      1000000
+#define CHURN  1000000
+#define PASSES 20
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Keep the traversals out of line so each variant is timed as written
+__attribute__((noipa)) static int64_t run_ptr_sum(const ptr_list *l) {
+    return ptr_list_sum(l);
+}
+
+__attribute__((noipa)) static int64_t run_index_sum(const index_list *l) {
+    return index_list_sum(l);
+}
+
+static void report(const char *label, double start, double count) {
+    printf("%-34s: %.3f ns/node\n", label, (now_ns() - start) / count);
+}
+
+int main(void) {
+    ptr_list pl;
+    index_list il;
+    ptr_node **ptr_handles = malloc(N * sizeof *ptr_handles);
+    uint32_t *index_handles = malloc(N * sizeof *index_handles);
+    if (!ptr_handles || !index_handles || !index_list_init(&il, N)) {
+        return 1;
+    }
+    ptr_list_init(&pl);
+    int64_t checksum = 0;
+
+    // Build
+    double start = now_ns();
+    for (int i = 0; i < N; i++) {
+        ptr_handles[i] = ptr_list_append(&pl, i);
+        if (!ptr_handles[i]) {
+            return 1;
+        }
+    }
+    report("malloc list, append", start, N);
+
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        index_handles[i] = index_list_append(&il, i);
+    }
+    report("index list, append", start, N);
+
+    // Traverse in allocation order
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        checksum += run_ptr_sum(&pl);
+    }
+    report("malloc list, traverse (in order)", start, (double)N * PASSES);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        checksum += run_index_sum(&il);
+    }
+    report("index list, traverse (in order)", start, (double)N * PASSES);
+
+    // Churn: remove a random node, insert after another random node.
+    // Afterwards the link order no longer follows the memory order
+    rng_state = 12345;
+    start = now_ns();
+    for (int i = 0; i < CHURN; i++) {
+        uint32_t k = next_random() % N;
+        uint32_t j = next_random() % N;
+        if (j == k) {
+            continue;
+        }
+        ptr_list_remove(&pl, ptr_handles[k]);
+        ptr_handles[k] = ptr_list_insert_after(&pl, ptr_handles[j], i);
+        if (!ptr_handles[k]) {
+            return 1;
+        }
+    }
+    report("malloc list, remove + insert", start, CHURN);
+
+    rng_state = 12345;
+    start = now_ns();
+    for (int i = 0; i < CHURN; i++) {
+        uint32_t k = next_random() % N;
+        uint32_t j = next_random() % N;
+        if (j == k) {
+            continue;
+        }
+        index_list_remove(&il, index_handles[k]);
+        index_handles[k] = index_list_insert_after(&il, index_handles[j], i);
+    }
+    report("index list, remove + insert", start, CHURN);
+
+    // Traverse in shuffled order: every step is a dependent cache miss
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        checksum += run_ptr_sum(&pl);
+    }
+    report("malloc list, traverse (shuffled)", start, (double)N * PASSES);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        checksum += run_index_sum(&il);
+    }
+    report("index list, traverse (shuffled)", start, (double)N * PASSES);
+
+    // Teardown: N frees vs three
+    start = now_ns();
+    ptr_list_free(&pl);
+    report("malloc list, free all", start, N);
+
+    start = now_ns();
+    index_list_destroy(&il);
+    report("index list, free all", start, N);
+
+    printf("checksum: %lld\n", (long long)checksum);
+    free(ptr_handles);
+    free(index_handles);
+    return 0;
+}
@@ -0,0 +1,40 @@
+--  Doubly-linked list stored in a node array
+--  Links are indices, free nodes are kept on an index stack
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Index_Lists; use Index_Lists;
+
+procedure Example is
+
+   procedure Print (Label : String; L : List) is
+      Position : Link := First (L);
+   begin
+      Put (Label);
+      for Step in 1 .. L.Capacity loop
+         exit when Position = No_Node;
+         Put (Integer'Image (Element (L, Position)) & " ");
+         Position := Next (L, Position);
+      end loop;
+      Put_Line ("(length" & Natural'Image (Length (L)) & ")");
+   end Print;
+
+   L                : List (Capacity => 8);
+   Two, Three, Four : Link;
+   Five             : Link;
+
+begin
+   Clear (L);
+
+   Append (L, 2, Two);
+   Append (L, 4, Four);
+   Insert_After (L, Two, 3, Three);
+   Print ("List:    ", L);
+
+   --  The freed node is reused by the next insertion
+   Remove (L, Two);
+   Print ("Removed: ", L);
+   Append (L, 5, Five);
+   Print ("Append:  ", L);
+   Put_Line ("Node reused: " & (if Five = Two then "yes" else "no"));
+   Put_Line ("Sum:" & Long_Long_Integer'Image (Sum (L)));
+end Example;
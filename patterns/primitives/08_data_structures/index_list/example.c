@@ -0,0 +1,38 @@
+/*
+ * Doubly-linked list stored in a node array
+ * Links are indices, free nodes are kept on an index stack
+ */
+
+#include <stdio.h>
+#include "index_list.h"
+
+static void print_list(const char *label, const index_list *l) {
+    printf("%s", label);
+    for (uint32_t n = l->head; n != NO_NODE; n = l->nodes[n].next) {
+        printf("%d ", l->nodes[n].value);
+    }
+    printf("(length %u)\n", index_list_length(l));
+}
+
+int main(void) {
+    index_list l;
+    if (!index_list_init(&l, 8)) {
+        return 1;
+    }
+
+    uint32_t two = index_list_append(&l, 2);
+    index_list_append(&l, 4);
+    index_list_insert_after(&l, two, 3);
+    print_list("List:    ", &l);
+
+    // The freed node is reused by the next insertion
+    index_list_remove(&l, two);
+    print_list("Removed: ", &l);
+    uint32_t five = index_list_append(&l, 5);
+    print_list("Append:  ", &l);
+    printf("Node reused: %s\n", five == two ? "yes" : "no");
+    printf("Sum: %lld\n", (long long)index_list_sum(&l));
+
+    index_list_destroy(&l);
+    return 0;
+}
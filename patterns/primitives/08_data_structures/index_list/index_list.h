@@ -0,0 +1,227 @@
+/*
+ * Doubly-linked lists: one node per malloc vs one node array
+ */
+
+#ifndef INDEX_LIST_H
+#define INDEX_LIST_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* ---- Pointer list: one malloc per node ---- */
+
+typedef struct ptr_node {
+    int value;
+    struct ptr_node *prev;
+    struct ptr_node *next;
+} ptr_node;
+
+typedef struct {
+    ptr_node *head;
+    ptr_node *tail;
+    size_t length;
+} ptr_list;
+
+static inline void ptr_list_init(ptr_list *l) {
+    l->head = NULL;
+    l->tail = NULL;
+    l->length = 0;
+}
+
+// Returns NULL when malloc fails
+static inline ptr_node *ptr_list_append(ptr_list *l, int value) {
+    ptr_node *n = malloc(sizeof *n);
+    if (!n) {
+        return NULL;
+    }
+    n->value = value;
+    n->prev = l->tail;
+    n->next = NULL;
+    if (l->tail) {
+        l->tail->next = n;
+    } else {
+        l->head = n;
+    }
+    l->tail = n;
+    l->length++;
+    return n;
+}
+
+static inline ptr_node *ptr_list_insert_after(ptr_list *l, ptr_node *after, int value) {
+    ptr_node *n = malloc(sizeof *n);
+    if (!n) {
+        return NULL;
+    }
+    n->value = value;
+    n->prev = after;
+    n->next = after->next;
+    if (after->next) {
+        after->next->prev = n;
+    } else {
+        l->tail = n;
+    }
+    after->next = n;
+    l->length++;
+    return n;
+}
+
+// n must belong to l; it is freed, so every copy of the pointer dangles
+static inline void ptr_list_remove(ptr_list *l, ptr_node *n) {
+    if (n->prev) {
+        n->prev->next = n->next;
+    } else {
+        l->head = n->next;
+    }
+    if (n->next) {
+        n->next->prev = n->prev;
+    } else {
+        l->tail = n->prev;
+    }
+    free(n);
+    l->length--;
+}
+
+static inline int64_t ptr_list_sum(const ptr_list *l) {
+    int64_t sum = 0;
+    for (const ptr_node *n = l->head; n; n = n->next) {
+        sum += n->value;
+    }
+    return sum;
+}
+
+static inline void ptr_list_free(ptr_list *l) {
+    ptr_node *n = l->head;
+    while (n) {
+        ptr_node *next = n->next;
+        free(n);
+        n = next;
+    }
+    ptr_list_init(l);
+}
+
+/* ---- Index list: nodes in one array, links are indices ---- */
+
+// Index 0 is the null link; nodes are 1 .. capacity, as in the Ada version
+#define NO_NODE 0
+
+typedef struct {
+    int value;
+    uint32_t prev;
+    uint32_t next;
+} index_node;
+
+// slots[1 .. free_count] is the free stack, slots[free_count + 1 ..] the
+// nodes in use; slot_of is the inverse permutation
+typedef struct {
+    uint32_t capacity;
+    uint32_t free_count;
+    uint32_t head;
+    uint32_t tail;
+    index_node *nodes;
+    uint32_t *slots;
+    uint32_t *slot_of;
+} index_list;
+
+// One allocation for the whole list; returns 0 when malloc fails
+static inline int index_list_init(index_list *l, uint32_t capacity) {
+    l->nodes = malloc((capacity + 1) * sizeof *l->nodes);
+    l->slots = malloc((capacity + 1) * sizeof *l->slots);
+    l->slot_of = malloc((capacity + 1) * sizeof *l->slot_of);
+    if (!l->nodes || !l->slots || !l->slot_of) {
+        free(l->nodes);
+        free(l->slots);
+        free(l->slot_of);
+        return 0;
+    }
+    l->capacity = capacity;
+    for (uint32_t i = 1; i <= capacity; i++) {
+        l->slots[i] = i;
+        l->slot_of[i] = i;
+    }
+    l->free_count = capacity;
+    l->head = NO_NODE;
+    l->tail = NO_NODE;
+    return 1;
+}
+
+static inline void index_list_destroy(index_list *l) {
+    free(l->nodes);
+    free(l->slots);
+    free(l->slot_of);
+}
+
+static inline uint32_t index_list_length(const index_list *l) {
+    return l->capacity - l->free_count;
+}
+
+// Caller checks the list is not full (free_count > 0)
+static inline uint32_t index_list_allocate(index_list *l, int value) {
+    uint32_t n = l->slots[l->free_count--];
+    l->nodes[n].value = value;
+    return n;
+}
+
+static inline void index_list_release(index_list *l, uint32_t n) {
+    uint32_t slot = l->slot_of[n];
+    uint32_t top = l->free_count + 1;
+    uint32_t other = l->slots[top];
+    l->slots[slot] = other;
+    l->slot_of[other] = slot;
+    l->slots[top] = n;
+    l->slot_of[n] = top;
+    l->free_count = top;
+}
+
+static inline uint32_t index_list_append(index_list *l, int value) {
+    uint32_t n = index_list_allocate(l, value);
+    l->nodes[n].prev = l->tail;
+    l->nodes[n].next = NO_NODE;
+    if (l->tail != NO_NODE) {
+        l->nodes[l->tail].next = n;
+    } else {
+        l->head = n;
+    }
+    l->tail = n;
+    return n;
+}
+
+static inline uint32_t index_list_insert_after(index_list *l, uint32_t after, int value) {
+    uint32_t succ = l->nodes[after].next;
+    uint32_t n = index_list_allocate(l, value);
+    l->nodes[n].prev = after;
+    l->nodes[n].next = succ;
+    l->nodes[after].next = n;
+    if (succ != NO_NODE) {
+        l->nodes[succ].prev = n;
+    } else {
+        l->tail = n;
+    }
+    return n;
+}
+
+static inline void index_list_remove(index_list *l, uint32_t n) {
+    uint32_t pred = l->nodes[n].prev;
+    uint32_t succ = l->nodes[n].next;
+    if (pred != NO_NODE) {
+        l->nodes[pred].next = succ;
+    } else {
+        l->head = succ;
+    }
+    if (succ != NO_NODE) {
+        l->nodes[succ].prev = pred;
+    } else {
+        l->tail = pred;
+    }
+    index_list_release(l, n);
+}
+
+static inline int64_t index_list_sum(const index_list *l) {
+    const index_node *nodes = l->nodes;
+    int64_t sum = 0;
+    for (uint32_t n = l->head; n != NO_NODE; n = nodes[n].next) {
+        sum += nodes[n].value;
+    }
+    return sum;
+}
+
+#endif
@@ -0,0 +1,168 @@
+package body Index_Lists is
+
+   --  Take the node on top of the free stack; it is in use afterwards but
+   --  not linked yet, so only the free-list half of Is_Valid holds
+   procedure Allocate
+      (L        : in out List;
+       Value    : Integer;
+       Position : out Link)
+      with Pre  => Is_Valid (L) and then not Is_Full (L),
+           Post => Slots_Valid (L)
+               and Position in 1 .. L.Capacity
+               and not Has_Element (L'Old, Position)
+               and Has_Element (L, Position)
+               and L.Nodes (Position).Value = Value
+               and L.Free_Count = L'Old.Free_Count - 1
+               and L.Head = L'Old.Head
+               and L.Tail = L'Old.Tail
+               and L.Rank = L'Old.Rank
+               and (for all P in 1 .. L.Capacity =>
+                      (if P /= Position then
+                         L.Nodes (P) = L'Old.Nodes (P)
+                         and Has_Element (L, P) = Has_Element (L'Old, P)))
+   is
+      Top : constant Node_Index := L.Free_Count;
+   begin
+      Position := L.Slots (Top);
+      pragma Assert (L.Slot_Of (Position) = Top);
+
+      --  Every other node keeps its slot, and none of them sits at Top
+      pragma Assert
+         (for all P in 1 .. L.Capacity =>
+            (if P /= Position then L.Slot_Of (P) /= Top));
+
+      L.Free_Count := Top - 1;
+      L.Nodes (Position) := (Value => Value, Prev => No_Node, Next => No_Node);
+   end Allocate;
+
+   --  Swap Position with the slot just above the free stack, then grow
+   --  the stack over it. The node array itself is not touched
+   procedure Release (L : in out List; Position : Link)
+      with Pre  => Slots_Valid (L) and then Has_Element (L, Position),
+           Post => Slots_Valid (L)
+               and L.Free_Count = L'Old.Free_Count + 1
+               and not Has_Element (L, Position)
+               and L.Nodes = L'Old.Nodes
+               and L.Head = L'Old.Head
+               and L.Tail = L'Old.Tail
+               and L.Rank = L'Old.Rank
+               and (for all P in 1 .. L.Capacity =>
+                      (if P /= Position then
+                         Has_Element (L, P) = Has_Element (L'Old, P)))
+   is
+      --  Position is in use, so its slot is above Free_Count and there
+      --  is room for one more free node
+      Slot  : constant Node_Index := L.Slot_Of (Position);
+      Top   : constant Node_Index := L.Free_Count + 1;
+      Other : constant Node_Index := L.Slots (Top);
+   begin
+      L.Slots (Slot) := Other;
+      L.Slot_Of (Other) := Slot;
+      L.Slots (Top) := Position;
+      L.Slot_Of (Position) := Top;
+      L.Free_Count := Top;
+   end Release;
+
+   procedure Clear (L : in out List) is
+   begin
+      for I in 1 .. L.Capacity loop
+         L.Slots (I) := I;
+         L.Slot_Of (I) := I;
+         pragma Loop_Invariant
+            (for all J in 1 .. I => L.Slots (J) = J and L.Slot_Of (J) = J);
+      end loop;
+      L.Free_Count := L.Capacity;
+      L.Head := No_Node;
+      L.Tail := No_Node;
+   end Clear;
+
+   procedure Append (L : in out List; Value : Integer; Position : out Link)
+   is
+      Old_Tail : constant Link := L.Tail;
+   begin
+      Allocate (L, Value, Position);
+      L.Rank (Position) :=
+        (if Old_Tail = No_Node then 0.0 else L.Rank (Old_Tail) + 1.0);
+      L.Nodes (Position).Prev := Old_Tail;
+      if Old_Tail = No_Node then
+         L.Head := Position;
+      else
+         L.Nodes (Old_Tail).Next := Position;
+      end if;
+      L.Tail := Position;
+   end Append;
+
+   procedure Prepend (L : in out List; Value : Integer; Position : out Link)
+   is
+      Old_Head : constant Link := L.Head;
+   begin
+      Allocate (L, Value, Position);
+      L.Rank (Position) :=
+        (if Old_Head = No_Node then 0.0 else L.Rank (Old_Head) - 1.0);
+      L.Nodes (Position).Next := Old_Head;
+      if Old_Head = No_Node then
+         L.Tail := Position;
+      else
+         L.Nodes (Old_Head).Prev := Position;
+      end if;
+      L.Head := Position;
+   end Prepend;
+
+   procedure Insert_After
+      (L        : in out List;
+       After    : Link;
+       Value    : Integer;
+       Position : out Link)
+   is
+      Succ : constant Link := L.Nodes (After).Next;
+   begin
+      Allocate (L, Value, Position);
+
+      --  Halfway between the neighbours: there is always room
+      L.Rank (Position) :=
+        (if Succ = No_Node then L.Rank (After) + 1.0
+         else (L.Rank (After) + L.Rank (Succ)) / 2.0);
+      L.Nodes (Position).Prev := After;
+      L.Nodes (Position).Next := Succ;
+      L.Nodes (After).Next := Position;
+      if Succ = No_Node then
+         L.Tail := Position;
+      else
+         L.Nodes (Succ).Prev := Position;
+      end if;
+   end Insert_After;
+
+   procedure Remove (L : in out List; Position : Link) is
+      Pred : constant Link := L.Nodes (Position).Prev;
+      Succ : constant Link := L.Nodes (Position).Next;
+   begin
+      if Pred = No_Node then
+         L.Head := Succ;
+      else
+         L.Nodes (Pred).Next := Succ;
+      end if;
+      if Succ = No_Node then
+         L.Tail := Pred;
+      else
+         L.Nodes (Succ).Prev := Pred;
+      end if;
+      Release (L, Position);
+   end Remove;
+
+   function Sum (L : List) return Long_Long_Integer is
+      Result   : Long_Long_Integer := 0;
+      Position : Link := L.Head;
+   begin
+      for Step in 1 .. L.Capacity loop
+         exit when Position = No_Node;
+         Result := Result + Long_Long_Integer (L.Nodes (Position).Value);
+         Position := L.Nodes (Position).Next;
+         pragma Loop_Invariant
+            (Position = No_Node or else Has_Element (L, Position));
+         pragma Loop_Invariant
+            (abs Result <= Long_Long_Integer (Step) * 2 ** 31);
+      end loop;
+      return Result;
+   end Sum;
+
+end Index_Lists;
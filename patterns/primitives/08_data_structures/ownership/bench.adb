@@ -0,0 +1,162 @@
+--  Benchmark: owned access-type list and tree vs the same structures in a
+--  node pool. Both sides run the identical workload
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Owned_Lists;
+with Owned_Trees;
+with Pool_Lists;
+with Pool_Trees;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 20;
+
+   --  Keep the walks out of line so each variant is timed as written
+   function Owned_Checksum (L : Owned_Lists.List) return Unsigned_64 is
+     (Owned_Lists.Checksum (L));
+   pragma Machine_Attribute (Owned_Checksum, "noipa");
+
+   function Pool_Checksum (L : Pool_Lists.List) return Unsigned_64 is
+     (Pool_Lists.Checksum (L));
+   pragma Machine_Attribute (Pool_Checksum, "noipa");
+
+   function Owned_Contains
+      (T : Owned_Trees.Tree; Key : Integer) return Boolean is
+     (Owned_Trees.Contains (T, Key));
+   pragma Machine_Attribute (Owned_Contains, "noipa");
+
+   function Pool_Contains (T : Pool_Trees.Tree; Key : Integer) return Boolean
+   is
+     (Pool_Trees.Contains (T, Key));
+   pragma Machine_Attribute (Pool_Contains, "noipa");
+
+   type Pool_List_Access is access Pool_Lists.List;
+   type Pool_Tree_Access is access Pool_Trees.Tree;
+
+   OL          : Owned_Lists.List;
+   PL          : constant Pool_List_Access := new Pool_Lists.List (N);
+   OT          : Owned_Trees.Tree;
+   PT          : constant Pool_Tree_Access := new Pool_Trees.Tree (N);
+   Value       : Integer;
+   Seed        : Unsigned_32;
+   Owned_Check : Unsigned_64 := 0;
+   Pool_Check  : Unsigned_64 := 0;
+   Start       : Time;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Keys in 0 .. 2**30 - 1: few duplicates, and Key + 1 cannot overflow
+   function Next_Key return Integer is
+     (Integer (Shift_Right (Next_Random, 2)));
+
+   --  Every other lookup is for a key that was inserted
+   function Lookup_Key (I : Positive) return Integer is
+      Key : constant Integer := Next_Key;
+   begin
+      return (if I mod 2 = 1 then Key else Key + 1);
+   end Lookup_Key;
+
+   procedure Report (Label : String; Count : Positive) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Count)) &
+                " ns/op");
+   end Report;
+
+begin
+   --  List: push N values, walk it Passes times, pop everything
+   Start := Clock;
+   for I in 1 .. N loop
+      Owned_Lists.Push_Front (OL, I);
+   end loop;
+   Report ("owned list, push  :", N);
+
+   Start := Clock;
+   for I in 1 .. N loop
+      Pool_Lists.Push_Front (PL.all, I);
+   end loop;
+   Report ("pool list, push   :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Owned_Check := Owned_Check + Owned_Checksum (OL);
+   end loop;
+   Report ("owned list, walk  :", N * Passes);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Pool_Check := Pool_Check + Pool_Checksum (PL.all);
+   end loop;
+   Report ("pool list, walk   :", N * Passes);
+
+   Start := Clock;
+   for I in 1 .. N loop
+      Owned_Lists.Pop_Front (OL, Value);
+      Owned_Check := Owned_Check + Unsigned_64 (Value);
+   end loop;
+   Report ("owned list, pop   :", N);
+
+   Start := Clock;
+   for I in 1 .. N loop
+      Pool_Lists.Pop_Front (PL.all, Value);
+      Pool_Check := Pool_Check + Unsigned_64 (Value);
+   end loop;
+   Report ("pool list, pop    :", N);
+
+   --  Tree: insert N random keys, look up N more, then free the whole tree
+   Seed := 12345;
+   Start := Clock;
+   for I in 1 .. N loop
+      Owned_Trees.Insert (OT, Next_Key);
+   end loop;
+   Report ("owned tree, insert:", N);
+
+   Seed := 12345;
+   Start := Clock;
+   for I in 1 .. N loop
+      Pool_Trees.Insert (PT.all, Next_Key);
+   end loop;
+   Report ("pool tree, insert :", N);
+
+   Seed := 12345;
+   Start := Clock;
+   for I in 1 .. N loop
+      if Owned_Contains (OT, Lookup_Key (I)) then
+         Owned_Check := Owned_Check + 1;
+      end if;
+   end loop;
+   Report ("owned tree, lookup:", N);
+
+   Seed := 12345;
+   Start := Clock;
+   for I in 1 .. N loop
+      if Pool_Contains (PT.all, Lookup_Key (I)) then
+         Pool_Check := Pool_Check + 1;
+      end if;
+   end loop;
+   Report ("pool tree, lookup :", N);
+
+   Start := Clock;
+   Owned_Trees.Clear (OT);
+   Report ("owned tree, clear :", N);
+
+   Start := Clock;
+   Pool_Trees.Clear (PT.all);
+   Report ("pool tree, clear  :", N);
+
+   Put_Line ("checksum:" & Unsigned_64'Image (Owned_Check) & " (owned),"
+             & Unsigned_64'Image (Pool_Check) & " (pool)");
+end Bench;
@@ -0,0 +1,152 @@
+/*
+ * Benchmark: malloc-per-node list and tree vs the same structures in a
+ * node pool. Both sides run the identical workload
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "lists_trees.h"
+
+#define N      1000000
+#define PASSES 20
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Keys in 0 .. 2**30 - 1: few duplicates, and no overflow in the checksum
+static int next_key(void) {
+    return (int)(next_random() >> 2);
+}
+
+// Keep the walks out of line so each variant is timed as written
+__attribute__((noipa)) static uint64_t run_ptr_checksum(const list_node *l) {
+    return ptr_list_checksum(l);
+}
+
+__attribute__((noipa)) static uint64_t run_pool_checksum(const pool_list *l) {
+    return pool_list_checksum(l);
+}
+
+__attribute__((noipa)) static int run_ptr_contains(const tree_node *t, int key) {
+    return ptr_tree_contains(t, key);
+}
+
+__attribute__((noipa)) static int run_pool_contains(const pool_tree *t, int key) {
+    return pool_tree_contains(t, key);
+}
+
+static void report(const char *label, double start, double count) {
+    printf("%-32s: %.3f ns/op\n", label, (now_ns() - start) / count);
+}
+
+int main(void) {
+    list_node *pl = NULL;
+    pool_list ql;
+    tree_node *pt = NULL;
+    pool_tree qt;
+    if (!pool_list_init(&ql, N) || !pool_tree_init(&qt, N)) {
+        return 1;
+    }
+    uint64_t ptr_check = 0;
+    uint64_t pool_check = 0;
+
+    // List: push N values, walk it PASSES times, pop everything
+    double start = now_ns();
+    for (int i = 0; i < N; i++) {
+        if (!ptr_list_push(&pl, i)) {
+            return 1;
+        }
+    }
+    report("malloc list, push", start, N);
+
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        pool_list_push(&ql, i);
+    }
+    report("pool list, push", start, N);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        ptr_check += run_ptr_checksum(pl);
+    }
+    report("malloc list, walk", start, (double)N * PASSES);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        pool_check += run_pool_checksum(&ql);
+    }
+    report("pool list, walk", start, (double)N * PASSES);
+
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        ptr_check += (uint64_t)ptr_list_pop(&pl);
+    }
+    report("malloc list, pop", start, N);
+
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        pool_check += (uint64_t)pool_list_pop(&ql);
+    }
+    report("pool list, pop", start, N);
+
+    // Tree: insert N random keys, look up N more (half of them inserted),
+    // then free the whole tree
+    rng_state = 12345;
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        if (!ptr_tree_insert(&pt, next_key())) {
+            return 1;
+        }
+    }
+    report("malloc tree, insert", start, N);
+
+    rng_state = 12345;
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        pool_tree_insert(&qt, next_key());
+    }
+    report("pool tree, insert", start, N);
+
+    rng_state = 12345;
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        int key = next_key();
+        ptr_check += (uint64_t)run_ptr_contains(pt, (i & 1) ? key : key + 1);
+    }
+    report("malloc tree, lookup", start, N);
+
+    rng_state = 12345;
+    start = now_ns();
+    for (int i = 0; i < N; i++) {
+        int key = next_key();
+        pool_check += (uint64_t)run_pool_contains(&qt, (i & 1) ? key : key + 1);
+    }
+    report("pool tree, lookup", start, N);
+
+    start = now_ns();
+    ptr_tree_clear(&pt);
+    report("malloc tree, clear", start, N);
+
+    start = now_ns();
+    pool_tree_clear(&qt);
+    report("pool tree, clear", start, N);
+
+    printf("checksum: %llu (malloc), %llu (pool)\n",
+           (unsigned long long)ptr_check, (unsigned long long)pool_check);
+    pool_list_destroy(&ql);
+    pool_tree_destroy(&qt);
+    return 0;
+}
@@ -0,0 +1,57 @@
+--  The same list and tree with owned access types and with a node pool
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Interfaces;  use Interfaces;
+with Owned_Lists;
+with Owned_Trees;
+with Pool_Lists;
+with Pool_Trees;
+
+procedure Example is
+
+   Keys : constant array (1 .. 7) of Integer := (50, 30, 70, 20, 40, 60, 80);
+
+   Owned_List : Owned_Lists.List;
+   Pool_List  : Pool_Lists.List (Capacity => 8);
+   Owned_Tree : Owned_Trees.Tree;
+   Pool_Tree  : Pool_Trees.Tree (Capacity => 8);
+   Owned_Top  : Integer;
+   Pool_Top   : Integer;
+
+begin
+   --  Lists: push 1 2 3, pop one
+   for I in 1 .. 3 loop
+      Owned_Lists.Push_Front (Owned_List, I);
+      Pool_Lists.Push_Front (Pool_List, I);
+   end loop;
+   Owned_Lists.Pop_Front (Owned_List, Owned_Top);
+   Pool_Lists.Pop_Front (Pool_List, Pool_Top);
+   Put_Line ("Popped:" & Integer'Image (Owned_Top) & " (owned),"
+             & Integer'Image (Pool_Top) & " (pool)");
+   Put_Line ("Checksum:"
+             & Unsigned_64'Image (Owned_Lists.Checksum (Owned_List))
+             & " (owned),"
+             & Unsigned_64'Image (Pool_Lists.Checksum (Pool_List))
+             & " (pool)");
+
+   --  Trees
+   for Key of Keys loop
+      Owned_Trees.Insert (Owned_Tree, Key);
+      Pool_Trees.Insert (Pool_Tree, Key);
+   end loop;
+   Put_Line ("Contains 40: "
+             & Boolean'Image (Owned_Trees.Contains (Owned_Tree, 40))
+             & " (owned), "
+             & Boolean'Image (Pool_Trees.Contains (Pool_Tree, 40))
+             & " (pool)");
+   Put_Line ("Contains 45: "
+             & Boolean'Image (Owned_Trees.Contains (Owned_Tree, 45))
+             & " (owned), "
+             & Boolean'Image (Pool_Trees.Contains (Pool_Tree, 45))
+             & " (pool)");
+
+   --  Owned nodes must be released before the pointers go out of scope;
+   --  gnatprove reports a leak otherwise
+   Owned_Lists.Clear (Owned_List);
+   Owned_Trees.Clear (Owned_Tree);
+end Example;
@@ -0,0 +1,51 @@
+/*
+ * The same list and tree with malloc'd nodes and with a node pool
+ */
+
+#include <stdio.h>
+#include "lists_trees.h"
+
+int main(void) {
+    int keys[] = {50, 30, 70, 20, 40, 60, 80};
+
+    // Lists: push 1 2 3, pop one
+    list_node *pl = NULL;
+    pool_list ql;
+    if (!pool_list_init(&ql, 8)) {
+        return 1;
+    }
+    for (int i = 1; i <= 3; i++) {
+        if (!ptr_list_push(&pl, i)) {
+            return 1;
+        }
+        pool_list_push(&ql, i);
+    }
+    printf("Popped: %d (malloc), %d (pool)\n",
+           ptr_list_pop(&pl), pool_list_pop(&ql));
+    printf("Checksum: %llu (malloc), %llu (pool)\n",
+           (unsigned long long)ptr_list_checksum(pl),
+           (unsigned long long)pool_list_checksum(&ql));
+
+    // Trees
+    tree_node *pt = NULL;
+    pool_tree qt;
+    if (!pool_tree_init(&qt, 8)) {
+        return 1;
+    }
+    for (int i = 0; i < 7; i++) {
+        if (!ptr_tree_insert(&pt, keys[i])) {
+            return 1;
+        }
+        pool_tree_insert(&qt, keys[i]);
+    }
+    printf("Contains 40: %d (malloc), %d (pool)\n",
+           ptr_tree_contains(pt, 40), pool_tree_contains(&qt, 40));
+    printf("Contains 45: %d (malloc), %d (pool)\n",
+           ptr_tree_contains(pt, 45), pool_tree_contains(&qt, 45));
+
+    ptr_list_clear(&pl);
+    ptr_tree_clear(&pt);
+    pool_list_destroy(&ql);
+    pool_tree_destroy(&qt);
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * Singly-linked list and binary search tree, two ways:
+ * one malloc per node, or nodes in a pool indexed by uint32_t
+ */
+
+#ifndef LISTS_TREES_H
+#define LISTS_TREES_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define NO_NODE 0   // pool index 0 is the null link; nodes are 1 .. capacity
+
+/* ---- List, one malloc per node ---- */
+
+typedef struct list_node {
+    int value;
+    struct list_node *next;
+} list_node;
+
+// Returns 0 when malloc fails
+static inline int ptr_list_push(list_node **l, int value) {
+    list_node *n = malloc(sizeof *n);
+    if (!n) {
+        return 0;
+    }
+    n->value = value;
+    n->next = *l;
+    *l = n;
+    return 1;
+}
+
+// *l must not be NULL
+static inline int ptr_list_pop(list_node **l) {
+    list_node *n = *l;
+    int value = n->value;
+    *l = n->next;
+    free(n);
+    return value;
+}
+
+static inline uint64_t ptr_list_checksum(const list_node *l) {
+    uint64_t sum = 0;
+    for (; l; l = l->next) {
+        sum += (uint64_t)(int64_t)l->value;
+    }
+    return sum;
+}
+
+static inline void ptr_list_clear(list_node **l) {
+    while (*l) {
+        ptr_list_pop(l);
+    }
+}
+
+/* ---- List in a node pool ---- */
+
+typedef struct {
+    int value;
+    uint32_t next;
+} pool_list_node;
+
+typedef struct {
+    uint32_t capacity;
+    uint32_t head;
+    uint32_t free;      // freed nodes, threaded through next
+    uint32_t used;      // nodes 1 .. used have been handed out
+    pool_list_node *nodes;
+} pool_list;
+
+static inline int pool_list_init(pool_list *l, uint32_t capacity) {
+    l->nodes = malloc(((size_t)capacity + 1) * sizeof *l->nodes);
+    l->capacity = capacity;
+    l->head = l->free = l->used = NO_NODE;
+    return l->nodes != NULL;
+}
+
+static inline void pool_list_destroy(pool_list *l) {
+    free(l->nodes);
+}
+
+// Caller checks the pool is not full
+static inline void pool_list_push(pool_list *l, int value) {
+    uint32_t n;
+    if (l->free != NO_NODE) {
+        n = l->free;
+        l->free = l->nodes[n].next;
+    } else {
+        n = ++l->used;
+    }
+    l->nodes[n] = (pool_list_node){value, l->head};
+    l->head = n;
+}
+
+// Caller checks the list is not empty
+static inline int pool_list_pop(pool_list *l) {
+    uint32_t n = l->head;
+    l->head = l->nodes[n].next;
+    l->nodes[n].next = l->free;
+    l->free = n;
+    return l->nodes[n].value;
+}
+
+static inline uint64_t pool_list_checksum(const pool_list *l) {
+    uint64_t sum = 0;
+    for (uint32_t n = l->head; n != NO_NODE; n = l->nodes[n].next) {
+        sum += (uint64_t)(int64_t)l->nodes[n].value;
+    }
+    return sum;
+}
+
+static inline void pool_list_clear(pool_list *l) {
+    l->head = l->free = l->used = NO_NODE;
+}
+
+/* ---- Binary search tree, one malloc per node ---- */
+
+typedef struct tree_node {
+    int key;
+    struct tree_node *left;
+    struct tree_node *right;
+} tree_node;
+
+// Duplicate keys are ignored; returns 0 when malloc fails
+static inline int ptr_tree_insert(tree_node **t, int key) {
+    while (*t) {
+        if (key < (*t)->key) {
+            t = &(*t)->left;
+        } else if (key > (*t)->key) {
+            t = &(*t)->right;
+        } else {
+            return 1;
+        }
+    }
+    tree_node *n = malloc(sizeof *n);
+    if (!n) {
+        return 0;
+    }
+    n->key = key;
+    n->left = n->right = NULL;
+    *t = n;
+    return 1;
+}
+
+static inline int ptr_tree_contains(const tree_node *t, int key) {
+    while (t) {
+        if (key == t->key) {
+            return 1;
+        }
+        t = key < t->key ? t->left : t->right;
+    }
+    return 0;
+}
+
+static inline void ptr_tree_clear(tree_node **t) {
+    if (*t) {
+        ptr_tree_clear(&(*t)->left);
+        ptr_tree_clear(&(*t)->right);
+        free(*t);
+        *t = NULL;
+    }
+}
+
+/* ---- Binary search tree in a node pool ---- */
+
+// One record per node, like the malloc tree: a step down the tree
+// touches one cache line, not one per field array
+typedef struct {
+    int key;
+    uint32_t left;
+    uint32_t right;
+} pool_node;
+
+typedef struct {
+    uint32_t capacity;
+    uint32_t root;
+    uint32_t used;
+    pool_node *nodes;
+} pool_tree;
+
+static inline int pool_tree_init(pool_tree *t, uint32_t capacity) {
+    t->nodes = malloc(((size_t)capacity + 1) * sizeof *t->nodes);
+    t->capacity = capacity;
+    t->root = t->used = NO_NODE;
+    return t->nodes != NULL;
+}
+
+static inline void pool_tree_destroy(pool_tree *t) {
+    free(t->nodes);
+}
+
+// Duplicate keys are ignored; caller checks the pool is not full
+static inline void pool_tree_insert(pool_tree *t, int key) {
+    uint32_t *link = &t->root;
+    while (*link != NO_NODE) {
+        pool_node *n = &t->nodes[*link];
+        if (key < n->key) {
+            link = &n->left;
+        } else if (key > n->key) {
+            link = &n->right;
+        } else {
+            return;
+        }
+    }
+    uint32_t n = ++t->used;
+    t->nodes[n] = (pool_node){key, NO_NODE, NO_NODE};
+    *link = n;
+}
+
+static inline int pool_tree_contains(const pool_tree *t, int key) {
+    uint32_t n = t->root;
+    while (n != NO_NODE) {
+        const pool_node *node = &t->nodes[n];
+        if (key == node->key) {
+            return 1;
+        }
+        n = key < node->key ? node->left : node->right;
+    }
+    return 0;
+}
+
+static inline void pool_tree_clear(pool_tree *t) {
+    t->root = t->used = NO_NODE;
+}
+
+#endif
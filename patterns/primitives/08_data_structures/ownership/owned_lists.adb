@@ -0,0 +1,47 @@
+with Ada.Unchecked_Deallocation;
+
+package body Owned_Lists is
+
+   procedure Free is new Ada.Unchecked_Deallocation (Node, List);
+
+   procedure Push_Front (L : in out List; Value : Integer) is
+   begin
+      --  The old list moves into the new node
+      L := new Node'(Value => Value, Next => L);
+   end Push_Front;
+
+   procedure Pop_Front (L : in out List; Value : out Integer) is
+      Head : List := L;
+   begin
+      --  Move the rest of the list out before freeing the head, or the
+      --  deallocation would leak it
+      L := Head.Next;
+      Head.Next := null;
+      Value := Head.Value;
+      Free (Head);
+   end Pop_Front;
+
+   function Checksum (L : List) return Unsigned_64 is
+      Result : Unsigned_64 := 0;
+      Cursor : access constant Node := L;
+   begin
+      while Cursor /= null loop
+         pragma Loop_Variant (Structural => Cursor);
+         Result := Result + Unsigned_64'Mod (Cursor.Value);
+         Cursor := Cursor.Next;
+      end loop;
+      return Result;
+   end Checksum;
+
+   procedure Clear (L : in out List) is
+      Head : List;
+   begin
+      while L /= null loop
+         Head := L;
+         L := Head.Next;
+         Head.Next := null;
+         Free (Head);
+      end loop;
+   end Clear;
+
+end Owned_Lists;
@@ -0,0 +1,27 @@
+with Ada.Unchecked_Deallocation;
+
+package body Owned_Trees is
+
+   procedure Free is new Ada.Unchecked_Deallocation (Tree_Node, Tree);
+
+   procedure Insert (T : in out Tree; Key : Integer) is
+   begin
+      if T = null then
+         T := new Tree_Node'(Key => Key, Left => null, Right => null);
+      elsif Key < T.Key then
+         Insert (T.Left, Key);
+      elsif Key > T.Key then
+         Insert (T.Right, Key);
+      end if;
+   end Insert;
+
+   procedure Clear (T : in out Tree) is
+   begin
+      if T /= null then
+         Clear (T.Left);
+         Clear (T.Right);
+         Free (T);
+      end if;
+   end Clear;
+
+end Owned_Trees;
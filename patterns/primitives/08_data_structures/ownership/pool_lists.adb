@@ -0,0 +1,46 @@
+package body Pool_Lists is
+
+   procedure Push_Front (L : in out List; Value : Integer) is
+      N : Node_Index;
+   begin
+      if L.Free /= No_Node then
+         N := L.Free;
+         L.Free := L.Nodes (N).Next;
+      else
+         L.Used := L.Used + 1;
+         N := L.Used;
+      end if;
+      L.Nodes (N) := (Value => Value, Next => L.Head);
+      L.Head := N;
+   end Push_Front;
+
+   procedure Pop_Front (L : in out List; Value : out Integer) is
+      N : constant Node_Index := L.Head;
+   begin
+      Value := L.Nodes (N).Value;
+      L.Head := L.Nodes (N).Next;
+      L.Nodes (N).Next := L.Free;
+      L.Free := N;
+   end Pop_Front;
+
+   function Checksum (L : List) return Unsigned_64 is
+      Result : Unsigned_64 := 0;
+      Cursor : Link := L.Head;
+   begin
+      for Step in 1 .. L.Used loop
+         exit when Cursor = No_Node;
+         Result := Result + Unsigned_64'Mod (L.Nodes (Cursor).Value);
+         Cursor := L.Nodes (Cursor).Next;
+         pragma Loop_Invariant (Cursor <= L.Used);
+      end loop;
+      return Result;
+   end Checksum;
+
+   procedure Clear (L : in out List) is
+   begin
+      L.Head := No_Node;
+      L.Free := No_Node;
+      L.Used := 0;
+   end Clear;
+
+end Pool_Lists;
@@ -0,0 +1,77 @@
+package body Pool_Trees is
+
+   --  Hand out the next unused node as a leaf
+   procedure New_Leaf (T : in out Tree; Key : Integer; N : out Node_Index)
+      with Pre  => Is_Valid (T) and then not Is_Full (T),
+           Post => Is_Valid (T)
+               and N = T.Used
+               and T.Used = T.Used'Old + 1
+               and T.Root = T.Root'Old
+               and (for all I in 1 .. T.Used'Old =>
+                      T.Nodes (I) = T.Nodes'Old (I))
+   is
+   begin
+      T.Used := T.Used + 1;
+      N := T.Used;
+      T.Nodes (N) := (Key => Key, Left => No_Node, Right => No_Node);
+   end New_Leaf;
+
+   function Contains (T : Tree; Key : Integer) return Boolean is
+      Cursor : Link := T.Root;
+   begin
+      for Step in 1 .. T.Used loop
+         exit when Cursor = No_Node;
+         if Key = T.Nodes (Cursor).Key then
+            return True;
+         end if;
+         Cursor := (if Key < T.Nodes (Cursor).Key then T.Nodes (Cursor).Left
+                    else T.Nodes (Cursor).Right);
+         pragma Loop_Invariant (Cursor <= T.Used);
+      end loop;
+      return False;
+   end Contains;
+
+   procedure Insert (T : in out Tree; Key : Integer) is
+      Cursor : Link := T.Root;
+      N      : Node_Index;
+   begin
+      if Cursor = No_Node then
+         New_Leaf (T, Key, N);
+         T.Root := N;
+         return;
+      end if;
+
+      --  Each step goes to a child, which sits at a higher index
+      loop
+         pragma Loop_Invariant (Is_Valid (T));
+         pragma Loop_Invariant (Cursor in 1 .. T.Used);
+         pragma Loop_Invariant (T.Used = T.Used'Loop_Entry);
+         pragma Loop_Variant (Increases => Cursor);
+
+         if Key < T.Nodes (Cursor).Key then
+            if T.Nodes (Cursor).Left = No_Node then
+               New_Leaf (T, Key, N);
+               T.Nodes (Cursor).Left := N;
+               return;
+            end if;
+            Cursor := T.Nodes (Cursor).Left;
+         elsif Key > T.Nodes (Cursor).Key then
+            if T.Nodes (Cursor).Right = No_Node then
+               New_Leaf (T, Key, N);
+               T.Nodes (Cursor).Right := N;
+               return;
+            end if;
+            Cursor := T.Nodes (Cursor).Right;
+         else
+            return;
+         end if;
+      end loop;
+   end Insert;
+
+   procedure Clear (T : in out Tree) is
+   begin
+      T.Root := No_Node;
+      T.Used := 0;
+   end Clear;
+
+end Pool_Trees;
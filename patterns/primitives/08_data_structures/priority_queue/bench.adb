@@ -0,0 +1,96 @@
+--  Benchmark: binary vs 4-ary heap, 1K to 10M timers
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time;  use Ada.Real_Time;
+with Ada.Text_IO;    use Ada.Text_IO;
+with Interfaces;     use Interfaces;
+with Heaps;
+with Heap_Instances; use Heap_Instances;
+
+procedure Bench is
+
+   Max_N   : constant := 10_000_000;
+   Min_Ops : constant := 2_000_000;  --  at least this many operations per size
+
+   Seed  : Unsigned_32;
+   Check : Long_Long_Integer := 0;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   function Ns_Per (Elapsed : Time_Span; Count : Positive) return String is
+     (Long_Float'Image (Long_Float (To_Duration (Elapsed)) * 1.0E9
+                        / Long_Float (Count)));
+
+   --  Heapify, hold (pop the next deadline, push a later one), drain
+   generic
+      with package H is new Heaps (<>);
+   procedure Bench_Heap (N : Positive);
+
+   procedure Bench_Heap (N : Positive) is
+      type Heap_Access is access H.Heap;
+      type Keys_Access is access H.Key_Array;
+
+      Q       : constant Heap_Access := new H.Heap (Capacity => N);
+      Keys    : constant Keys_Access := new H.Key_Array (1 .. N);
+      Rounds  : constant Positive := Positive'Max (Min_Ops / N, 1);
+      Key     : Integer;
+      Start   : Time;
+      Heapify : Time_Span := Time_Span_Zero;
+      Hold    : Time_Span;
+   begin
+      for R in 1 .. Rounds loop
+         Seed := 12345;
+         for I in Keys'Range loop
+            Keys (I) := Integer (Next_Random and 16#F_FFFF#);
+         end loop;
+         Start := Clock;
+         H.Heapify (Q.all, Keys.all);
+         Heapify := Heapify + (Clock - Start);
+      end loop;
+
+      --  Timer workload: the earliest deadline fires and is re-armed
+      Seed := 999;
+      Start := Clock;
+      for I in 1 .. Rounds * N loop
+         H.Pop (Q.all, Key);
+         Check := Check + Long_Long_Integer (Key);
+         H.Push (Q.all, Key + Integer (Next_Random and 16#F_FFFF#));
+      end loop;
+      Hold := Clock - Start;
+
+      Start := Clock;
+      while H.Size (Q.all) > 0 loop
+         H.Pop (Q.all, Key);
+         Check := Check + Long_Long_Integer (Key);
+      end loop;
+
+      Put_Line (Integer'Image (N) & " timers," & Integer'Image (H.Arity) &
+                "-ary: heapify" & Ns_Per (Heapify, N * Rounds) &
+                "  hold" & Ns_Per (Hold, N * Rounds) &
+                "  pop" & Ns_Per (Clock - Start, N) & " ns/op");
+   end Bench_Heap;
+
+   procedure Bench_Binary is new Bench_Heap (Binary_Heaps);
+   procedure Bench_Quad   is new Bench_Heap (Quad_Heaps);
+   pragma Machine_Attribute (Bench_Binary, "noipa");
+   pragma Machine_Attribute (Bench_Quad, "noipa");
+
+   N : Positive := 1_000;
+
+begin
+   loop
+      Bench_Binary (N);
+      Bench_Quad (N);
+      exit when N = Max_N;
+      N := N * 10;
+   end loop;
+   Put_Line ("checksum:" & Long_Long_Integer'Image (Check));
+end Bench;
@@ -0,0 +1,94 @@
+/*
+ * Benchmark: binary vs 4-ary heap, 1K to 10M timers
+ * Heapify, hold (pop the next deadline, push a later one), drain
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "heap.h"
+
+#define MAX_N    10000000
+#define MIN_OPS  2000000    // at least this many operations per size
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static unsigned rng_state;
+
+static unsigned next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void fill_random(int *data, size_t n) {
+    rng_state = 12345;
+    for (size_t i = 0; i < n; i++) {
+        data[i] = (int)(next_random() & 0xfffff);
+    }
+}
+
+// One instance of the benchmark per arity; noipa keeps each kernel as
+// written in the timed loop
+#define DEFINE_BENCH(ARITY)                                                 \
+    __attribute__((noipa)) static long long bench##ARITY(int *data,         \
+                                                         size_t n) {        \
+        heap##ARITY h = {data, n, n};                                       \
+        long long checksum = 0;                                             \
+        size_t rounds = MIN_OPS / n > 0 ? MIN_OPS / n : 1;                  \
+                                                                            \
+        double heapify_ns = 0;                                              \
+        for (size_t r = 0; r < rounds; r++) {                               \
+            fill_random(data, n);                                           \
+            h.size = n;                                                     \
+            double start = now_ns();                                        \
+            heap##ARITY##_heapify(&h);                                      \
+            heapify_ns += now_ns() - start;                                 \
+        }                                                                   \
+                                                                            \
+        /* Timer workload: the earliest deadline fires and is re-armed */   \
+        rng_state = 999;                                                    \
+        size_t ops = rounds * n;                                            \
+        double start = now_ns();                                            \
+        for (size_t i = 0; i < ops; i++) {                                  \
+            int key = heap##ARITY##_pop(&h);                                \
+            checksum += key;                                                \
+            heap##ARITY##_push(&h, key + (int)(next_random() & 0xfffff));   \
+        }                                                                   \
+        double hold_ns = now_ns() - start;                                  \
+                                                                            \
+        start = now_ns();                                                   \
+        while (h.size > 0) {                                                \
+            checksum += heap##ARITY##_pop(&h);                              \
+        }                                                                   \
+        double drain_ns = now_ns() - start;                                 \
+                                                                            \
+        printf("%9zu timers, %d-ary: heapify %6.2f  hold %7.2f  "           \
+               "pop %7.2f ns/op\n",                                         \
+               n, ARITY, heapify_ns / ((double)n * rounds),                 \
+               hold_ns / (double)ops, drain_ns / (double)n);                \
+        return checksum;                                                    \
+    }
+
+DEFINE_BENCH(2)
+DEFINE_BENCH(4)
+
+int main(void) {
+    int *data = malloc(MAX_N * sizeof(int));
+    if (!data) {
+        return 1;
+    }
+    long long checksum = 0;
+    for (size_t n = 1000; n <= MAX_N; n *= 10) {
+        checksum += bench2(data, n);
+        checksum += bench4(data, n);
+    }
+    printf("checksum: %lld\n", checksum);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,37 @@
+--  Timer queue: a min-heap of deadlines
+--  Binary heap and 4-ary heap over a fixed array
+
+with Ada.Text_IO;    use Ada.Text_IO;
+with Heap_Instances; use Heap_Instances;
+
+procedure Example is
+
+   use Binary_Heaps;
+
+   Timers    : Heap (Capacity => 16);
+   Bulk      : Quad_Heaps.Heap (Capacity => 16);
+   Deadlines : constant Key_Array := (30, 10, 50, 20, 40);
+   Key       : Integer;
+
+begin
+   --  Push deadlines one at a time
+   for I in Deadlines'Range loop
+      Push (Timers, Deadlines (I));
+   end loop;
+   Put_Line ("Next deadline:" & Integer'Image (Peek (Timers)));
+   Put ("Expired in order:");
+   while Size (Timers) > 0 loop
+      Pop (Timers, Key);
+      Put (Integer'Image (Key));
+   end loop;
+   New_Line;
+
+   --  Build a 4-ary heap in one pass from unordered deadlines
+   Quad_Heaps.Heapify (Bulk, (42, 7, 19, 3, 25, 11));
+   Put ("4-ary heap order:");
+   while Quad_Heaps.Size (Bulk) > 0 loop
+      Quad_Heaps.Pop (Bulk, Key);
+      Put (Integer'Image (Key));
+   end loop;
+   New_Line;
+end Example;
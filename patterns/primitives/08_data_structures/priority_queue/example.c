@@ -0,0 +1,36 @@
+/*
+ * Timer queue: a min-heap of deadlines
+ * Binary heap and 4-ary heap over a fixed array
+ */
+
+#include <stdio.h>
+#include "heap.h"
+
+int main(void) {
+    int storage2[16];
+    int storage4[16] = {42, 7, 19, 3, 25, 11};
+    heap2 timers = {storage2, 0, 16};
+    heap4 bulk = {storage4, 6, 16};
+
+    // Push deadlines one at a time
+    int deadlines[] = {30, 10, 50, 20, 40};
+    for (int i = 0; i < 5; i++) {
+        heap2_push(&timers, deadlines[i]);
+    }
+    printf("Next deadline: %d\n", heap2_peek(&timers));
+    printf("Expired in order: ");
+    while (timers.size > 0) {
+        printf("%d ", heap2_pop(&timers));
+    }
+    printf("\n");
+
+    // Build a 4-ary heap in place from unordered deadlines
+    heap4_heapify(&bulk);
+    printf("4-ary heap order: ");
+    while (bulk.size > 0) {
+        printf("%d ", heap4_pop(&bulk));
+    }
+    printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Implicit d-ary min-heap over a caller-provided array
+ * 0-based: the children of i are ARITY * i + 1 .. ARITY * i + ARITY
+ */
+
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stddef.h>
+
+#define DEFINE_HEAP(ARITY)                                                  \
+    typedef struct {                                                        \
+        int *data;                                                          \
+        size_t size;                                                        \
+        size_t capacity;                                                    \
+    } heap##ARITY;                                                          \
+                                                                            \
+    /* Move key down from start, shifting smaller children into the hole */ \
+    static inline void heap##ARITY##_sift_down(heap##ARITY *h, size_t start, \
+                                               int key) {                   \
+        int *data = h->data;                                                \
+        size_t size = h->size;                                              \
+        size_t hole = start;                                                \
+        for (;;) {                                                          \
+            size_t first = ARITY * hole + 1;                                \
+            if (first >= size) {                                            \
+                break;                                                      \
+            }                                                               \
+            size_t last = first + ARITY < size ? first + ARITY : size;      \
+            size_t best = first;                                            \
+            /* Select, not branch: the comparisons are unpredictable */     \
+            for (size_t c = first + 1; c < last; c++) {                     \
+                best = data[c] < data[best] ? c : best;                     \
+            }                                                               \
+            if (data[best] >= key) {                                        \
+                break;                                                      \
+            }                                                               \
+            data[hole] = data[best];                                        \
+            hole = best;                                                    \
+        }                                                                   \
+        data[hole] = key;                                                   \
+    }                                                                       \
+                                                                            \
+    /* Caller checks size < capacity */                                     \
+    static inline void heap##ARITY##_push(heap##ARITY *h, int key) {        \
+        int *data = h->data;                                                \
+        size_t hole = h->size++;                                            \
+        while (hole > 0 && data[(hole - 1) / ARITY] > key) {                \
+            data[hole] = data[(hole - 1) / ARITY];                          \
+            hole = (hole - 1) / ARITY;                                      \
+        }                                                                   \
+        data[hole] = key;                                                   \
+    }                                                                       \
+                                                                            \
+    /* Caller checks size > 0 */                                            \
+    static inline int heap##ARITY##_peek(const heap##ARITY *h) {            \
+        return h->data[0];                                                  \
+    }                                                                       \
+                                                                            \
+    /* Caller checks size > 0 */                                            \
+    static inline int heap##ARITY##_pop(heap##ARITY *h) {                   \
+        int key = h->data[0];                                               \
+        int last = h->data[--h->size];                                      \
+        if (h->size > 0) {                                                  \
+            heap##ARITY##_sift_down(h, 0, last);                            \
+        }                                                                   \
+        return key;                                                         \
+    }                                                                       \
+                                                                            \
+    /* Restore the heap property over data[0 .. size - 1], O(n) */          \
+    static inline void heap##ARITY##_heapify(heap##ARITY *h) {              \
+        if (h->size < 2) {                                                  \
+            return;                                                         \
+        }                                                                   \
+        for (size_t s = (h->size - 2) / ARITY + 1; s-- > 0;) {              \
+            heap##ARITY##_sift_down(h, s, h->data[s]);                      \
+        }                                                                   \
+    }
+
+DEFINE_HEAP(2)
+DEFINE_HEAP(4)
+
+#endif
@@ -0,0 +1,258 @@
+package body Heaps is
+
+   procedure Lemma_Children (P : Index_Type) is null;
+
+   --  Changing A (P) moves one occurrence from the old key to the new one
+   procedure Lemma_Count_Update
+      (Old_Data, New_Data : Key_Array;
+       Upto               : Natural;
+       P                  : Index_Type)
+      with Ghost,
+           Pre  => Old_Data'First = 1
+                   and then New_Data'First = 1
+                   and then Old_Data'Last = New_Data'Last
+                   and then Upto <= Old_Data'Last
+                   and then P <= Upto
+                   and then (for all I in Old_Data'Range =>
+                               (if I /= P then Old_Data (I) = New_Data (I))),
+           Post => (for all X in Integer =>
+                      Count (New_Data, Upto, X)
+                        = Count (Old_Data, Upto, X)
+                          - (if Old_Data (P) = X then 1 else 0)
+                          + (if New_Data (P) = X then 1 else 0))
+   is
+   begin
+      for J in 1 .. Upto loop
+         pragma Loop_Invariant
+            (for all X in Integer =>
+               (if J < P then
+                  Count (New_Data, J, X) = Count (Old_Data, J, X)
+                else
+                  Count (New_Data, J, X)
+                    = Count (Old_Data, J, X)
+                      - (if Old_Data (P) = X then 1 else 0)
+                      + (if New_Data (P) = X then 1 else 0)));
+      end loop;
+   end Lemma_Count_Update;
+
+   --  Each node is at least its parent, and a parent index is always
+   --  smaller, so by induction on I the root is at most every node
+   procedure Lemma_Root_Is_Min (H : Heap)
+      with Ghost,
+           Pre  => Is_Heap (H) and then H.Size > 0,
+           Post => (for all I in 1 .. H.Size => H.Data (1) <= H.Data (I))
+   is
+   begin
+      for I in 2 .. H.Size loop
+         pragma Assert (H.Data (Parent (I)) <= H.Data (I));
+         pragma Loop_Invariant
+            (for all J in 1 .. I => H.Data (1) <= H.Data (J));
+      end loop;
+   end Lemma_Root_Is_Min;
+
+   --  Move Key down from Start, shifting smaller children up into the
+   --  hole. Edges below Start are valid before; edges from Start down are
+   --  valid after. Used by Pop (Start = 1) and Heapify. Key takes the
+   --  place of the old H.Data (Start) among the keys
+   procedure Sift_Down (H : in out Heap; Start : Index_Type; Key : Integer)
+      with Pre  => H.Size <= H.Capacity
+                   and then Start <= H.Size
+                   and then (for all I in 2 .. H.Size =>
+                               (if Parent (I) > Start then
+                                  H.Data (Parent (I)) <= H.Data (I))),
+           Post => H.Size = H.Size'Old
+               and (for all I in 2 .. H.Size =>
+                      (if Parent (I) >= Start then
+                         H.Data (Parent (I)) <= H.Data (I)))
+               and (for all X in Integer =>
+                      Count (H.Data, H.Size, X)
+                        = Count (H.Data'Old, H.Size, X)
+                          - (if H.Data'Old (Start) = X then 1 else 0)
+                          + (if Key = X then 1 else 0))
+   is
+      Size   : constant Positive := H.Size;
+      Hole   : Index_Type := Start;
+      Before : Key_Array (1 .. H.Capacity) with Ghost;
+   begin
+      loop
+         pragma Loop_Invariant (Hole in Start .. Size);
+         pragma Loop_Invariant (H.Size = Size);
+         --  The keys away from the hole are the keys away from Start
+         pragma Loop_Invariant
+            (for all X in Integer =>
+               Count (H.Data, Size, X) - (if H.Data (Hole) = X then 1 else 0)
+                 = Count (H.Data'Loop_Entry, Size, X)
+                   - (if H.Data'Loop_Entry (Start) = X then 1 else 0));
+         --  Every edge away from the hole is valid
+         pragma Loop_Invariant
+            (for all I in 2 .. Size =>
+               (if Parent (I) >= Start
+                   and then I /= Hole
+                   and then Parent (I) /= Hole
+                then H.Data (Parent (I)) <= H.Data (I)));
+         --  The node above the hole can take Key or any child of the hole
+         pragma Loop_Invariant
+            (if Hole > Start then H.Data (Parent (Hole)) <= Key);
+         pragma Loop_Invariant
+            (if Hole > Start then
+               (for all I in 2 .. Size =>
+                  (if Parent (I) = Hole then
+                     H.Data (Parent (Hole)) <= H.Data (I))));
+         pragma Loop_Variant (Increases => Hole);
+
+         Lemma_Children (Hole);
+         exit when First_Child (Hole) > Size;
+
+         declare
+            First : constant Index_Type := First_Child (Hole);
+            Last  : constant Index_Type :=
+               Integer'Min (First + Arity - 1, Size);
+            Best  : Index_Type := First;
+         begin
+            --  Smallest child; Arity is static, so this loop unrolls, and
+            --  the select compiles to a conditional move, not a branch
+            for C in First + 1 .. Last loop
+               Best := (if H.Data (C) < H.Data (Best) then C else Best);
+               pragma Loop_Invariant
+                  (Best in First .. C
+                   and then (for all J in First .. C =>
+                               H.Data (Best) <= H.Data (J)));
+            end loop;
+            pragma Assert
+               (for all I in 2 .. Size =>
+                  (if Parent (I) = Hole then H.Data (Best) <= H.Data (I)));
+
+            exit when H.Data (Best) >= Key;
+
+            Before := H.Data;
+            H.Data (Hole) := H.Data (Best);
+            Lemma_Count_Update (Before, H.Data, Size, Hole);
+            Hole := Best;
+         end;
+      end loop;
+
+      --  Key is at most every child of the hole (exit condition) and at
+      --  least the node above it (invariant)
+      Lemma_Children (Hole);
+      Before := H.Data;
+      H.Data (Hole) := Key;
+      Lemma_Count_Update (Before, H.Data, Size, Hole);
+   end Sift_Down;
+
+   --  Move Key up from the last slot, shifting larger parents down into
+   --  the hole. Every edge except those into the last slot is valid
+   --  before. Key takes the place of the old last key
+   procedure Sift_Up (H : in out Heap; Key : Integer)
+      with Pre  => H.Size in 1 .. H.Capacity
+                   and then (for all I in 2 .. H.Size - 1 =>
+                               H.Data (Parent (I)) <= H.Data (I)),
+           Post => H.Size = H.Size'Old
+               and Is_Heap (H)
+               and (for all X in Integer =>
+                      Count (H.Data, H.Size, X)
+                        = Count (H.Data'Old, H.Size, X)
+                          - (if H.Data'Old (H.Size) = X then 1 else 0)
+                          + (if Key = X then 1 else 0))
+   is
+      Size   : constant Positive := H.Size;
+      Hole   : Index_Type := Size;
+      Before : Key_Array (1 .. H.Capacity) with Ghost;
+   begin
+      while Hole > 1 and then H.Data (Parent (Hole)) > Key loop
+         pragma Loop_Invariant (Hole <= Size and H.Size = Size);
+         --  The keys away from the hole are the keys away from the last
+         pragma Loop_Invariant
+            (for all X in Integer =>
+               Count (H.Data, Size, X) - (if H.Data (Hole) = X then 1 else 0)
+                 = Count (H.Data'Loop_Entry, Size, X)
+                   - (if H.Data'Loop_Entry (Size) = X then 1 else 0));
+         --  Every edge into a node other than the hole is valid
+         pragma Loop_Invariant
+            (for all I in 2 .. Size =>
+               (if I /= Hole then H.Data (Parent (I)) <= H.Data (I)));
+         --  Key and the node above the hole fit over the hole's children
+         pragma Loop_Invariant
+            (for all I in 2 .. Size =>
+               (if Parent (I) = Hole then Key <= H.Data (I)));
+         pragma Loop_Invariant
+            (if Hole > 1 then
+               (for all I in 2 .. Size =>
+                  (if Parent (I) = Hole then
+                     H.Data (Parent (Hole)) <= H.Data (I))));
+         pragma Loop_Variant (Decreases => Hole);
+
+         Before := H.Data;
+         H.Data (Hole) := H.Data (Parent (Hole));
+         Lemma_Count_Update (Before, H.Data, Size, Hole);
+         Hole := Parent (Hole);
+      end loop;
+      Before := H.Data;
+      H.Data (Hole) := Key;
+      Lemma_Count_Update (Before, H.Data, Size, Hole);
+   end Sift_Up;
+
+   procedure Clear (H : in out Heap) is
+   begin
+      H.Size := 0;
+   end Clear;
+
+   function Peek (H : Heap) return Integer is
+   begin
+      Lemma_Root_Is_Min (H);
+      return H.Data (1);
+   end Peek;
+
+   procedure Push (H : in out Heap; Key : Integer) is
+   begin
+      H.Size := H.Size + 1;
+
+      --  The new last slot adds its old contents, which Sift_Up replaces
+      --  with Key
+      pragma Assert
+         (for all X in Integer =>
+            Count (H.Data, H.Size, X)
+              = Count (H.Data, H.Size - 1, X)
+                + (if H.Data (H.Size) = X then 1 else 0));
+      Sift_Up (H, Key);
+   end Push;
+
+   procedure Pop (H : in out Heap; Key : out Integer) is
+      Last : constant Integer := H.Data (H.Size);
+   begin
+      Lemma_Root_Is_Min (H);
+      Key := H.Data (1);
+      H.Size := H.Size - 1;
+
+      --  Last leaves the counted range; Sift_Down puts it back in place
+      --  of the root, which is Key
+      pragma Assert
+         (for all X in Integer =>
+            Count (H.Data, H.Size, X)
+              = Count (H.Data, H.Size + 1, X)
+                - (if Last = X then 1 else 0));
+      if H.Size > 0 then
+         Sift_Down (H, 1, Last);
+      end if;
+   end Pop;
+
+   procedure Heapify (H : in out Heap; Keys : Key_Array) is
+   begin
+      H.Size := Keys'Length;
+      for K in 0 .. Keys'Length - 1 loop
+         H.Data (K + 1) := Keys (Keys'First + K);
+      end loop;
+
+      --  Leaves are one-node heaps; sift every internal node, last first
+      if H.Size >= 2 then
+         for S in reverse 1 .. Parent (H.Size) loop
+            Sift_Down (H, S, H.Data (S));
+            pragma Loop_Invariant (H.Size = Keys'Length);
+            pragma Loop_Invariant
+               (for all I in 2 .. H.Size =>
+                  (if Parent (I) >= S then
+                     H.Data (Parent (I)) <= H.Data (I)));
+         end loop;
+      end if;
+   end Heapify;
+
+end Heaps;
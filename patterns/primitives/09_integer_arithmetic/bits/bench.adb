@@ -0,0 +1,218 @@
+--  Benchmark: the Bits kernels against the loops they replace, on the
+--  same bitmaps as bench.c
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Bits;          use Bits;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 10;
+   Small  : constant := 4096;   -- 32 KB: fits in L1
+
+   type Word_Access is access Word_Array;
+   type Position_Access is access Position_Array;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   function Random_Word return Word is
+      Hi : constant Word := Word (Next_Random);
+   begin
+      return Shift_Left (Hi, 32) or Word (Next_Random);
+   end Random_Word;
+
+   --------------
+   -- Popcount --
+   --------------
+
+   function Popcount_Four_Sums (A : Word_Array) return Natural is
+     (Popcount_All (A));
+   pragma Machine_Attribute (Popcount_Four_Sums, "noipa");
+
+   function Popcount_One_Sum (A : Word_Array) return Natural is
+      Count : Natural := 0;
+   begin
+      for I in A'Range loop
+         Count := Count + Popcount (A (I));
+      end loop;
+      return Count;
+   end Popcount_One_Sum;
+   pragma Machine_Attribute (Popcount_One_Sum, "noipa");
+
+   --  Hacker's Delight 5-2: sums of 2, 4 and 8 bits, then a multiply adds
+   --  the bytes
+   function Popcount_SWAR (A : Word_Array) return Natural is
+      Count : Natural := 0;
+      X     : Word;
+   begin
+      for I in A'Range loop
+         X := A (I);
+         X := X - (Shift_Right (X, 1) and 16#5555_5555_5555_5555#);
+         X := (X and 16#3333_3333_3333_3333#)
+              + (Shift_Right (X, 2) and 16#3333_3333_3333_3333#);
+         X := (X + Shift_Right (X, 4)) and 16#0F0F_0F0F_0F0F_0F0F#;
+         Count := Count
+                  + Natural (Shift_Right (X * 16#0101_0101_0101_0101#, 56));
+      end loop;
+      return Count;
+   end Popcount_SWAR;
+   pragma Machine_Attribute (Popcount_SWAR, "noipa");
+
+   function Popcount_Kernighan (A : Word_Array) return Natural is
+      Count : Natural := 0;
+      W     : Word;
+   begin
+      for I in A'Range loop
+         W := A (I);
+         while W /= 0 loop
+            Count := Count + 1;
+            W := W and (W - 1);
+         end loop;
+      end loop;
+      return Count;
+   end Popcount_Kernighan;
+   pragma Machine_Attribute (Popcount_Kernighan, "noipa");
+
+   function Popcount_Loop (A : Word_Array) return Natural is
+      Count : Natural := 0;
+   begin
+      for I in A'Range loop
+         for B in Bit_Index loop
+            Count := Count + Natural (Shift_Right (A (I), B) and 1);
+         end loop;
+      end loop;
+      return Count;
+   end Popcount_Loop;
+   pragma Machine_Attribute (Popcount_Loop, "noipa");
+
+   -----------------------
+   -- Set-bit iteration --
+   -----------------------
+
+   procedure Set_Bits_Ctz
+     (A         : Word_Array;
+      Positions : in out Position_Array;
+      Count     : out Natural) is
+   begin
+      Set_Bits (A, Positions, Count);
+   end Set_Bits_Ctz;
+   pragma Machine_Attribute (Set_Bits_Ctz, "noipa");
+
+   procedure Set_Bits_Loop
+     (A         : Word_Array;
+      Positions : in out Position_Array;
+      Count     : out Natural) is
+   begin
+      Count := 0;
+      for I in A'Range loop
+         for B in Bit_Index loop
+            if Is_Set (A (I), B) then
+               Count := Count + 1;
+               Positions (Count) := 64 * (I - A'First) + B;
+            end if;
+         end loop;
+      end loop;
+   end Set_Bits_Loop;
+   pragma Machine_Attribute (Set_Bits_Loop, "noipa");
+
+   type Count_Kernel is access function (A : Word_Array) return Natural;
+   type Scan_Kernel is access procedure
+     (A         : Word_Array;
+      Positions : in out Position_Array;
+      Count     : out Natural);
+
+   Dense     : constant Word_Access := new Word_Array (1 .. N);
+   Sparse    : constant Word_Access := new Word_Array (1 .. N);
+   Positions : constant Position_Access :=
+     new Position_Array (1 .. 64 * N);
+
+   Check : Unsigned_64 := 0;
+
+   procedure Report (Label : String; Start : Time; Words : Positive;
+                     Count : Natural) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Words)) &
+                " ns/word  (" & Natural'Image (Count) & " bits)");
+   end Report;
+
+   --  The same number of words either way: the small bitmap takes more
+   --  passes. One untimed pass first, so the cache is warm
+   procedure Time_Count (Label : String; K : Count_Kernel; Length : Positive)
+   is
+      Count       : Natural := K (Dense (1 .. Length));
+      Pass_Count  : constant Positive := Passes * N / Length;
+      Start       : constant Time := Clock;
+   begin
+      for P in 1 .. Pass_Count loop
+         Count := K (Dense (1 .. Length));
+      end loop;
+      Report (Label, Start, Length * Pass_Count, Count);
+      Check := Check + Unsigned_64 (Count);
+   end Time_Count;
+
+   procedure Time_Scan (Label : String; K : Scan_Kernel; A : Word_Access) is
+      Count : Natural;
+      Start : Time;
+   begin
+      K (A.all, Positions.all, Count);
+      Start := Clock;
+      for P in 1 .. Passes loop
+         K (A.all, Positions.all, Count);
+      end loop;
+      Report (Label, Start, N * Passes, Count);
+      for I in 1 .. Count loop
+         Check := Check + Unsigned_64 (Positions (I));
+      end loop;
+   end Time_Scan;
+
+begin
+   for I in 1 .. N loop
+      Dense (I) := Random_Word;
+      --  Six random words and-ed: each bit is set with probability 1/64
+      declare
+         W : Word := Random_Word;
+      begin
+         for J in 1 .. 5 loop
+            W := W and Random_Word;
+         end loop;
+         Sparse (I) := W;
+      end;
+   end loop;
+
+   Time_Count ("popcount 8 MB, popcnt x4   :",
+               Popcount_Four_Sums'Access, N);
+   Time_Count ("popcount 8 MB, popcnt x1   :",
+               Popcount_One_Sum'Access, N);
+   Time_Count ("popcount 8 MB, SWAR        :", Popcount_SWAR'Access, N);
+   Time_Count ("popcount 32 KB, popcnt x4  :",
+               Popcount_Four_Sums'Access, Small);
+   Time_Count ("popcount 32 KB, popcnt x1  :",
+               Popcount_One_Sum'Access, Small);
+   Time_Count ("popcount 32 KB, SWAR       :",
+               Popcount_SWAR'Access, Small);
+   Time_Count ("popcount 32 KB, Kernighan  :",
+               Popcount_Kernighan'Access, Small);
+   Time_Count ("popcount 32 KB, bit loop   :",
+               Popcount_Loop'Access, Small);
+   Time_Scan ("set bits 1/64, tzcnt       :", Set_Bits_Ctz'Access, Sparse);
+   Time_Scan ("set bits 1/64, bit loop    :", Set_Bits_Loop'Access, Sparse);
+   Time_Scan ("set bits 1/2, tzcnt        :", Set_Bits_Ctz'Access, Dense);
+   Time_Scan ("set bits 1/2, bit loop     :", Set_Bits_Loop'Access, Dense);
+
+   Put_Line ("checksum:" & Unsigned_64'Image (Check));
+end Bench;
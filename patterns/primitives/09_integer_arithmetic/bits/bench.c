@@ -0,0 +1,182 @@
+/*
+ * Benchmark: the bits.h kernels against the loops they replace
+ * - popcount of an array: popcnt with four sums and with one, the SWAR
+ *   bit-slice sum, Kernighan's clear-lowest loop, and one test per bit,
+ *   on an 8 MB bitmap and on a 32 KB one
+ * - set-bit iteration: tzcnt plus clear-lowest against testing every
+ *   bit, on a sparse bitmap (1 bit in 64) and a dense one (1 in 2)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bits.h"
+
+#define N      1000000
+#define PASSES 10
+#define SMALL  4096     // 32 KB: fits in L1, so memory does not hide the ALU
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t random_word(void) {
+    return ((uint64_t)next_random() << 32) | next_random();
+}
+
+/* ---- popcount ---- */
+
+__attribute__((noipa)) static size_t popcount_builtin(const uint64_t *a,
+                                                      size_t n) {
+    return bt_popcount_array(a, n);
+}
+
+__attribute__((noipa)) static size_t popcount_one_sum(const uint64_t *a,
+                                                      size_t n) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        count += (size_t)bt_popcount64(a[i]);
+    }
+    return count;
+}
+
+// Hacker's Delight 5-2: sums of 2, 4 and 8 bits, then a multiply adds
+// the bytes
+__attribute__((noipa)) static size_t popcount_swar(const uint64_t *a,
+                                                   size_t n) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t x = a[i];
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        count += (size_t)((x * 0x0101010101010101ULL) >> 56);
+    }
+    return count;
+}
+
+// One iteration per set bit
+__attribute__((noipa)) static size_t popcount_kernighan(const uint64_t *a,
+                                                        size_t n) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (uint64_t w = a[i]; w != 0; w &= w - 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+__attribute__((noipa)) static size_t popcount_loop(const uint64_t *a,
+                                                   size_t n) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (int b = 0; b < 64; b++) {
+            count += (a[i] >> b) & 1;
+        }
+    }
+    return count;
+}
+
+/* ---- set-bit iteration ---- */
+
+__attribute__((noipa)) static size_t set_bits_ctz(const uint64_t *a,
+                                                  size_t n,
+                                                  uint32_t *positions) {
+    return bt_set_bits(a, n, positions);
+}
+
+__attribute__((noipa)) static size_t set_bits_loop(const uint64_t *a,
+                                                   size_t n,
+                                                   uint32_t *positions) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (int b = 0; b < 64; b++) {
+            if ((a[i] >> b) & 1) {
+                positions[count++] = (uint32_t)(i * 64 + (size_t)b);
+            }
+        }
+    }
+    return count;
+}
+
+typedef size_t (*count_kernel)(const uint64_t *, size_t);
+typedef size_t (*scan_kernel)(const uint64_t *, size_t, uint32_t *);
+
+static uint64_t checksum;
+
+// One untimed pass first, so the first kernel does not pay for the
+// cold cache
+// The same number of words either way: the small bitmap takes more passes
+static void time_count(const char *label, count_kernel k,
+                       const uint64_t *a, size_t n) {
+    size_t count = k(a, n);
+    size_t passes = (size_t)PASSES * N / n;
+    double start = now_ns();
+    for (size_t p = 0; p < passes; p++) {
+        count = k(a, n);
+    }
+    double ns = (now_ns() - start) / ((double)n * passes);
+    checksum += count;
+    printf("%-28s: %.3f ns/word  (%zu bits)\n", label, ns, count);
+}
+
+static void time_scan(const char *label, scan_kernel k, const uint64_t *a,
+                      uint32_t *positions) {
+    size_t count = k(a, N, positions);
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        count = k(a, N, positions);
+    }
+    double ns = (now_ns() - start) / ((double)N * PASSES);
+    for (size_t i = 0; i < count; i++) {
+        checksum += positions[i];
+    }
+    printf("%-28s: %.3f ns/word  (%zu bits)\n", label, ns, count);
+}
+
+int main(void) {
+    uint64_t *dense = malloc(N * sizeof *dense);
+    uint64_t *sparse = malloc(N * sizeof *sparse);
+    uint32_t *positions = malloc((size_t)N * 64 * sizeof *positions);
+    if (!dense || !sparse || !positions) {
+        return 1;
+    }
+    for (int i = 0; i < N; i++) {
+        dense[i] = random_word();
+        // Six random words and-ed: each bit is set with probability 1/64
+        uint64_t w = random_word();
+        for (int j = 0; j < 5; j++) {
+            w &= random_word();
+        }
+        sparse[i] = w;
+    }
+
+    time_count("popcount 8 MB, popcnt x4", popcount_builtin, dense, N);
+    time_count("popcount 8 MB, popcnt x1", popcount_one_sum, dense, N);
+    time_count("popcount 8 MB, SWAR", popcount_swar, dense, N);
+    time_count("popcount 32 KB, popcnt x4", popcount_builtin, dense, SMALL);
+    time_count("popcount 32 KB, popcnt x1", popcount_one_sum, dense, SMALL);
+    time_count("popcount 32 KB, SWAR", popcount_swar, dense, SMALL);
+    time_count("popcount 32 KB, Kernighan", popcount_kernighan, dense,
+               SMALL);
+    time_count("popcount 32 KB, bit loop", popcount_loop, dense, SMALL);
+    time_scan("set bits 1/64, tzcnt", set_bits_ctz, sparse, positions);
+    time_scan("set bits 1/64, bit loop", set_bits_loop, sparse, positions);
+    time_scan("set bits 1/2, tzcnt", set_bits_ctz, dense, positions);
+    time_scan("set bits 1/2, bit loop", set_bits_loop, dense, positions);
+
+    printf("checksum: %llu\n", (unsigned long long)checksum);
+    return 0;
+}
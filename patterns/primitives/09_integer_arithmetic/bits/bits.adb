@@ -0,0 +1,149 @@
+package body Bits is
+
+   --  Clearing one set bit K of W lowers the count of every range
+   --  that contains K by one, and leaves the others alone
+   procedure Lemma_Count_Clear (W, V : Word; K : Bit_Index; N : Natural)
+      with Ghost,
+           Pre                =>
+              N <= 64
+              and then Is_Set (W, K)
+              and then not Is_Set (V, K)
+              and then (for all B in Bit_Index =>
+                          (if B /= K then Is_Set (V, B) = Is_Set (W, B))),
+           Post               => Count_Below (V, N)
+                                 = Count_Below (W, N)
+                                   - (if K < N then 1 else 0),
+           Subprogram_Variant => (Decreases => N)
+   is
+   begin
+      if N > 0 then
+         Lemma_Count_Clear (W, V, K, N - 1);
+      end if;
+   end Lemma_Count_Clear;
+
+   procedure Lemma_Count_Zero (N : Natural)
+      with Ghost,
+           Pre                => N <= 64,
+           Post               => Count_Below (0, N) = 0,
+           Subprogram_Variant => (Decreases => N)
+   is
+   begin
+      if N > 0 then
+         Lemma_Count_Zero (N - 1);
+      end if;
+   end Lemma_Count_Zero;
+
+   procedure Lemma_Prefix_Mono (A : Word_Array; I, J : Integer)
+      with Ghost,
+           Pre                => I <= J and J <= A'Last,
+           Post               => Count_Prefix (A, I) <= Count_Prefix (A, J),
+           Subprogram_Variant => (Decreases => J)
+   is
+   begin
+      if I < J then
+         Lemma_Prefix_Mono (A, I, J - 1);
+      end if;
+   end Lemma_Prefix_Mono;
+
+   ------------------
+   -- Popcount_All --
+   ------------------
+
+   --  Four independent sums, as in bits.h: with a single sum every
+   --  popcnt waits on the previous add, 3.5x slower from L1 and 2x from
+   --  memory (NOTES.md)
+   function Popcount_All (A : Word_Array) return Natural is
+      C0, C1, C2, C3 : Natural := 0;
+      I              : Integer := A'First;
+   begin
+      while I + 3 <= A'Last loop
+         pragma Loop_Invariant (I in A'First .. A'Last - 3);
+         pragma Loop_Invariant
+            (C0 + C1 + C2 + C3 = Count_Prefix (A, I - 1));
+         pragma Loop_Variant (Increases => I);
+
+         pragma Assert (Count_Prefix (A, I + 3)
+                        = Count_Prefix (A, I - 1)
+                          + Count_Below (A (I), 64)
+                          + Count_Below (A (I + 1), 64)
+                          + Count_Below (A (I + 2), 64)
+                          + Count_Below (A (I + 3), 64));
+         C0 := C0 + Popcount (A (I));
+         C1 := C1 + Popcount (A (I + 1));
+         C2 := C2 + Popcount (A (I + 2));
+         C3 := C3 + Popcount (A (I + 3));
+         I := I + 4;
+      end loop;
+
+      C0 := C0 + C1 + C2 + C3;
+      while I <= A'Last loop
+         pragma Loop_Invariant (I in A'First .. A'Last);
+         pragma Loop_Invariant (C0 = Count_Prefix (A, I - 1));
+         pragma Loop_Variant (Increases => I);
+
+         C0 := C0 + Popcount (A (I));
+         I := I + 1;
+      end loop;
+      return C0;
+   end Popcount_All;
+
+   --------------
+   -- Set_Bits --
+   --------------
+
+   procedure Set_Bits
+     (A         : Word_Array;
+      Positions : in out Position_Array;
+      Count     : out Natural)
+   is
+      W   : Word;
+      Bit : Bit_Index;
+   begin
+      Count := 0;
+      for I in A'Range loop
+         pragma Loop_Invariant (Count = Count_Prefix (A, I - 1));
+         pragma Loop_Invariant
+            (for all J in 1 .. Count =>
+               Positions (J) < 64 * (I - A'First)
+               and then Bit_At (A, Positions (J)));
+         pragma Loop_Invariant
+            (for all J in 1 .. Count - 1 =>
+               Positions (J) < Positions (J + 1));
+
+         Lemma_Prefix_Mono (A, I, A'Last);
+         W := A (I);
+
+         --  One iteration per set bit of A (I), lowest first
+         while W /= 0 loop
+            pragma Loop_Invariant
+               (for all B in Bit_Index =>
+                  (if Is_Set (W, B) then Is_Set (A (I), B)));
+            pragma Loop_Invariant
+               (Count + Count_Below (W, 64) = Count_Prefix (A, I));
+            pragma Loop_Invariant (Count_Prefix (A, I) <= Positions'Last);
+            pragma Loop_Invariant
+               (for all J in 1 .. Count =>
+                  Positions (J) < 64 * (I - A'First) + 64
+                  and then Bit_At (A, Positions (J)));
+            pragma Loop_Invariant
+               (for all J in 1 .. Count - 1 =>
+                  Positions (J) < Positions (J + 1));
+            pragma Loop_Invariant
+               (for all B in Bit_Index =>
+                  (if Is_Set (W, B) then
+                     Count = 0
+                     or else Positions (Count) < 64 * (I - A'First) + B));
+            pragma Loop_Variant (Decreases => Count_Below (W, 64));
+
+            Bit := Count_Trailing_Zeros (W);
+            Lemma_Count_Clear (W, Clear_Lowest (W), Bit, 64);
+            Count := Count + 1;
+            Positions (Count) := 64 * (I - A'First) + Bit;
+            pragma Assert (Bit_At (A, Positions (Count)));
+            W := Clear_Lowest (W);
+         end loop;
+         Lemma_Count_Zero (64);
+      end loop;
+   end Set_Bits;
+
+end Bits;
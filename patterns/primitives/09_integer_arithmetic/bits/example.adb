@@ -0,0 +1,39 @@
+--  Bit kernels: counting and listing the set bits of a bitmap
+--  A bitmap index keeps one bit per row; rows matching two conditions
+--  are the and of two bitmaps
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Bits;        use Bits;
+
+procedure Example is
+
+   --  Rows 0-127: multiples of 3, and rows whose low bits are 101
+   By_Three : constant Word_Array (1 .. 2) :=
+     (16#9249_2492_4924_9249#, 16#4924_9249_2492_4924#);
+   Low_101  : constant Word_Array (1 .. 2) :=
+     (16#2020_2020_2020_2020#, 16#2020_2020_2020_2020#);
+   Both     : Word_Array (1 .. 2);
+   Rows     : Position_Array (1 .. 128) := (others => 0);
+   Count    : Natural;
+
+begin
+   for I in Both'Range loop
+      Both (I) := By_Three (I) and Low_101 (I);
+   end loop;
+   Put_Line ("Popcount (16#FF00FF#):  "
+             & Natural'Image (Popcount (16#FF_00FF#)));
+   Put_Line ("Count_Trailing_Zeros (16#50#):"
+             & Bit_Index'Image (Count_Trailing_Zeros (16#50#)));
+   Put_Line ("Multiples of 3:         "
+             & Natural'Image (Popcount_All (By_Three)));
+
+   --  Set_Bits needs room for every set bit: 128 positions always do
+   Set_Bits (Both, Rows, Count);
+   Put ("In both," & Natural'Image (Count) & " rows:    ");
+   for I in 1 .. Count loop
+      Put (Natural'Image (Rows (I)));
+   end loop;
+   New_Line;
+
+   --  Count_Trailing_Zeros (0) is rejected by the prover: Pre => W /= 0
+end Example;
@@ -0,0 +1,34 @@
+/*
+ * Bit kernels: counting and listing the set bits of a bitmap
+ * A bitmap index keeps one bit per row; rows matching two conditions
+ * are the and of two bitmaps
+ */
+
+#include <stdio.h>
+#include "bits.h"
+
+int main(void) {
+    // Rows 0-127: multiples of 3, and rows whose low bits are 101
+    uint64_t by_three[2] = {0x9249249249249249ULL, 0x4924924924924924ULL};
+    uint64_t low_101[2] = {0x2020202020202020ULL, 0x2020202020202020ULL};
+    uint64_t both[2];
+    uint32_t rows[128];
+
+    for (int i = 0; i < 2; i++) {
+        both[i] = by_three[i] & low_101[i];
+    }
+    printf("popcount(0xFF00FF):   %d\n", bt_popcount64(0xFF00FF));
+    printf("ctz(0x50):            %d\n", bt_ctz64(0x50));
+    printf("Multiples of 3:       %zu\n", bt_popcount_array(by_three, 2));
+
+    size_t count = bt_set_bits(both, 2, rows);
+    printf("In both, %zu rows:   ", count);
+    for (size_t i = 0; i < count; i++) {
+        printf(" %u", rows[i]);
+    }
+    printf("\n");
+
+    // bt_ctz64(0) is undefined: on x86 with tzcnt it returns 64, with bsf
+    // the result register is left unchanged
+    return 0;
+}
@@ -0,0 +1,209 @@
+--  Benchmark: branching abs, sign, clamp and min/max against the
+--  branch-free forms in Branchless, on data with random signs
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Ada.Unchecked_Conversion;
+with Interfaces;    use Interfaces;
+with Branchless;    use Branchless;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 50;
+   Low    : constant := -2 ** 30;
+   High   : constant := 2 ** 30;
+
+   subtype Data_Array is Integer_Array (1 .. N);
+   type Data_Access is access Data_Array;
+
+   function To_Integer is new Ada.Unchecked_Conversion (Unsigned_32, Integer);
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  As usually written
+
+   --  Only negative elements are stored to, so this stays a branch
+   procedure Abs_Branch (A : in out Data_Array) is
+   begin
+      for I in A'Range loop
+         if A (I) < 0 then
+            A (I) := -A (I);
+         end if;
+      end loop;
+   end Abs_Branch;
+   pragma Machine_Attribute (Abs_Branch, "noipa");
+
+   procedure Sign_Branch (A : Data_Array; S : out Data_Array) is
+   begin
+      for I in A'Range loop
+         if A (I) > 0 then
+            S (I) := 1;
+         elsif A (I) < 0 then
+            S (I) := -1;
+         else
+            S (I) := 0;
+         end if;
+      end loop;
+   end Sign_Branch;
+   pragma Machine_Attribute (Sign_Branch, "noipa");
+
+   procedure Clamp_Branch (A : in out Data_Array) is
+   begin
+      for I in A'Range loop
+         if A (I) < Low then
+            A (I) := Low;
+         elsif A (I) > High then
+            A (I) := High;
+         end if;
+      end loop;
+   end Clamp_Branch;
+   pragma Machine_Attribute (Clamp_Branch, "noipa");
+
+   procedure Min_Max_Branch (A : Data_Array; Lo, Hi : out Integer) is
+   begin
+      Lo := A (1);
+      Hi := A (1);
+      for I in 2 .. A'Last loop
+         if A (I) < Lo then
+            Lo := A (I);
+         elsif A (I) > Hi then
+            Hi := A (I);
+         end if;
+      end loop;
+   end Min_Max_Branch;
+   pragma Machine_Attribute (Min_Max_Branch, "noipa");
+
+   --  Branch-free
+
+   procedure Abs_Mask (A : in out Data_Array) is
+   begin
+      Abs_All (A);
+   end Abs_Mask;
+   pragma Machine_Attribute (Abs_Mask, "noipa");
+
+   procedure Sign_Compare (A : Data_Array; S : in out Data_Array) is
+   begin
+      Sign_All (A, S);
+   end Sign_Compare;
+   pragma Machine_Attribute (Sign_Compare, "noipa");
+
+   procedure Clamp_Min_Max (A : in out Data_Array) is
+   begin
+      Clamp_All (A, Low, High);
+   end Clamp_Min_Max;
+   pragma Machine_Attribute (Clamp_Min_Max, "noipa");
+
+   procedure Min_Max_Cmov (A : Data_Array; Lo, Hi : out Integer) is
+   begin
+      Min_Max (A, Lo, Hi);
+   end Min_Max_Cmov;
+   pragma Machine_Attribute (Min_Max_Cmov, "noipa");
+
+   Data  : constant Data_Access := new Data_Array;
+   Work  : constant Data_Access := new Data_Array;
+   Out_A : constant Data_Access := new Data_Array;
+
+   Lo, Hi : Integer := 0;
+   Check  : Long_Long_Integer := 0;
+   Start  : Time;
+
+   procedure Report (Label : String) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Passes)) &
+                " ns/element");
+   end Report;
+
+   procedure Add_To_Check (R : Data_Array) is
+   begin
+      for I in R'Range loop
+         Check := Check + Long_Long_Integer (R (I));
+      end loop;
+   end Add_To_Check;
+
+begin
+   --  Never Integer'First, so abs is defined for every element
+   for I in Data'Range loop
+      Data (I) := To_Integer (Next_Random);
+      if Data (I) = Integer'First then
+         Data (I) := 0;
+      end if;
+   end loop;
+
+   --  In-place kernels get fresh data every pass; the copy is timed for
+   --  both variants alike
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Work.all := Data.all;
+      Abs_Branch (Work.all);
+   end loop;
+   Report ("abs, if/else          :");
+   Add_To_Check (Work.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Work.all := Data.all;
+      Abs_Mask (Work.all);
+   end loop;
+   Report ("abs, mask and xor     :");
+   Add_To_Check (Work.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sign_Branch (Data.all, Out_A.all);
+   end loop;
+   Report ("sign, if/elsif        :");
+   Add_To_Check (Out_A.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sign_Compare (Data.all, Out_A.all);
+   end loop;
+   Report ("sign, comparisons     :");
+   Add_To_Check (Out_A.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Work.all := Data.all;
+      Clamp_Branch (Work.all);
+   end loop;
+   Report ("clamp, if/elsif       :");
+   Add_To_Check (Work.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Work.all := Data.all;
+      Clamp_Min_Max (Work.all);
+   end loop;
+   Report ("clamp, min/max        :");
+   Add_To_Check (Work.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Min_Max_Branch (Data.all, Lo, Hi);
+   end loop;
+   Report ("min/max, if/elsif     :");
+   Check := Check + Long_Long_Integer (Lo) + Long_Long_Integer (Hi);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Min_Max_Cmov (Data.all, Lo, Hi);
+   end loop;
+   Report ("min/max, cmov         :");
+   Check := Check + Long_Long_Integer (Lo) + Long_Long_Integer (Hi);
+
+   Put_Line ("checksum:" & Long_Long_Integer'Image (Check));
+end Bench;
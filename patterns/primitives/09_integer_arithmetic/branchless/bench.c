@@ -0,0 +1,198 @@
+/*
+ * Benchmark: branching abs, sign, clamp and min/max against the
+ * branch-free forms in branchless.h
+ * The data has random signs and magnitudes, so a branch on the sign
+ * or on a range test is a coin flip for the predictor
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "branchless.h"
+
+#define N      1000000
+#define PASSES 50
+#define LO     (-(1 << 30))
+#define HI     (1 << 30)
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- As usually written ---- */
+
+// Negate only the negative elements. The store is conditional, and GCC
+// may not add a store the source does not make, so this stays a branch.
+// (r[i] = a[i] < 0 ? -a[i] : a[i] into a second array becomes abs)
+__attribute__((noipa)) static void abs_branch(int32_t *a, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] < 0) {
+            a[i] = -a[i];
+        }
+    }
+}
+
+__attribute__((noipa)) static void sign_branch(const int32_t *a, int32_t *s,
+                                               size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] > 0) {
+            s[i] = 1;
+        } else if (a[i] < 0) {
+            s[i] = -1;
+        } else {
+            s[i] = 0;
+        }
+    }
+}
+
+__attribute__((noipa)) static void clamp_branch(int32_t *a, size_t n,
+                                                int32_t lo, int32_t hi) {
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] < lo) {
+            a[i] = lo;
+        } else if (a[i] > hi) {
+            a[i] = hi;
+        }
+    }
+}
+
+__attribute__((noipa)) static void min_max_branch(const int32_t *a, size_t n,
+                                                  int32_t *lo, int32_t *hi) {
+    int32_t l = a[0];
+    int32_t h = a[0];
+    for (size_t i = 1; i < n; i++) {
+        if (a[i] < l) {
+            l = a[i];
+        } else if (a[i] > h) {
+            h = a[i];
+        }
+    }
+    *lo = l;
+    *hi = h;
+}
+
+/* ---- Branch-free ---- */
+
+__attribute__((noipa)) static void abs_mask(int32_t *a, size_t n) {
+    bl_abs_all(a, n);
+}
+
+__attribute__((noipa)) static void sign_compare(const int32_t *a, int32_t *s,
+                                                size_t n) {
+    bl_sign_all(a, s, n);
+}
+
+__attribute__((noipa)) static void clamp_min_max(int32_t *a, size_t n,
+                                                 int32_t lo, int32_t hi) {
+    bl_clamp_all(a, n, lo, hi);
+}
+
+__attribute__((noipa)) static void min_max_cmov(const int32_t *a, size_t n,
+                                                int32_t *lo, int32_t *hi) {
+    bl_min_max(a, n, lo, hi);
+}
+
+static int64_t checksum;
+
+static void report(const char *label, double start) {
+    printf("%-22s: %.3f ns/element\n", label,
+           (now_ns() - start) / ((double)N * PASSES));
+}
+
+static void add_to_checksum(const int32_t *r) {
+    for (size_t i = 0; i < N; i++) {
+        checksum += r[i];
+    }
+}
+
+int main(void) {
+    int32_t *data = malloc(N * sizeof *data);
+    int32_t *work = malloc(N * sizeof *work);
+    int32_t *out = malloc(N * sizeof *out);
+    if (!data || !work || !out) {
+        return 1;
+    }
+    // Never INT32_MIN, so abs is defined for every element
+    for (size_t i = 0; i < N; i++) {
+        int32_t x = (int32_t)next_random();
+        data[i] = x == INT32_MIN ? 0 : x;
+    }
+
+    // In-place kernels get fresh data every pass; the copy is timed
+    // for both variants alike
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        memcpy(work, data, N * sizeof *work);
+        abs_branch(work, N);
+    }
+    report("abs, if/else", start);
+    add_to_checksum(work);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        memcpy(work, data, N * sizeof *work);
+        abs_mask(work, N);
+    }
+    report("abs, mask and xor", start);
+    add_to_checksum(work);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sign_branch(data, out, N);
+    }
+    report("sign, if/elsif", start);
+    add_to_checksum(out);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sign_compare(data, out, N);
+    }
+    report("sign, comparisons", start);
+    add_to_checksum(out);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        memcpy(work, data, N * sizeof *work);
+        clamp_branch(work, N, LO, HI);
+    }
+    report("clamp, if/elsif", start);
+    add_to_checksum(work);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        memcpy(work, data, N * sizeof *work);
+        clamp_min_max(work, N, LO, HI);
+    }
+    report("clamp, min/max", start);
+    add_to_checksum(work);
+
+    int32_t lo = 0, hi = 0;
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        min_max_branch(data, N, &lo, &hi);
+    }
+    report("min/max, if/elsif", start);
+    checksum += (int64_t)lo + hi;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        min_max_cmov(data, N, &lo, &hi);
+    }
+    report("min/max, cmov", start);
+    checksum += (int64_t)lo + hi;
+
+    printf("checksum: %lld\n", (long long)checksum);
+    return 0;
+}
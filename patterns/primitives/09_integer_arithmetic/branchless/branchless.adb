@@ -0,0 +1,80 @@
+with Interfaces; use Interfaces;
+
+package body Branchless is
+
+   function Abs_Value (X : Integer) return Natural is
+      U : constant Unsigned_32 := Unsigned_32'Mod (X);
+
+      --  All ones for negative X, zero otherwise
+      M : constant Unsigned_32 := Shift_Right_Arithmetic (U, 31);
+   begin
+      --  U xor M is U or its complement, and subtracting all ones adds 1:
+      --  the two's complement negation when X < 0
+      pragma Assert (if X >= 0 then M = 0 and U = Unsigned_32 (X));
+      pragma Assert (if X < 0 then M = Unsigned_32'Last
+                                   and U = Unsigned_32'Last
+                                           - Unsigned_32 (-(X + 1)));
+      pragma Assert (if X < 0 then (U xor M) = Unsigned_32 (-(X + 1)));
+      return Natural ((U xor M) - M);
+   end Abs_Value;
+
+   procedure Abs_All (A : in out Integer_Array) is
+   begin
+      for I in A'Range loop
+         A (I) := Abs_Value (A (I));
+         pragma Loop_Invariant
+            (for all J in A'First .. I => A (J) = abs A'Loop_Entry (J));
+         pragma Loop_Invariant
+            (for all J in I + 1 .. A'Last => A (J) = A'Loop_Entry (J));
+      end loop;
+   end Abs_All;
+
+   procedure Sign_All (A : Integer_Array; S : in out Integer_Array) is
+   begin
+      for I in A'Range loop
+         S (I) := Sign (A (I));
+         pragma Loop_Invariant
+            (for all J in A'First .. I =>
+               S (J) = (if A (J) > 0 then 1 elsif A (J) < 0 then -1 else 0));
+      end loop;
+   end Sign_All;
+
+   procedure Clamp_All (A : in out Integer_Array; Lo, Hi : Integer) is
+   begin
+      for I in A'Range loop
+         A (I) := Max (Lo, Min (Hi, A (I)));
+         pragma Loop_Invariant
+            (for all J in A'First .. I =>
+               A (J) = (if A'Loop_Entry (J) < Lo then Lo
+                        elsif A'Loop_Entry (J) > Hi then Hi
+                        else A'Loop_Entry (J)));
+         pragma Loop_Invariant
+            (for all J in I + 1 .. A'Last => A (J) = A'Loop_Entry (J));
+      end loop;
+   end Clamp_All;
+
+   --  Lo and Hi are updated unconditionally every step, so the loop has
+   --  no data-dependent branch; Lo_At and Hi_At witness where they occur
+   procedure Min_Max (A : Integer_Array; Lo, Hi : out Integer) is
+      Lo_At : Positive := A'First with Ghost;
+      Hi_At : Positive := A'First with Ghost;
+   begin
+      Lo := A (A'First);
+      Hi := A (A'First);
+      for I in A'First + 1 .. A'Last loop
+         if A (I) < Lo then
+            Lo_At := I;
+         end if;
+         if A (I) > Hi then
+            Hi_At := I;
+         end if;
+         Lo := Min (Lo, A (I));
+         Hi := Max (Hi, A (I));
+         pragma Loop_Invariant
+            (for all J in A'First .. I => A (J) in Lo .. Hi);
+         pragma Loop_Invariant (Lo_At in A'First .. I and then A (Lo_At) = Lo);
+         pragma Loop_Invariant (Hi_At in A'First .. I and then A (Hi_At) = Hi);
+      end loop;
+   end Min_Max;
+
+end Branchless;
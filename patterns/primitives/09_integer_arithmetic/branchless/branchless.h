@@ -0,0 +1,66 @@
+/*
+ * Branch-free abs, min, max and sign, and array versions
+ * On random-sign data a branch on x < 0 mispredicts about half the
+ * time; these forms compute both outcomes and select
+ */
+
+#ifndef BRANCHLESS_H
+#define BRANCHLESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// m is 0 for x >= 0 and all ones for x < 0: (x ^ m) - m is x or
+// ~x + 1 = -x. Computed in unsigned, so no signed overflow;
+// abs(INT32_MIN) is still INT32_MIN, as with abs()
+static inline int32_t bl_abs(int32_t x) {
+    uint32_t m = (uint32_t)(x >> 31);
+    return (int32_t)(((uint32_t)x ^ m) - m);
+}
+
+// GCC compiles a single ?: on two values to cmov
+static inline int32_t bl_min(int32_t a, int32_t b) {
+    return a < b ? a : b;
+}
+
+static inline int32_t bl_max(int32_t a, int32_t b) {
+    return a > b ? a : b;
+}
+
+// Two comparisons, each a setcc: no branch
+static inline int32_t bl_sign(int32_t x) {
+    return (x > 0) - (x < 0);
+}
+
+static inline void bl_abs_all(int32_t *a, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        a[i] = bl_abs(a[i]);
+    }
+}
+
+static inline void bl_sign_all(const int32_t *a, int32_t *s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        s[i] = bl_sign(a[i]);
+    }
+}
+
+static inline void bl_clamp_all(int32_t *a, size_t n, int32_t lo, int32_t hi) {
+    for (size_t i = 0; i < n; i++) {
+        a[i] = bl_max(lo, bl_min(hi, a[i]));
+    }
+}
+
+// n >= 1
+static inline void bl_min_max(const int32_t *a, size_t n,
+                              int32_t *lo, int32_t *hi) {
+    int32_t l = a[0];
+    int32_t h = a[0];
+    for (size_t i = 1; i < n; i++) {
+        l = bl_min(l, a[i]);
+        h = bl_max(h, a[i]);
+    }
+    *lo = l;
+    *hi = h;
+}
+
+#endif
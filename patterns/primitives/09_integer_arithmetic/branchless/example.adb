@@ -0,0 +1,39 @@
+--  Branch-free abs, min, max and sign
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Branchless;  use Branchless;
+
+procedure Example is
+
+   Values : Integer_Array := (-7, 0, 42, -100, 5);
+   Signs  : Integer_Array (Values'Range) := (others => 0);
+   Lo, Hi : Integer;
+
+   procedure Print (Label : String; A : Integer_Array) is
+   begin
+      Put (Label);
+      for X of A loop
+         Put (Integer'Image (X));
+      end loop;
+      New_Line;
+   end Print;
+
+begin
+   Put_Line ("Abs_Value (-42):" & Integer'Image (Abs_Value (-42)));
+   Put_Line ("Min (3, -8):    " & Integer'Image (Min (3, -8)));
+   Put_Line ("Max (3, -8):    " & Integer'Image (Max (3, -8)));
+   Put_Line ("Sign (-5):      " & Integer'Image (Sign (-5)));
+
+   Min_Max (Values, Lo, Hi);
+   Put_Line ("Min_Max:        " & Integer'Image (Lo) & Integer'Image (Hi));
+
+   Sign_All (Values, Signs);
+   Print ("Signs:          ", Signs);
+
+   Clamp_All (Values, -10, 10);
+   Print ("Clamped:        ", Values);
+
+   --  Clamped values are above Integer'First, as Abs_All requires
+   Abs_All (Values);
+   Print ("Abs:            ", Values);
+end Example;
@@ -0,0 +1,43 @@
+/*
+ * Branch-free abs, min, max and sign
+ */
+
+#include <stdio.h>
+#include "branchless.h"
+
+int main(void) {
+    int32_t values[] = {-7, 0, 42, -100, 5};
+    int32_t signs[5];
+    size_t n = sizeof values / sizeof values[0];
+    int32_t lo, hi;
+
+    printf("abs(-42):     %d\n", bl_abs(-42));
+    printf("min(3, -8):   %d\n", bl_min(3, -8));
+    printf("max(3, -8):   %d\n", bl_max(3, -8));
+    printf("sign(-5):     %d\n", bl_sign(-5));
+
+    bl_min_max(values, n, &lo, &hi);
+    printf("min/max:      %d %d\n", lo, hi);
+
+    bl_sign_all(values, signs, n);
+    printf("signs:       ");
+    for (size_t i = 0; i < n; i++) {
+        printf(" %d", signs[i]);
+    }
+    printf("\n");
+
+    bl_clamp_all(values, n, -10, 10);
+    printf("clamped:     ");
+    for (size_t i = 0; i < n; i++) {
+        printf(" %d", values[i]);
+    }
+    printf("\n");
+
+    bl_abs_all(values, n);
+    printf("abs:         ");
+    for (size_t i = 0; i < n; i++) {
+        printf(" %d", values[i]);
+    }
+    printf("\n");
+    return 0;
+}
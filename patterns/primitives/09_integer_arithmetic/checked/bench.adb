@@ -0,0 +1,249 @@
+--  Benchmark: what overflow safety costs in arithmetic loops
+--  Each kernel is compiled in the overflow mode of one -gnatoXY switch,
+--  set locally with pragmas because make bench builds with -gnatp
+--  -gnato0:  pragma Suppress (Overflow_Check)
+--  -gnato11: checks on, every operation in the base type (Strict)
+--  -gnato23: checks on, intermediates in a wider type (Minimized),
+--            assertions in arbitrary precision (Eliminated)
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Checked;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 50;
+
+   type Data_Array is array (1 .. N) of Integer;
+   type Data_Access is access Data_Array;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   -----------------
+   -- Dot product --
+   -----------------
+
+   function Dot_O0 (A, B : Data_Array) return Integer is
+      pragma Suppress (Overflow_Check);
+      Sum : Integer := 0;
+   begin
+      for I in A'Range loop
+         Sum := Sum + A (I) * B (I);
+      end loop;
+      return Sum;
+   end Dot_O0;
+   pragma Machine_Attribute (Dot_O0, "noipa");
+
+   function Dot_O11 (A, B : Data_Array) return Integer is
+      pragma Unsuppress (Overflow_Check);
+      pragma Overflow_Mode (General => Strict, Assertions => Strict);
+      Sum : Integer := 0;
+   begin
+      for I in A'Range loop
+         Sum := Sum + A (I) * B (I);
+      end loop;
+      return Sum;
+   end Dot_O11;
+   pragma Machine_Attribute (Dot_O11, "noipa");
+
+   function Dot_O23 (A, B : Data_Array) return Integer is
+      pragma Unsuppress (Overflow_Check);
+      pragma Overflow_Mode (General => Minimized, Assertions => Eliminated);
+      Sum : Integer := 0;
+   begin
+      for I in A'Range loop
+         Sum := Sum + A (I) * B (I);
+      end loop;
+      return Sum;
+   end Dot_O23;
+   pragma Machine_Attribute (Dot_O23, "noipa");
+
+   --  Checks suppressed; the flags are the check, tested by the caller
+   function Dot_Flag
+      (A, B     : Data_Array;
+       Overflow : out Boolean) return Integer
+   is
+      pragma Suppress (Overflow_Check);
+      Sum : Checked.Result;
+      P   : Checked.Result;
+      Any : Boolean := False;
+   begin
+      for I in A'Range loop
+         P := Checked.Mul (A (I), B (I));
+         Sum := Checked.Add (Sum.Value, P.Value);
+         Any := Any or P.Overflow or Sum.Overflow;
+      end loop;
+      Overflow := Any;
+      return Sum.Value;
+   end Dot_Flag;
+   pragma Machine_Attribute (Dot_Flag, "noipa");
+
+   ------------
+   -- Horner --
+   ------------
+
+   --  3x^3 - 7x^2 + 11x - 13
+
+   procedure Horner_O0 (X : Data_Array; R : out Data_Array) is
+      pragma Suppress (Overflow_Check);
+   begin
+      for I in X'Range loop
+         R (I) := ((3 * X (I) - 7) * X (I) + 11) * X (I) - 13;
+      end loop;
+   end Horner_O0;
+   pragma Machine_Attribute (Horner_O0, "noipa");
+
+   procedure Horner_O11 (X : Data_Array; R : out Data_Array) is
+      pragma Unsuppress (Overflow_Check);
+      pragma Overflow_Mode (General => Strict, Assertions => Strict);
+   begin
+      for I in X'Range loop
+         R (I) := ((3 * X (I) - 7) * X (I) + 11) * X (I) - 13;
+      end loop;
+   end Horner_O11;
+   pragma Machine_Attribute (Horner_O11, "noipa");
+
+   procedure Horner_O23 (X : Data_Array; R : out Data_Array) is
+      pragma Unsuppress (Overflow_Check);
+      pragma Overflow_Mode (General => Minimized, Assertions => Eliminated);
+   begin
+      for I in X'Range loop
+         R (I) := ((3 * X (I) - 7) * X (I) + 11) * X (I) - 13;
+      end loop;
+   end Horner_O23;
+   pragma Machine_Attribute (Horner_O23, "noipa");
+
+   procedure Horner_Flag
+      (X        : Data_Array;
+       R        : out Data_Array;
+       Overflow : out Boolean)
+   is
+      pragma Suppress (Overflow_Check);
+      use Checked;
+      V   : Result;
+      O   : Boolean;
+      Any : Boolean := False;
+   begin
+      for I in X'Range loop
+         V := Mul (3, X (I));
+         O := V.Overflow;
+         V := Sub (V.Value, 7);
+         O := O or V.Overflow;
+         V := Mul (V.Value, X (I));
+         O := O or V.Overflow;
+         V := Add (V.Value, 11);
+         O := O or V.Overflow;
+         V := Mul (V.Value, X (I));
+         O := O or V.Overflow;
+         V := Sub (V.Value, 13);
+         Any := Any or O or V.Overflow;
+         R (I) := V.Value;
+      end loop;
+      Overflow := Any;
+   end Horner_Flag;
+   pragma Machine_Attribute (Horner_Flag, "noipa");
+
+   A : constant Data_Access := new Data_Array;
+   B : constant Data_Access := new Data_Array;
+   R : constant Data_Access := new Data_Array;
+
+   Sum      : Integer := 0;
+   Overflow : Boolean := False;
+   Check    : Long_Long_Integer := 0;
+   Start    : Time;
+
+   procedure Report (Label : String) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Passes)) &
+                " ns/element");
+   end Report;
+
+   procedure Add_To_Check (Values : Data_Array) is
+   begin
+      for I in Values'Range loop
+         Check := Check + Long_Long_Integer (Values (I));
+      end loop;
+   end Add_To_Check;
+
+begin
+   --  -100 .. 100: products and polynomial values stay far from the
+   --  limits, so every check passes
+   for I in 1 .. N loop
+      A (I) := Integer (Next_Random mod 201) - 100;
+      B (I) := Integer (Next_Random mod 201) - 100;
+   end loop;
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Dot_O0 (A.all, B.all);
+   end loop;
+   Report ("dot, -gnato0                 :");
+   Check := Check + Long_Long_Integer (Sum);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Dot_O11 (A.all, B.all);
+   end loop;
+   Report ("dot, -gnato11                :");
+   Check := Check + Long_Long_Integer (Sum);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Dot_O23 (A.all, B.all);
+   end loop;
+   Report ("dot, -gnato23                :");
+   Check := Check + Long_Long_Integer (Sum);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Dot_Flag (A.all, B.all, Overflow);
+   end loop;
+   Report ("dot, Checked + sticky flag   :");
+   Check := Check + Long_Long_Integer (Sum) + Boolean'Pos (Overflow);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Horner_O0 (A.all, R.all);
+   end loop;
+   Report ("horner, -gnato0              :");
+   Add_To_Check (R.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Horner_O11 (A.all, R.all);
+   end loop;
+   Report ("horner, -gnato11             :");
+   Add_To_Check (R.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Horner_O23 (A.all, R.all);
+   end loop;
+   Report ("horner, -gnato23             :");
+   Add_To_Check (R.all);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Horner_Flag (A.all, R.all, Overflow);
+   end loop;
+   Report ("horner, Checked + sticky flag:");
+   Add_To_Check (R.all);
+   Check := Check + Boolean'Pos (Overflow);
+
+   Put_Line ("checksum:" & Long_Long_Integer'Image (Check));
+end Bench;
@@ -0,0 +1,233 @@
+/*
+ * Benchmark: what overflow safety costs in arithmetic loops
+ * A dot product and a polynomial (Horner) over small values, so nothing
+ * overflows and every check passes: the numbers are the price of
+ * checking, not of handling
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "checked.h"
+
+#define N      1000000
+#define PASSES 50
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- Unchecked: wrapping through unsigned, cf. -gnato0 ---- */
+
+__attribute__((noipa)) static int32_t dot_wrap(const int32_t *a,
+                                               const int32_t *b, int n) {
+    uint32_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += (uint32_t)a[i] * (uint32_t)b[i];
+    }
+    return (int32_t)sum;
+}
+
+__attribute__((noipa)) static void horner_wrap(const int32_t *x, int32_t *r,
+                                               int n) {
+    for (int i = 0; i < n; i++) {
+        uint32_t v = (uint32_t)x[i];
+        r[i] = (int32_t)(((3 * v - 7) * v + 11) * v - 13);
+    }
+}
+
+/* ---- Builtins, abort on the first overflow: cf. -gnato11 ---- */
+
+__attribute__((noipa)) static int32_t dot_trap(const int32_t *a,
+                                               const int32_t *b, int n) {
+    int32_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        int32_t p;
+        if (__builtin_mul_overflow(a[i], b[i], &p)
+            || __builtin_add_overflow(sum, p, &sum)) {
+            abort();
+        }
+    }
+    return sum;
+}
+
+__attribute__((noipa)) static void horner_trap(const int32_t *x, int32_t *r,
+                                               int n) {
+    for (int i = 0; i < n; i++) {
+        int32_t v;
+        if (__builtin_mul_overflow(3, x[i], &v)
+            || __builtin_sub_overflow(v, 7, &v)
+            || __builtin_mul_overflow(v, x[i], &v)
+            || __builtin_add_overflow(v, 11, &v)
+            || __builtin_mul_overflow(v, x[i], &v)
+            || __builtin_sub_overflow(v, 13, &v)) {
+            abort();
+        }
+        r[i] = v;
+    }
+}
+
+/* ---- Builtins, sticky flag tested once at the end ---- */
+
+__attribute__((noipa)) static int32_t dot_flag(const int32_t *a,
+                                               const int32_t *b, int n,
+                                               bool *overflow) {
+    int32_t sum = 0;
+    bool any = false;
+    for (int i = 0; i < n; i++) {
+        ck_result32 p = ck_mul32(a[i], b[i]);
+        ck_result32 s = ck_add32(sum, p.value);
+        any |= p.overflow | s.overflow;
+        sum = s.value;
+    }
+    *overflow = any;
+    return sum;
+}
+
+__attribute__((noipa)) static void horner_flag(const int32_t *x, int32_t *r,
+                                               int n, bool *overflow) {
+    bool any = false;
+    for (int i = 0; i < n; i++) {
+        ck_result32 v = ck_mul32(3, x[i]);
+        bool o = v.overflow;
+        v = ck_sub32(v.value, 7);
+        o |= v.overflow;
+        v = ck_mul32(v.value, x[i]);
+        o |= v.overflow;
+        v = ck_add32(v.value, 11);
+        o |= v.overflow;
+        v = ck_mul32(v.value, x[i]);
+        o |= v.overflow;
+        v = ck_sub32(v.value, 13);
+        any |= o | v.overflow;
+        r[i] = v.value;
+    }
+    *overflow = any;
+}
+
+/* ---- 64-bit intermediates, one range check per result: cf. -gnato23 ---- */
+
+__attribute__((noipa)) static int32_t dot_wide(const int32_t *a,
+                                               const int32_t *b, int n) {
+    int32_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        int64_t s = (int64_t)sum + (int64_t)a[i] * b[i];
+        if (s < INT32_MIN || s > INT32_MAX) {
+            abort();
+        }
+        sum = (int32_t)s;
+    }
+    return sum;
+}
+
+__attribute__((noipa)) static void horner_wide(const int32_t *x, int32_t *r,
+                                               int n) {
+    for (int i = 0; i < n; i++) {
+        int64_t v = x[i];
+        int64_t p = ((3 * v - 7) * v + 11) * v - 13;
+        if (p < INT32_MIN || p > INT32_MAX) {
+            abort();
+        }
+        r[i] = (int32_t)p;
+    }
+}
+
+static int64_t checksum;
+
+static void report(const char *label, double start) {
+    printf("%-30s: %.3f ns/element\n", label,
+           (now_ns() - start) / ((double)N * PASSES));
+}
+
+static void add_to_checksum(const int32_t *r) {
+    for (int i = 0; i < N; i++) {
+        checksum += r[i];
+    }
+}
+
+int main(void) {
+    int32_t *a = malloc(N * sizeof *a);
+    int32_t *b = malloc(N * sizeof *b);
+    int32_t *r = malloc(N * sizeof *r);
+    if (!a || !b || !r) {
+        return 1;
+    }
+    // -100 .. 100: products and polynomial values stay far from the limits
+    for (int i = 0; i < N; i++) {
+        a[i] = (int32_t)(next_random() % 201) - 100;
+        b[i] = (int32_t)(next_random() % 201) - 100;
+    }
+
+    bool overflow = false;
+    int32_t sum = 0;
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = dot_wrap(a, b, N);
+    }
+    report("dot, unchecked", start);
+    checksum += sum;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = dot_trap(a, b, N);
+    }
+    report("dot, builtin + abort", start);
+    checksum += sum;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = dot_flag(a, b, N, &overflow);
+    }
+    report("dot, builtin + sticky flag", start);
+    checksum += sum + overflow;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = dot_wide(a, b, N);
+    }
+    report("dot, 64-bit + range check", start);
+    checksum += sum;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        horner_wrap(a, r, N);
+    }
+    report("horner, unchecked", start);
+    add_to_checksum(r);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        horner_trap(a, r, N);
+    }
+    report("horner, builtin + abort", start);
+    add_to_checksum(r);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        horner_flag(a, r, N, &overflow);
+    }
+    report("horner, builtin + sticky flag", start);
+    add_to_checksum(r);
+    checksum += overflow;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        horner_wide(a, r, N);
+    }
+    report("horner, 64-bit + range check", start);
+    add_to_checksum(r);
+
+    printf("checksum: %lld\n", (long long)checksum);
+    return 0;
+}
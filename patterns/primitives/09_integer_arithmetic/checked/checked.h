@@ -0,0 +1,60 @@
+/*
+ * Checked arithmetic: the result and an overflow flag
+ * The GCC builtins compute the exact result, report whether it fits,
+ * and store it wrapped to the size of the type. One add or imul, then
+ * seto: the flag costs one instruction
+ */
+
+#ifndef CHECKED_H
+#define CHECKED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    int32_t value;
+    bool overflow;
+} ck_result32;
+
+typedef struct {
+    int64_t value;
+    bool overflow;
+} ck_result64;
+
+static inline ck_result32 ck_add32(int32_t a, int32_t b) {
+    ck_result32 r;
+    r.overflow = __builtin_add_overflow(a, b, &r.value);
+    return r;
+}
+
+static inline ck_result32 ck_sub32(int32_t a, int32_t b) {
+    ck_result32 r;
+    r.overflow = __builtin_sub_overflow(a, b, &r.value);
+    return r;
+}
+
+static inline ck_result32 ck_mul32(int32_t a, int32_t b) {
+    ck_result32 r;
+    r.overflow = __builtin_mul_overflow(a, b, &r.value);
+    return r;
+}
+
+static inline ck_result64 ck_add64(int64_t a, int64_t b) {
+    ck_result64 r;
+    r.overflow = __builtin_add_overflow(a, b, &r.value);
+    return r;
+}
+
+static inline ck_result64 ck_sub64(int64_t a, int64_t b) {
+    ck_result64 r;
+    r.overflow = __builtin_sub_overflow(a, b, &r.value);
+    return r;
+}
+
+static inline ck_result64 ck_mul64(int64_t a, int64_t b) {
+    ck_result64 r;
+    r.overflow = __builtin_mul_overflow(a, b, &r.value);
+    return r;
+}
+
+#endif
@@ -0,0 +1,33 @@
+--  Checked arithmetic: the result and an overflow flag
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Checked;     use Checked;
+
+procedure Example is
+
+   procedure Print (Label : String; R : Result) is
+   begin
+      Put_Line (Label & " value" & Integer'Image (R.Value)
+                & ", overflow " & Boolean'Image (R.Overflow));
+   end Print;
+
+   X, Y : Result;
+   W    : Long_Result;
+
+begin
+   --  Integer'Last + 1 fails a check; Add reports it instead
+   Print ("Integer'Last + 1:", Add (Integer'Last, 1));
+   Print ("10 - 3:          ", Sub (10, 3));
+   Print ("100000 * 100000: ", Mul (100_000, 100_000));
+
+   --  Several steps, one test: the flags are or-ed together
+   X := Mul (46_341, 46_341);
+   Y := Sub (X.Value, 1);
+   Y.Overflow := X.Overflow or Y.Overflow;
+   Print ("46341**2 - 1:    ", Y);
+
+   W := Mul (Long_Long_Integer'Last, 2);
+   Put_Line ("Long_Long_Integer'Last * 2: value"
+             & Long_Long_Integer'Image (W.Value)
+             & ", overflow " & Boolean'Image (W.Overflow));
+end Example;
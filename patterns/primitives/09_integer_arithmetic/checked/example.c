@@ -0,0 +1,29 @@
+/*
+ * Checked arithmetic: the result and an overflow flag
+ */
+
+#include <stdio.h>
+#include "checked.h"
+
+int main(void) {
+    // a + b with no check is undefined behaviour when it overflows
+    ck_result32 r = ck_add32(INT32_MAX, 1);
+    printf("INT32_MAX + 1:   value %d, overflow %d\n", r.value, r.overflow);
+
+    r = ck_sub32(10, 3);
+    printf("10 - 3:          value %d, overflow %d\n", r.value, r.overflow);
+
+    r = ck_mul32(100000, 100000);
+    printf("100000 * 100000: value %d, overflow %d\n", r.value, r.overflow);
+
+    // Several steps, one test: the flags are or-ed together
+    ck_result32 x = ck_mul32(46341, 46341);
+    ck_result32 y = ck_sub32(x.value, 1);
+    printf("46341^2 - 1:     value %d, overflow %d\n",
+           y.value, x.overflow | y.overflow);
+
+    ck_result64 w = ck_mul64(INT64_MAX, 2);
+    printf("INT64_MAX * 2:   value %lld, overflow %d\n",
+           (long long)w.value, w.overflow);
+    return 0;
+}
@@ -0,0 +1,155 @@
+--  Benchmark: Float against the decimal fixed-point kernels, over the
+--  readings of bench.c, -1000.0 .. 1000.0 in tenths
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Fixed_Point;   use Fixed_Point;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 50;
+
+   type Float_Array is array (1 .. N) of Float;
+   subtype Reading_Array is Degrees_Array (1 .. N);
+
+   type Float_Access is access Float_Array;
+   type Reading_Access is access Reading_Array;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   -----------
+   -- Float --
+   -----------
+
+   function Sum_Float (A : Float_Array) return Float is
+      Result : Float := 0.0;
+   begin
+      for I in A'Range loop
+         Result := Result + A (I);
+      end loop;
+      return Result;
+   end Sum_Float;
+   pragma Machine_Attribute (Sum_Float, "noipa");
+
+   procedure Scale_Float (A : Float_Array; G : Float; R : out Float_Array) is
+   begin
+      for I in A'Range loop
+         R (I) := A (I) * G;
+      end loop;
+   end Scale_Float;
+   pragma Machine_Attribute (Scale_Float, "noipa");
+
+   procedure Celsius_Float (F : Float_Array; C : out Float_Array) is
+   begin
+      for I in F'Range loop
+         C (I) := (F (I) - 32.0) * 5.0 / 9.0;
+      end loop;
+   end Celsius_Float;
+   pragma Machine_Attribute (Celsius_Float, "noipa");
+
+   -----------------
+   -- Fixed point --
+   -----------------
+
+   function Sum_Fixed (A : Reading_Array) return Total is (Sum (A));
+   pragma Machine_Attribute (Sum_Fixed, "noipa");
+
+   procedure Scale_Fixed
+     (A : Reading_Array; G : Ratio; R : in out Reading_Array) is
+   begin
+      Scale_All (A, G, R);
+   end Scale_Fixed;
+   pragma Machine_Attribute (Scale_Fixed, "noipa");
+
+   procedure Celsius_Fixed (F : Reading_Array; C : in out Reading_Array) is
+   begin
+      To_Celsius_All (F, C);
+   end Celsius_Fixed;
+   pragma Machine_Attribute (Celsius_Fixed, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   XF : constant Float_Access := new Float_Array;
+   RF : constant Float_Access := new Float_Array;
+   XD : constant Reading_Access := new Reading_Array;
+   RD : constant Reading_Access := new Reading_Array := (others => 0.0);
+
+   Sum_F : Float := 0.0;
+   Sum_D : Total := 0.0;
+   Check : Long_Float := 0.0;
+   Start : Time;
+
+   procedure Report (Label : String; Start : Time) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Passes)) &
+                " ns/element");
+   end Report;
+
+begin
+   for I in 1 .. N loop
+      XD (I) := Degrees'(0.1) * (Integer (Next_Random mod 20_001) - 10_000);
+      XF (I) := Float (XD (I));
+   end loop;
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum_F := Sum_F + Sum_Float (XF.all);
+   end loop;
+   Report ("sum, Float              :", Start);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum_D := Sum_D + Sum_Fixed (XD.all);
+   end loop;
+   Report ("sum, Degrees            :", Start);
+   Put_Line ("  Float sum" & Float'Image (Sum_F / Float (Passes)) &
+             ", exact" & Total'Image (Sum_D / Passes));
+   Check := Check + Long_Float (Sum_F) + Long_Float (Sum_D);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Scale_Float (XF.all, 0.8125, RF.all);
+   end loop;
+   Report ("scale, Float            :", Start);
+   Check := Check + Long_Float (RF (N / 2));
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Scale_Fixed (XD.all, 0.8125, RD.all);
+   end loop;
+   Report ("scale, Degrees          :", Start);
+   Check := Check + Long_Float (RD (N / 2));
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Celsius_Float (XF.all, RF.all);
+   end loop;
+   Report ("to Celsius, Float       :", Start);
+   Check := Check + Long_Float (RF (N / 2));
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Celsius_Fixed (XD.all, RD.all);
+   end loop;
+   Report ("to Celsius, Degrees     :", Start);
+   Check := Check + Long_Float (RD (N / 2));
+
+   Put_Line ("checksum:" & Long_Float'Image (Check));
+end Bench;
@@ -0,0 +1,148 @@
+/*
+ * Benchmark: float against int-scaled fixed point over arrays of
+ * temperature readings, -1000.0 .. 1000.0 in tenths
+ * - sum: float accumulator against an exact 64-bit one
+ * - scale by a gain of 0.8125
+ * - convert Fahrenheit to Celsius, (F - 32) * 5 / 9
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "fixed_point.h"
+
+#define N      1000000
+#define PASSES 50
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- float ---- */
+
+__attribute__((noipa)) static float sum_float(const float *a, size_t n) {
+    float total = 0.0f;
+    for (size_t i = 0; i < n; i++) {
+        total += a[i];
+    }
+    return total;
+}
+
+__attribute__((noipa)) static void scale_float(float *r, const float *a,
+                                               size_t n, float g) {
+    for (size_t i = 0; i < n; i++) {
+        r[i] = a[i] * g;
+    }
+}
+
+__attribute__((noipa)) static void celsius_float(float *c, const float *f,
+                                                 size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        c[i] = (f[i] - 32.0f) * 5.0f / 9.0f;
+    }
+}
+
+/* ---- fixed point ---- */
+
+__attribute__((noipa)) static int64_t sum_fixed(const fx_degrees *a,
+                                                size_t n) {
+    return fx_sum(a, n);
+}
+
+__attribute__((noipa)) static void scale_fixed(fx_degrees *r,
+                                               const fx_degrees *a, size_t n,
+                                               fx_ratio g) {
+    fx_scale(r, a, n, g);
+}
+
+__attribute__((noipa)) static void celsius_fixed(fx_degrees *c,
+                                                 const fx_degrees *f,
+                                                 size_t n) {
+    fx_to_celsius(c, f, n);
+}
+
+/* ---- driver ---- */
+
+static double checksum;
+
+static void report(const char *label, double start) {
+    printf("%-22s: %.3f ns/element\n", label,
+           (now_ns() - start) / ((double)N * PASSES));
+}
+
+int main(void) {
+    float *xf = malloc(N * sizeof *xf);
+    float *rf = malloc(N * sizeof *rf);
+    fx_degrees *xd = malloc(N * sizeof *xd);
+    fx_degrees *rd = malloc(N * sizeof *rd);
+    if (!xf || !rf || !xd || !rd) {
+        return 1;
+    }
+    for (size_t i = 0; i < N; i++) {
+        xd[i] = (fx_degrees)(next_random() % 20001) - 10000;
+        xf[i] = (float)xd[i] / 10.0f;
+    }
+
+    double start = now_ns();
+    float sf = 0.0f;
+    for (int p = 0; p < PASSES; p++) {
+        sf += sum_float(xf, N);
+    }
+    report("sum, float", start);
+
+    start = now_ns();
+    int64_t sd = 0;
+    for (int p = 0; p < PASSES; p++) {
+        sd += sum_fixed(xd, N);
+    }
+    report("sum, fixed", start);
+    printf("  float sum %.1f, exact %.1f\n", sf / PASSES,
+           (double)sd / PASSES / 10.0);
+    checksum += sf + (double)sd;
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        scale_float(rf, xf, N, 0.8125f);
+    }
+    report("scale, float", start);
+    checksum += rf[N / 2];
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        scale_fixed(rd, xd, N, 8125);
+    }
+    report("scale, fixed", start);
+    checksum += rd[N / 2];
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        celsius_float(rf, xf, N);
+    }
+    report("to Celsius, float", start);
+    checksum += rf[N / 2];
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        celsius_fixed(rd, xd, N);
+    }
+    report("to Celsius, fixed", start);
+    checksum += rd[N / 2];
+
+    printf("checksum: %.1f\n", checksum);
+    free(xf);
+    free(rf);
+    free(xd);
+    free(rd);
+    return 0;
+}
@@ -0,0 +1,33 @@
+--  Fixed point: temperatures as whole numbers of tenths of a degree
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Fixed_Point; use Fixed_Point;
+
+procedure Example is
+
+   Temperature : constant Float := 98.6;
+   Fixed       : constant Degrees := 98.6;
+
+   Float_Readings : constant array (1 .. 10) of Float := (others => 0.1);
+   Readings       : constant Degrees_Array (1 .. 10) := (others => 0.1);
+
+   Float_Total : Float := 0.0;
+
+begin
+   --  98.6 has no exact binary form; 986 tenths is exact
+   Put_Line ("Float 98.6:           "
+             & Long_Float'Image (Long_Float (Temperature)));
+   Put_Line ("Degrees 98.6:         " & Degrees'Image (Fixed));
+
+   for R of Float_Readings loop
+      Float_Total := Float_Total + R;
+   end loop;
+   Put_Line ("Float sum of 10 x 0.1:"
+             & Long_Float'Image (Long_Float (Float_Total)));
+   Put_Line ("Sum of 10 x 0.1:      " & Total'Image (Sum (Readings)));
+
+   Put_Line ("98.6 F in Celsius:    " & Degrees'Image (To_Celsius (Fixed)));
+   Put_Line ("-40.0 F in Celsius:   " & Degrees'Image (To_Celsius (-40.0)));
+   Put_Line ("0.0 F in Celsius:     " & Degrees'Image (To_Celsius (0.0)));
+   Put_Line ("98.6 scaled by 0.5:   " & Degrees'Image (Scale (Fixed, 0.5)));
+end Example;
@@ -0,0 +1,43 @@
+/*
+ * Fixed point: temperatures as whole numbers of tenths of a degree
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fixed_point.h"
+
+// Tenths as text: -177 is -17.7
+static void print_degrees(const char *label, fx_degrees x) {
+    printf("%s%s%d.%d\n", label, x < 0 ? "-" : "", abs(x) / 10, abs(x) % 10);
+}
+
+int main(void) {
+    float temperature = 98.6f;
+    fx_degrees fixed = 986;
+
+    // 98.6 has no exact binary form; 986 tenths is exact
+    printf("Float 98.6:            %.10f\n", temperature);
+    print_degrees("Fixed 98.6:            ", fixed);
+
+    // Ten readings of 0.1
+    float float_readings[10];
+    fx_degrees readings[10];
+    for (int i = 0; i < 10; i++) {
+        float_readings[i] = 0.1f;
+        readings[i] = 1;
+    }
+    float float_total = 0.0f;
+    for (int i = 0; i < 10; i++) {
+        float_total += float_readings[i];
+    }
+    printf("Float sum of 10 x 0.1: %.10f\n", float_total);
+    printf("Fixed sum of 10 x 0.1: %lld.%lld\n",
+           (long long)fx_sum(readings, 10) / 10,
+           (long long)fx_sum(readings, 10) % 10);
+
+    print_degrees("98.6 F in Celsius:     ", fx_to_celsius1(fixed));
+    print_degrees("-40.0 F in Celsius:    ", fx_to_celsius1(-400));
+    print_degrees("0.0 F in Celsius:      ", fx_to_celsius1(0));
+    print_degrees("98.6 scaled by 0.5:    ", fx_scale1(fixed, 5000));
+    return 0;
+}
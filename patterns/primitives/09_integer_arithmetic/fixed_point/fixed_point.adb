@@ -0,0 +1,36 @@
+package body Fixed_Point is
+
+   --  Each reading adds at most Max_Reading in magnitude, so after K of
+   --  them the total is within K * Max_Reading: at most 10 ** 12 tenths
+   --  for Max_Count readings, well inside Total
+   function Sum (A : Degrees_Array) return Total is
+      Result : Total := 0.0;
+   begin
+      for I in A'Range loop
+         Result := Result + Total (A (I));
+         pragma Loop_Invariant
+            (abs Result <= Max_Reading * (I - A'First + 1));
+      end loop;
+      return Result;
+   end Sum;
+
+   procedure Scale_All (A : Degrees_Array; G : Ratio; R : in out Degrees_Array)
+   is
+   begin
+      for I in A'Range loop
+         R (I) := Scale (A (I), G);
+         pragma Loop_Invariant
+            (for all J in A'First .. I => R (J) = Scale (A (J), G));
+      end loop;
+   end Scale_All;
+
+   procedure To_Celsius_All (F : Degrees_Array; C : in out Degrees_Array) is
+   begin
+      for I in F'Range loop
+         C (I) := To_Celsius (F (I));
+         pragma Loop_Invariant
+            (for all J in F'First .. I => C (J) = To_Celsius (F (J)));
+      end loop;
+   end To_Celsius_All;
+
+end Fixed_Point;
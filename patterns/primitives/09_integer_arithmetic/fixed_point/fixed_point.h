@@ -0,0 +1,61 @@
+/*
+ * Fixed point: a temperature held as a whole number of tenths of a degree
+ * The C twin of Ada's `delta 0.1 digits 5`: sums are exact, and products
+ * and quotients truncate toward zero, as Ada's decimal types do
+ */
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Tenths of a degree: -99999 .. 99999 is -9999.9 .. 9999.9
+typedef int32_t fx_degrees;
+
+// Ten-thousandths: 0 .. 10000 is 0.0 .. 1.0
+typedef int32_t fx_ratio;
+
+#define FX_DEGREES_MAX 99999
+#define FX_RATIO_ONE   10000
+
+// A sum of this many readings fits in 64 bits with room to spare; the
+// bound that matters is the Ada one, 10 ** 14 tenths in `digits 15`
+#define FX_MAX_COUNT 100000000
+
+// Exact: the scaled values are added as integers
+static inline int64_t fx_sum(const fx_degrees *a, size_t n) {
+    int64_t total = 0;
+    for (size_t i = 0; i < n; i++) {
+        total += a[i];
+    }
+    return total;
+}
+
+// 99999 * 10000 < 2 ** 31, so the product fits in 32 bits. Division
+// truncates toward zero, as the conversion of an Ada decimal product does
+static inline fx_degrees fx_scale1(fx_degrees x, fx_ratio g) {
+    return x * g / FX_RATIO_ONE;
+}
+
+static inline void fx_scale(fx_degrees *r, const fx_degrees *a, size_t n,
+                            fx_ratio g) {
+    for (size_t i = 0; i < n; i++) {
+        r[i] = fx_scale1(a[i], g);
+    }
+}
+
+// (F - 32) * 5 / 9 in tenths: 32 degrees is 320 tenths. The largest
+// intermediate is (99999 + 320) * 5, well inside 32 bits
+static inline fx_degrees fx_to_celsius1(fx_degrees f) {
+    return (f - 320) * 5 / 9;
+}
+
+static inline void fx_to_celsius(fx_degrees *c, const fx_degrees *f,
+                                 size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        c[i] = fx_to_celsius1(f[i]);
+    }
+}
+
+#endif
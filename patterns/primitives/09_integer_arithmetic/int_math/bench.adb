@@ -0,0 +1,256 @@
+--  Benchmark: the Int_Math kernels against the usual loops, on the same
+--  data as bench.c
+--  The libm square root and Montgomery multiplication are C-only
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Int_Math;      use Int_Math;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 10;
+   Pow_N  : constant := 100_000;
+
+   type Data_Array is array (1 .. N) of Unsigned_64;
+   type Data_Access is access Data_Array;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   function Random_64 return Unsigned_64 is
+      Hi : constant Unsigned_64 := Unsigned_64 (Next_Random);
+   begin
+      return Shift_Left (Hi, 32) or Unsigned_64 (Next_Random);
+   end Random_64;
+
+   --  Random bit length, so small and large inputs are equally common
+   function Random_Value return Unsigned_64 is
+      U : constant Unsigned_64 := Random_64;
+   begin
+      return Shift_Right (U, Natural (Next_Random mod 64));
+   end Random_Value;
+
+   -----------------
+   -- Square root --
+   -----------------
+
+   function Isqrt_Newton (X : Data_Array) return Unsigned_64 is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in X'Range loop
+         Sum := Sum + Unsigned_64 (Isqrt (X (I)));
+      end loop;
+      return Sum;
+   end Isqrt_Newton;
+   pragma Machine_Attribute (Isqrt_Newton, "noipa");
+
+   --  One result bit per step, from the top
+   function Isqrt_Bitwise (X : Data_Array) return Unsigned_64 is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in X'Range loop
+         declare
+            V   : Unsigned_64 := X (I);
+            R   : Unsigned_64 := 0;
+            Bit : Unsigned_64 := Shift_Left (1, 62);
+         begin
+            while Bit > V loop
+               Bit := Shift_Right (Bit, 2);
+            end loop;
+            while Bit /= 0 loop
+               if V >= R + Bit then
+                  V := V - (R + Bit);
+                  R := Shift_Right (R, 1) + Bit;
+               else
+                  R := Shift_Right (R, 1);
+               end if;
+               Bit := Shift_Right (Bit, 2);
+            end loop;
+            Sum := Sum + R;
+         end;
+      end loop;
+      return Sum;
+   end Isqrt_Bitwise;
+   pragma Machine_Attribute (Isqrt_Bitwise, "noipa");
+
+   ----------
+   -- Log2 --
+   ----------
+
+   function Log2_Clz (X : Data_Array) return Unsigned_64 is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in X'Range loop
+         Sum := Sum + Unsigned_64 (Log2 (X (I) or 1));
+      end loop;
+      return Sum;
+   end Log2_Clz;
+   pragma Machine_Attribute (Log2_Clz, "noipa");
+
+   function Log2_Loop (X : Data_Array) return Unsigned_64 is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in X'Range loop
+         declare
+            V : Unsigned_64 := Shift_Right (X (I) or 1, 1);
+            L : Unsigned_64 := 0;
+         begin
+            while V /= 0 loop
+               V := Shift_Right (V, 1);
+               L := L + 1;
+            end loop;
+            Sum := Sum + L;
+         end;
+      end loop;
+      return Sum;
+   end Log2_Loop;
+   pragma Machine_Attribute (Log2_Loop, "noipa");
+
+   ---------
+   -- GCD --
+   ---------
+
+   function Gcd_Binary (A, B : Data_Array) return Unsigned_64 is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in A'Range loop
+         Sum := Sum + Gcd (A (I), B (I));
+      end loop;
+      return Sum;
+   end Gcd_Binary;
+   pragma Machine_Attribute (Gcd_Binary, "noipa");
+
+   function Gcd_Euclid (A, B : Data_Array) return Unsigned_64 is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in A'Range loop
+         declare
+            X : Unsigned_64 := A (I);
+            Y : Unsigned_64 := B (I);
+            T : Unsigned_64;
+         begin
+            while Y /= 0 loop
+               T := X mod Y;
+               X := Y;
+               Y := T;
+            end loop;
+            Sum := Sum + X;
+         end;
+      end loop;
+      return Sum;
+   end Gcd_Euclid;
+   pragma Machine_Attribute (Gcd_Euclid, "noipa");
+
+   ----------------------------
+   -- Modular exponentiation --
+   ----------------------------
+
+   function Pow_Mod_128 (Base, E : Data_Array; M : Modulus)
+      return Unsigned_64
+   is
+      Sum : Unsigned_64 := 0;
+   begin
+      for I in 1 .. Pow_N loop
+         Sum := Sum + Mod_Pow (Base (I), E (I), M);
+      end loop;
+      return Sum;
+   end Pow_Mod_128;
+   pragma Machine_Attribute (Pow_Mod_128, "noipa");
+
+   A : constant Data_Access := new Data_Array;
+   B : constant Data_Access := new Data_Array;
+   C : constant Data_Access := new Data_Array;
+   D : constant Data_Access := new Data_Array;
+   E : constant Data_Access := new Data_Array'(others => 0);
+
+   --  The largest prime below 2**63
+   M : constant Modulus := 9_223_372_036_854_775_783;
+
+   Sum   : Unsigned_64 := 0;
+   Start : Time;
+
+   procedure Report (Label : String; Count : Positive) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Count * Passes)) &
+                " ns/call  (sum" & Unsigned_64'Image (Sum) & ")");
+   end Report;
+
+begin
+   for I in 1 .. N loop
+      A (I) := Random_Value;
+      B (I) := Random_Value;
+      C (I) := Random_64;
+      D (I) := Random_64;
+   end loop;
+   for I in 1 .. Pow_N loop
+      E (I) := Random_64;
+   end loop;
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Isqrt_Newton (A.all);
+   end loop;
+   Report ("isqrt, Newton        :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Isqrt_Bitwise (A.all);
+   end loop;
+   Report ("isqrt, bit by bit    :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Log2_Clz (A.all);
+   end loop;
+   Report ("log2, clz            :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Log2_Loop (A.all);
+   end loop;
+   Report ("log2, shift loop     :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Gcd_Binary (C.all, D.all);
+   end loop;
+   Report ("gcd 64-bit, binary   :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Gcd_Euclid (C.all, D.all);
+   end loop;
+   Report ("gcd 64-bit, Euclid   :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Gcd_Binary (A.all, B.all);
+   end loop;
+   Report ("gcd mixed, binary    :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Gcd_Euclid (A.all, B.all);
+   end loop;
+   Report ("gcd mixed, Euclid    :", N);
+
+   Start := Clock;
+   for P in 1 .. Passes loop
+      Sum := Pow_Mod_128 (A.all, E.all, M);
+   end loop;
+   Report ("pow_mod, 128-bit     :", Pow_N);
+end Bench;
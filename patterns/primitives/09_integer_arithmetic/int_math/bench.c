@@ -0,0 +1,308 @@
+/*
+ * Benchmark: the int_math.h kernels against the usual loops
+ * - isqrt: Newton from a clz start, the bit-by-bit method, and
+ *   libm sqrt with a correction step
+ * - log2: clz against a shift loop
+ * - gcd: binary GCD against Euclid's remainder loop, on full 64-bit
+ *   operands and on operands of random length
+ * - pow_mod: 128-bit products against Montgomery multiplication
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "int_math.h"
+
+#define N        1000000
+#define PASSES   10
+#define POW_N    100000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Random bit length, so small and large inputs are equally common
+static uint64_t random_value(void) {
+    uint64_t u = ((uint64_t)next_random() << 32) | next_random();
+    return u >> (next_random() % 64);
+}
+
+/* ---- isqrt ---- */
+
+__attribute__((noipa)) static uint64_t isqrt_newton(const uint64_t *x, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += im_isqrt(x[i]);
+    }
+    return sum;
+}
+
+// One result bit per step, from the top
+__attribute__((noipa)) static uint64_t isqrt_bitwise(const uint64_t *x, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t v = x[i];
+        uint64_t r = 0;
+        uint64_t bit = (uint64_t)1 << 62;
+        while (bit > v) {
+            bit >>= 2;
+        }
+        while (bit != 0) {
+            if (v >= r + bit) {
+                v -= r + bit;
+                r = (r >> 1) + bit;
+            } else {
+                r >>= 1;
+            }
+            bit >>= 2;
+        }
+        sum += r;
+    }
+    return sum;
+}
+
+// A double has 53 bits: the estimate can be off by one either way
+__attribute__((noipa)) static uint64_t isqrt_libm(const uint64_t *x, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t r = (uint64_t)sqrt((double)x[i]);
+        if (r > 0xFFFFFFFF) {
+            r = 0xFFFFFFFF;
+        }
+        while (r * r > x[i]) {
+            r--;
+        }
+        while ((r + 1) * (r + 1) <= x[i] && r < 0xFFFFFFFF) {
+            r++;
+        }
+        sum += r;
+    }
+    return sum;
+}
+
+/* ---- log2 ---- */
+
+__attribute__((noipa)) static uint64_t log2_clz(const uint64_t *x, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += im_log2(x[i] | 1);
+    }
+    return sum;
+}
+
+__attribute__((noipa)) static uint64_t log2_loop(const uint64_t *x, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t v = x[i] | 1;
+        int l = 0;
+        while (v >>= 1) {
+            l++;
+        }
+        sum += l;
+    }
+    return sum;
+}
+
+/* ---- gcd ---- */
+
+__attribute__((noipa)) static uint64_t gcd_binary(const uint64_t *a,
+                                                  const uint64_t *b, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += im_gcd(a[i], b[i]);
+    }
+    return sum;
+}
+
+__attribute__((noipa)) static uint64_t gcd_euclid(const uint64_t *a,
+                                                  const uint64_t *b, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t x = a[i];
+        uint64_t y = b[i];
+        while (y != 0) {
+            uint64_t t = x % y;
+            x = y;
+            y = t;
+        }
+        sum += x;
+    }
+    return sum;
+}
+
+/* ---- pow_mod ---- */
+
+__attribute__((noipa)) static uint64_t pow_mod_128(const uint64_t *base,
+                                                   const uint64_t *e,
+                                                   uint64_t m, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += im_pow_mod(base[i], e[i], m);
+    }
+    return sum;
+}
+
+// Montgomery form with R = 2**64, odd m < 2**63: x is kept as x * R mod m,
+// and REDC replaces the 128-bit division by two multiplies and a shift
+typedef struct {
+    uint64_t m;
+    uint64_t m_inv;   // -m**-1 mod 2**64
+    uint64_t r2;      // R**2 mod m
+} montgomery;
+
+static montgomery mont_init(uint64_t m) {
+    montgomery mt;
+    uint64_t inv = m;   // correct to 3 bits for odd m
+    for (int i = 0; i < 5; i++) {
+        inv *= 2 - m * inv;
+    }
+    mt.m = m;
+    mt.m_inv = -inv;
+    unsigned __int128 r = ((unsigned __int128)1 << 64) % m;
+    mt.r2 = (uint64_t)(r * r % m);
+    return mt;
+}
+
+static inline uint64_t redc(const montgomery *mt, unsigned __int128 t) {
+    uint64_t u = (uint64_t)t * mt->m_inv;
+    uint64_t r = (uint64_t)((t + (unsigned __int128)u * mt->m) >> 64);
+    return r >= mt->m ? r - mt->m : r;
+}
+
+static inline uint64_t mont_mul(const montgomery *mt, uint64_t a, uint64_t b) {
+    return redc(mt, (unsigned __int128)a * b);
+}
+
+static inline uint64_t mont_pow(const montgomery *mt, uint64_t base,
+                                uint64_t e) {
+    uint64_t x = mont_mul(mt, base % mt->m, mt->r2);
+    uint64_t result = mont_mul(mt, 1, mt->r2);
+    while (e != 0) {
+        if (e & 1) {
+            result = mont_mul(mt, result, x);
+        }
+        x = mont_mul(mt, x, x);
+        e >>= 1;
+    }
+    return redc(mt, result);
+}
+
+__attribute__((noipa)) static uint64_t pow_mod_montgomery(const uint64_t *base,
+                                                          const uint64_t *e,
+                                                          uint64_t m, int n) {
+    montgomery mt = mont_init(m);
+    uint64_t sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += mont_pow(&mt, base[i], e[i]);
+    }
+    return sum;
+}
+
+static void report(const char *label, double start, int count,
+                   uint64_t sum) {
+    printf("%-22s: %8.2f ns/call  (sum %llu)\n", label,
+           (now_ns() - start) / ((double)count * PASSES),
+           (unsigned long long)sum);
+}
+
+int main(void) {
+    uint64_t *a = malloc(N * sizeof *a);
+    uint64_t *b = malloc(N * sizeof *b);
+    uint64_t *c = malloc(N * sizeof *c);
+    uint64_t *d = malloc(N * sizeof *d);
+    uint64_t *e = malloc(POW_N * sizeof *e);
+    if (!a || !b || !c || !d || !e) {
+        return 1;
+    }
+    for (int i = 0; i < N; i++) {
+        a[i] = random_value();
+        b[i] = random_value();
+        c[i] = ((uint64_t)next_random() << 32) | next_random();
+        d[i] = ((uint64_t)next_random() << 32) | next_random();
+    }
+    for (int i = 0; i < POW_N; i++) {
+        e[i] = ((uint64_t)next_random() << 32) | next_random();
+    }
+    // The largest prime below 2**63
+    const uint64_t m = 9223372036854775783ULL;
+
+    uint64_t sum = 0;
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = isqrt_newton(a, N);
+    }
+    report("isqrt, Newton", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = isqrt_bitwise(a, N);
+    }
+    report("isqrt, bit by bit", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = isqrt_libm(a, N);
+    }
+    report("isqrt, libm + fix-up", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = log2_clz(a, N);
+    }
+    report("log2, clz", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = log2_loop(a, N);
+    }
+    report("log2, shift loop", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = gcd_binary(c, d, N);
+    }
+    report("gcd 64-bit, binary", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = gcd_euclid(c, d, N);
+    }
+    report("gcd 64-bit, Euclid", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = gcd_binary(a, b, N);
+    }
+    report("gcd mixed, binary", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = gcd_euclid(a, b, N);
+    }
+    report("gcd mixed, Euclid", start, N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = pow_mod_128(a, e, m, POW_N);
+    }
+    report("pow_mod, 128-bit", start, POW_N, sum);
+
+    start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        sum = pow_mod_montgomery(a, e, m, POW_N);
+    }
+    report("pow_mod, Montgomery", start, POW_N, sum);
+    return 0;
+}
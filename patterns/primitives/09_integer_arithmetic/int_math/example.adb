@@ -0,0 +1,33 @@
+--  Integer math kernels: square root, log2, GCD and modular power
+--  without floating point or division loops
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Interfaces;  use Interfaces;
+with Int_Math;    use Int_Math;
+
+procedure Example is
+
+   P : constant Modulus := 9_223_372_036_854_775_783;
+
+begin
+   Put_Line ("Isqrt (2**64 - 1):         "
+             & Unsigned_32'Image (Isqrt (Unsigned_64'Last)));
+   Put_Line ("Isqrt (10**18):            "
+             & Unsigned_32'Image (Isqrt (10 ** 18)));
+   Put_Line ("Isqrt (99):                " & Unsigned_32'Image (Isqrt (99)));
+
+   --  Log2 has Pre => X /= 0: Log2 (0) is rejected by the prover
+   Put_Line ("Log2 (1):                  " & Bit_Count'Image (Log2 (1)));
+   Put_Line ("Log2 (2**40 + 1):          "
+             & Bit_Count'Image (Log2 (2 ** 40 + 1)));
+
+   Put_Line ("Gcd (2**40 * 3, 2**20 * 9):"
+             & Unsigned_64'Image (Gcd (3 * 2 ** 40, 9 * 2 ** 20)));
+   Put_Line ("Gcd (0, 42):               " & Unsigned_64'Image (Gcd (0, 42)));
+
+   --  Fermat: A**(P - 1) = 1 mod P for a prime P
+   Put_Line ("2**(P - 1) mod P:          "
+             & Unsigned_64'Image (Mod_Pow (2, P - 1, P)));
+   Put_Line ("3**123 mod 1000:           "
+             & Unsigned_64'Image (Mod_Pow (3, 123, 1000)));
+end Example;
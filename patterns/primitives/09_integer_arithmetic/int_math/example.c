@@ -0,0 +1,34 @@
+/*
+ * Integer math kernels: square root, log2, GCD and modular power
+ * without floating point or division loops
+ */
+
+#include <stdio.h>
+#include "int_math.h"
+
+int main(void) {
+    // (uint64_t)sqrt((double)x) is wrong here: the double rounds up to 2**64
+    uint64_t big = UINT64_MAX;
+    printf("isqrt(2**64 - 1):          %u\n", im_isqrt(big));
+    printf("isqrt(10**18):             %u\n",
+           im_isqrt(1000000000000000000ULL));
+    printf("isqrt(99):                 %u\n", im_isqrt(99));
+
+    // im_log2(0) and im_clz64(0) are undefined: the caller must check
+    printf("log2(1):                   %d\n", im_log2(1));
+    printf("log2(2**40 + 1):           %d\n",
+           im_log2(((uint64_t)1 << 40) + 1));
+
+    printf("gcd(2**40 * 3, 2**20 * 9): %llu\n",
+           (unsigned long long)im_gcd((uint64_t)3 << 40, (uint64_t)9 << 20));
+    printf("gcd(0, 42):                %llu\n",
+           (unsigned long long)im_gcd(0, 42));
+
+    // Fermat: a**(p-1) = 1 mod p for a prime p
+    uint64_t p = 9223372036854775783ULL;
+    printf("2**(p-1) mod p:            %llu\n",
+           (unsigned long long)im_pow_mod(2, p - 1, p));
+    printf("3**123 mod 1000:           %llu\n",
+           (unsigned long long)im_pow_mod(3, 123, 1000));
+    return 0;
+}
@@ -0,0 +1,324 @@
+package body Int_Math is
+
+   --  The lemmas about products modulo M multiply three residues, which
+   --  overflows Wider: assertions are evaluated in mathematical integers
+   pragma Overflow_Mode (General => Strict, Assertions => Eliminated);
+
+   -----------------
+   -- Square root --
+   -----------------
+
+   --  One Newton step from any R > 0 lands at or above the root:
+   --  with Q = X / R and T = Y + 1, X < (Q + 1) * R <= (2 * T - R) * R,
+   --  and (2 * T - R) * R <= T * T because (T - R)**2 >= 0
+   procedure Lemma_Newton_Step (X, R, Y : Unsigned_64)
+      with Ghost,
+           Pre  => R >= 1
+                   and then Wider (R) + Wider (X / R) < 2 ** 64
+                   and then Y = (R + X / R) / 2,
+           Post => Wider (X) < (Wider (Y) + 1) * (Wider (Y) + 1)
+   is
+      Q : constant Wider := Wider (X / R);
+      T : constant Wider := Wider (Y) + 1;
+   begin
+      pragma Assert (Wider (X) = Q * Wider (R) + Wider (X mod R));
+      pragma Assert (Wider (X) < (Q + 1) * Wider (R));
+      pragma Assert (2 * Wider (Y) + 1 >= Wider (R) + Q);
+      pragma Assert (Q + 1 <= 2 * T - Wider (R));
+      pragma Assert ((Q + 1) * Wider (R) <= (2 * T - Wider (R)) * Wider (R));
+      pragma Assert ((T - Wider (R)) * (T - Wider (R)) >= 0);
+      pragma Assert ((2 * T - Wider (R)) * Wider (R) <= T * T);
+   end Lemma_Newton_Step;
+
+   --  The iteration stops when it no longer decreases: then X / R >= R,
+   --  so R * R <= X
+   procedure Lemma_Newton_Stop (X, R, Y : Unsigned_64)
+      with Ghost,
+           Pre  => R >= 1
+                   and then Wider (R) + Wider (X / R) < 2 ** 64
+                   and then Y = (R + X / R) / 2
+                   and then Y >= R,
+           Post => Wider (R) * Wider (R) <= Wider (X)
+   is
+      Q : constant Wider := Wider (X / R);
+   begin
+      pragma Assert (Q >= Wider (R));
+      pragma Assert (Wider (X) >= Q * Wider (R));
+      pragma Assert (Q * Wider (R) >= Wider (R) * Wider (R));
+   end Lemma_Newton_Stop;
+
+   function Isqrt (X : Unsigned_64) return Unsigned_32 is
+      R : Unsigned_64;
+      Y : Unsigned_64;
+   begin
+      if X = 0 then
+         return 0;
+      end if;
+
+      --  A power of two above the root, within a factor of two of it:
+      --  at most 6 divisions for any X
+      R := Shift_Left (1, Log2 (X) / 2 + 1);
+      pragma Assert (R in 2 .. 2 ** 32);
+
+      --  The first step brings R to the root or above; from there the
+      --  iteration decreases until it stops
+      Y := (R + X / R) / 2;
+      Lemma_Newton_Step (X, R, Y);
+      R := Y;
+      loop
+         pragma Loop_Invariant (R in 1 .. 2 ** 63);
+         pragma Loop_Invariant
+            (Wider (X) < (Wider (R) + 1) * (Wider (R) + 1));
+         pragma Loop_Variant (Decreases => R);
+
+         --  R = 1 only for X < 4, so R + X / R cannot wrap
+         pragma Assert (R >= 2 or X < 4);
+         pragma Assert (if R >= 2 then X / R <= X / 2);
+         Y := (R + X / R) / 2;
+         Lemma_Newton_Step (X, R, Y);
+         exit when Y >= R;
+         R := Y;
+      end loop;
+      Lemma_Newton_Stop (X, R, Y);
+      pragma Assert
+         (if R >= 2 ** 32 then Wider (R) * Wider (R) >= 2 ** 64);
+      pragma Assert (R < 2 ** 32);
+      return Unsigned_32 (R);
+   end Isqrt;
+
+   ---------
+   -- GCD --
+   ---------
+
+   --  Every rule of Stein is symmetric, so the result is
+   procedure Lemma_Stein_Symmetric (A, B : Unsigned_64)
+      with Ghost,
+           Post               => Stein (A, B) = Stein (B, A),
+           Subprogram_Variant => (Decreases => Wider (A) + Wider (B))
+   is
+   begin
+      if A = 0 or B = 0 then
+         null;
+      elsif A mod 2 = 0 and B mod 2 = 0 then
+         Lemma_Stein_Symmetric (A / 2, B / 2);
+      elsif A mod 2 = 0 then
+         Lemma_Stein_Symmetric (A / 2, B);
+      elsif B mod 2 = 0 then
+         Lemma_Stein_Symmetric (A, B / 2);
+      elsif A > B then
+         Lemma_Stein_Symmetric ((A - B) / 2, B);
+      elsif A < B then
+         Lemma_Stein_Symmetric (A, (B - A) / 2);
+      end if;
+   end Lemma_Stein_Symmetric;
+
+   --  K common factors of two come out of the GCD
+   procedure Lemma_Stein_Common (A, B : Unsigned_64; K : Bit_Count)
+      with Ghost,
+           Pre                => A /= 0 and then B /= 0
+                                 and then Has_Trailing_Zeros (A, K)
+                                 and then Has_Trailing_Zeros (B, K),
+           Post               =>
+              Stein (A, B) = Shift_Left (Stein (Shift_Right (A, K),
+                                                Shift_Right (B, K)), K),
+           Subprogram_Variant => (Decreases => K)
+   is
+   begin
+      if K > 0 then
+         pragma Assert (A mod 2 = 0 and B mod 2 = 0);
+         pragma Assert (Has_Trailing_Zeros (A / 2, K - 1)
+                        and Has_Trailing_Zeros (B / 2, K - 1));
+         pragma Assert (Shift_Right (A / 2, K - 1) = Shift_Right (A, K));
+         pragma Assert (Shift_Right (B / 2, K - 1) = Shift_Right (B, K));
+         Lemma_Stein_Common (A / 2, B / 2, K - 1);
+         pragma Assert
+            (2 * Shift_Left (Stein (Shift_Right (A, K), Shift_Right (B, K)),
+                             K - 1)
+             = Shift_Left (Stein (Shift_Right (A, K), Shift_Right (B, K)),
+                           K));
+      end if;
+   end Lemma_Stein_Common;
+
+   --  Against an odd A, factors of two of B do not matter
+   procedure Lemma_Stein_Strip (A, B : Unsigned_64; K : Bit_Count)
+      with Ghost,
+           Pre                => A mod 2 = 1
+                                 and then B /= 0
+                                 and then Has_Trailing_Zeros (B, K),
+           Post               => Stein (A, B) = Stein (A, Shift_Right (B, K)),
+           Subprogram_Variant => (Decreases => K)
+   is
+   begin
+      if K > 0 then
+         pragma Assert (B mod 2 = 0);
+         pragma Assert (Has_Trailing_Zeros (B / 2, K - 1));
+         pragma Assert (Shift_Right (B / 2, K - 1) = Shift_Right (B, K));
+         Lemma_Stein_Strip (A, B / 2, K - 1);
+      end if;
+   end Lemma_Stein_Strip;
+
+   --  Two odd numbers: the GCD of the smaller and the difference
+   procedure Lemma_Stein_Subtract (A, B : Unsigned_64)
+      with Ghost,
+           Pre  => A mod 2 = 1 and B mod 2 = 1,
+           Post => Stein (A, B)
+                   = Stein (Unsigned_64'Min (A, B),
+                            Unsigned_64'Max (A, B) - Unsigned_64'Min (A, B))
+   is
+   begin
+      if A > B then
+         Lemma_Stein_Symmetric ((A - B) / 2, B);
+      end if;
+   end Lemma_Stein_Subtract;
+
+   function Gcd (A, B : Unsigned_64) return Unsigned_64 is
+      Shift : Bit_Count;
+      Zeros : Bit_Count;
+      U, V  : Unsigned_64;
+      Lo    : Unsigned_64;
+   begin
+      if A = 0 then
+         return B;
+      elsif B = 0 then
+         return A;
+      end if;
+
+      --  Common factors of two, then the rest of U's: U is odd from here
+      Shift := Count_Trailing_Zeros (A or B);
+      pragma Assert (Has_Trailing_Zeros (A, Shift)
+                     and Has_Trailing_Zeros (B, Shift));
+      Lemma_Stein_Common (A, B, Shift);
+      U := Shift_Right (A, Shift);
+      V := Shift_Right (B, Shift);
+      pragma Assert (U /= 0 and V /= 0);
+      pragma Assert (U mod 2 = 1 or V mod 2 = 1);
+
+      Zeros := Count_Trailing_Zeros (U);
+      if Zeros > 0 then
+         Lemma_Stein_Symmetric (U, V);
+         Lemma_Stein_Strip (V, U, Zeros);
+         Lemma_Stein_Symmetric (Shift_Right (U, Zeros), V);
+      end if;
+      U := Shift_Right (U, Zeros);
+
+      loop
+         pragma Loop_Invariant (U mod 2 = 1 and V /= 0);
+         pragma Loop_Invariant
+            (Stein (A, B) = Shift_Left (Stein (U, V), Shift));
+         pragma Loop_Variant (Decreases => Wider (U) + Wider (V));
+
+         Zeros := Count_Trailing_Zeros (V);
+         Lemma_Stein_Strip (U, V, Zeros);
+         V := Shift_Right (V, Zeros);
+
+         --  'Min and 'Max are conditional moves: no swap branch
+         Lemma_Stein_Subtract (U, V);
+         Lo := Unsigned_64'Min (U, V);
+         V := Unsigned_64'Max (U, V) - Lo;
+         U := Lo;
+         exit when V = 0;
+      end loop;
+      return Shift_Left (U, Shift);
+   end Gcd;
+
+   ----------------------------
+   -- Modular exponentiation --
+   ----------------------------
+
+   --  (X mod M) * Y and X * Y leave the same remainder
+   procedure Lemma_Mod_Mul (X, Y, M : Wider)
+      with Ghost,
+           Pre  => M >= 1,
+           Post => (X mod M) * Y mod M = X * Y mod M
+   is
+   begin
+      pragma Assert (X = (X / M) * M + X mod M);
+      pragma Assert (X * Y = (X / M) * Y * M + (X mod M) * Y);
+   end Lemma_Mod_Mul;
+
+   --  Multiplication modulo M is associative
+   procedure Lemma_Mul_Mod_Assoc (A, B, C : Unsigned_64; M : Modulus)
+      with Ghost,
+           Pre  => A < M and B < M and C < M,
+           Post => Mul_Mod (Mul_Mod (A, B, M), C, M)
+                   = Mul_Mod (A, Mul_Mod (B, C, M), M)
+   is
+      WA : constant Wider := Wider (A);
+      WB : constant Wider := Wider (B);
+      WC : constant Wider := Wider (C);
+      WM : constant Wider := Wider (M);
+   begin
+      Lemma_Mod_Mul (WA * WB, WC, WM);
+      Lemma_Mod_Mul (WB * WC, WA, WM);
+      pragma Assert (WA * WB * WC = WB * WC * WA);
+   end Lemma_Mul_Mod_Assoc;
+
+   --  Squaring the base halves an even exponent
+   procedure Lemma_Pow_Even (X, K : Unsigned_64; M : Modulus)
+      with Ghost,
+           Pre                => X < M and K <= Unsigned_64'Last / 2,
+           Post               => Pow_Mod (X, 2 * K, M)
+                                 = Pow_Mod (Mul_Mod (X, X, M), K, M),
+           Subprogram_Variant => (Decreases => K)
+   is
+      S : constant Unsigned_64 := Mul_Mod (X, X, M);
+   begin
+      if K > 0 then
+         Lemma_Pow_Even (X, K - 1, M);
+         pragma Assert (X mod M = X and S mod M = S);
+         pragma Assert (Pow_Mod (X, 2 * K, M)
+                        = Mul_Mod (Mul_Mod (Pow_Mod (X, 2 * K - 2, M),
+                                            X, M), X, M));
+         Lemma_Mul_Mod_Assoc (Pow_Mod (X, 2 * K - 2, M), X, X, M);
+         pragma Assert (Pow_Mod (X, 2 * K, M)
+                        = Mul_Mod (Pow_Mod (S, K - 1, M), S, M));
+      end if;
+   end Lemma_Pow_Even;
+
+   --  Pow_Mod reduces its base at every step, so reducing it first
+   --  changes nothing
+   procedure Lemma_Pow_Reduce (Base, E : Unsigned_64; M : Modulus)
+      with Ghost,
+           Post               => Pow_Mod (Base, E, M)
+                                 = Pow_Mod (Base mod M, E, M),
+           Subprogram_Variant => (Decreases => E)
+   is
+   begin
+      if E > 0 then
+         Lemma_Pow_Reduce (Base, E - 1, M);
+         pragma Assert ((Base mod M) mod M = Base mod M);
+      end if;
+   end Lemma_Pow_Reduce;
+
+   function Mod_Pow (Base, E : Unsigned_64; M : Modulus) return Unsigned_64 is
+      Result : Unsigned_64 := 1 mod M;
+      X      : Unsigned_64 := Base mod M;
+      K      : Unsigned_64 := E;
+   begin
+      --  Base**E = Result * X**K throughout, modulo M
+      Lemma_Pow_Reduce (Base, E, M);
+      pragma Assert (Mul_Mod (Result, Pow_Mod (X, K, M), M)
+                     = Pow_Mod (X, K, M));
+      while K /= 0 loop
+         pragma Loop_Invariant (Result < M and X < M);
+         pragma Loop_Invariant
+            (Pow_Mod (Base, E, M) = Mul_Mod (Result, Pow_Mod (X, K, M), M));
+         pragma Loop_Variant (Decreases => K);
+
+         Lemma_Pow_Even (X, K / 2, M);
+         if K mod 2 = 1 then
+            --  X**K = X**(K - 1) * X, and K - 1 = 2 * (K / 2): Result
+            --  takes the factor X
+            Lemma_Mul_Mod_Assoc
+               (Result, Pow_Mod (Mul_Mod (X, X, M), K / 2, M), X, M);
+            Lemma_Mul_Mod_Assoc
+               (Result, X, Pow_Mod (Mul_Mod (X, X, M), K / 2, M), M);
+            Result := Mul_Mod (Result, X, M);
+         end if;
+         X := Mul_Mod (X, X, M);
+         K := K / 2;
+      end loop;
+      return Result;
+   end Mod_Pow;
+
+end Int_Math;
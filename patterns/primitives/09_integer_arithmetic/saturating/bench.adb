@@ -0,0 +1,274 @@
+--  Benchmark: saturating add and multiply over arrays, against the
+--  guarded form a precondition forces on callers, and plain wrapping
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Ada.Unchecked_Conversion;
+with Interfaces;    use Interfaces;
+with Saturating;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 50;
+
+   type Array_32 is array (1 .. N) of Integer;
+   type Array_64 is array (1 .. N) of Long_Long_Integer;
+   type Array_32_Access is access Array_32;
+   type Array_64_Access is access Array_64;
+
+   function To_Integer is new Ada.Unchecked_Conversion (Unsigned_32, Integer);
+   function To_Long is
+      new Ada.Unchecked_Conversion (Unsigned_64, Long_Long_Integer);
+
+   --  What callers of a precondition-guarded Add must establish first
+   function Checked_Add (A, B : Integer) return Integer is (A + B)
+      with Pre => (if B > 0 then A <= Integer'Last - B
+                   else A >= Integer'First - B);
+
+   function Checked_Add (A, B : Long_Long_Integer) return Long_Long_Integer
+   is (A + B)
+      with Pre => (if B > 0 then A <= Long_Long_Integer'Last - B
+                   else A >= Long_Long_Integer'First - B);
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   function Next_Random_64 return Unsigned_64 is
+      High : constant Unsigned_64 := Unsigned_64 (Next_Random);
+   begin
+      return Shift_Left (High, 32) or Unsigned_64 (Next_Random);
+   end Next_Random_64;
+
+   --  Random sign and a random number of significant bits
+   function Random_Operand_32 return Integer is
+      Bits : constant Unsigned_32 := Shift_Right (Next_Random, 1);
+      X    : constant Integer :=
+         Integer (Shift_Right (Bits, Natural (Next_Random mod 31)));
+   begin
+      return (if (Next_Random and 1) = 1 then -X else X);
+   end Random_Operand_32;
+
+   function Random_Operand_64 return Long_Long_Integer is
+      Bits : constant Unsigned_64 := Shift_Right (Next_Random_64, 1);
+      X    : constant Long_Long_Integer :=
+         Long_Long_Integer (Shift_Right (Bits, Natural (Next_Random mod 63)));
+   begin
+      return (if (Next_Random and 1) = 1 then -X else X);
+   end Random_Operand_64;
+
+   ------------
+   -- 32-bit --
+   ------------
+
+   procedure Add_32_Wrap (A, B : Array_32; R : out Array_32) is
+   begin
+      for I in R'Range loop
+         R (I) :=
+            To_Integer (Unsigned_32'Mod (A (I)) + Unsigned_32'Mod (B (I)));
+      end loop;
+   end Add_32_Wrap;
+   pragma Machine_Attribute (Add_32_Wrap, "noipa");
+
+   procedure Add_32_Guarded (A, B : Array_32; R : out Array_32) is
+   begin
+      for I in R'Range loop
+         if B (I) > 0 and then A (I) > Integer'Last - B (I) then
+            R (I) := Integer'Last;
+         elsif B (I) < 0 and then A (I) < Integer'First - B (I) then
+            R (I) := Integer'First;
+         else
+            R (I) := Checked_Add (A (I), B (I));
+         end if;
+      end loop;
+   end Add_32_Guarded;
+   pragma Machine_Attribute (Add_32_Guarded, "noipa");
+
+   procedure Add_32_Saturating (A, B : Array_32; R : out Array_32) is
+   begin
+      for I in R'Range loop
+         R (I) := Saturating.Add (A (I), B (I));
+      end loop;
+   end Add_32_Saturating;
+   pragma Machine_Attribute (Add_32_Saturating, "noipa");
+
+   procedure Mul_32_Wrap (A, B : Array_32; R : out Array_32) is
+   begin
+      for I in R'Range loop
+         R (I) :=
+            To_Integer (Unsigned_32'Mod (A (I)) * Unsigned_32'Mod (B (I)));
+      end loop;
+   end Mul_32_Wrap;
+   pragma Machine_Attribute (Mul_32_Wrap, "noipa");
+
+   procedure Mul_32_Guarded (A, B : Array_32; R : out Array_32) is
+      P : Long_Long_Integer;
+   begin
+      for I in R'Range loop
+         P := Long_Long_Integer (A (I)) * Long_Long_Integer (B (I));
+         if P > Long_Long_Integer (Integer'Last) then
+            R (I) := Integer'Last;
+         elsif P < Long_Long_Integer (Integer'First) then
+            R (I) := Integer'First;
+         else
+            R (I) := Integer (P);
+         end if;
+      end loop;
+   end Mul_32_Guarded;
+   pragma Machine_Attribute (Mul_32_Guarded, "noipa");
+
+   procedure Mul_32_Saturating (A, B : Array_32; R : out Array_32) is
+   begin
+      for I in R'Range loop
+         R (I) := Saturating.Mul (A (I), B (I));
+      end loop;
+   end Mul_32_Saturating;
+   pragma Machine_Attribute (Mul_32_Saturating, "noipa");
+
+   ------------
+   -- 64-bit --
+   ------------
+
+   procedure Add_64_Guarded (A, B : Array_64; R : out Array_64) is
+   begin
+      for I in R'Range loop
+         if B (I) > 0 and then A (I) > Long_Long_Integer'Last - B (I) then
+            R (I) := Long_Long_Integer'Last;
+         elsif B (I) < 0 and then A (I) < Long_Long_Integer'First - B (I)
+         then
+            R (I) := Long_Long_Integer'First;
+         else
+            R (I) := Checked_Add (A (I), B (I));
+         end if;
+      end loop;
+   end Add_64_Guarded;
+   pragma Machine_Attribute (Add_64_Guarded, "noipa");
+
+   procedure Add_64_Saturating (A, B : Array_64; R : out Array_64) is
+   begin
+      for I in R'Range loop
+         R (I) := Saturating.Add (A (I), B (I));
+      end loop;
+   end Add_64_Saturating;
+   pragma Machine_Attribute (Add_64_Saturating, "noipa");
+
+   procedure Mul_64_Guarded (A, B : Array_64; R : out Array_64) is
+      P : Long_Long_Long_Integer;
+   begin
+      for I in R'Range loop
+         P := Long_Long_Long_Integer (A (I)) * Long_Long_Long_Integer (B (I));
+         if P > Long_Long_Long_Integer (Long_Long_Integer'Last) then
+            R (I) := Long_Long_Integer'Last;
+         elsif P < Long_Long_Long_Integer (Long_Long_Integer'First) then
+            R (I) := Long_Long_Integer'First;
+         else
+            R (I) := Long_Long_Integer (P);
+         end if;
+      end loop;
+   end Mul_64_Guarded;
+   pragma Machine_Attribute (Mul_64_Guarded, "noipa");
+
+   procedure Mul_64_Saturating (A, B : Array_64; R : out Array_64) is
+   begin
+      for I in R'Range loop
+         R (I) := Saturating.Mul (A (I), B (I));
+      end loop;
+   end Mul_64_Saturating;
+   pragma Machine_Attribute (Mul_64_Saturating, "noipa");
+
+   X32 : constant Array_32_Access := new Array_32;
+   Y32 : constant Array_32_Access := new Array_32;
+   A32 : constant Array_32_Access := new Array_32;
+   B32 : constant Array_32_Access := new Array_32;
+   R32 : constant Array_32_Access := new Array_32;
+   X64 : constant Array_64_Access := new Array_64;
+   Y64 : constant Array_64_Access := new Array_64;
+   A64 : constant Array_64_Access := new Array_64;
+   B64 : constant Array_64_Access := new Array_64;
+   R64 : constant Array_64_Access := new Array_64;
+
+   Check : Long_Long_Integer := 0;
+
+   type Kernel_32 is access procedure (A, B : Array_32; R : out Array_32);
+   type Kernel_64 is access procedure (A, B : Array_64; R : out Array_64);
+
+   procedure Report (Label : String; Start : Time) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Passes)) &
+                " ns/element");
+   end Report;
+
+   procedure Time_32 (Label : String; K : Kernel_32; A, B : Array_32) is
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         K (A, B, R32.all);
+      end loop;
+      Report (Label, Start);
+      for I in R32'Range loop
+         Check := Check + Long_Long_Integer (R32 (I));
+      end loop;
+   end Time_32;
+
+   procedure Time_64 (Label : String; K : Kernel_64; A, B : Array_64) is
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         K (A, B, R64.all);
+      end loop;
+      Report (Label, Start);
+      for I in R64'Range loop
+         Check :=
+            To_Long (Unsigned_64'Mod (Check) + Unsigned_64'Mod (R64 (I)));
+      end loop;
+   end Time_64;
+
+begin
+   --  Overflow is frequent and unpredictable: full-range operands for
+   --  add, random magnitudes for multiply
+   for I in 1 .. N loop
+      X32 (I) := To_Integer (Next_Random);
+      Y32 (I) := To_Integer (Next_Random);
+      X64 (I) := To_Long (Next_Random_64);
+      Y64 (I) := To_Long (Next_Random_64);
+      A32 (I) := Random_Operand_32;
+      B32 (I) := Random_Operand_32;
+      A64 (I) := Random_Operand_64;
+      B64 (I) := Random_Operand_64;
+   end loop;
+
+   Time_32 ("add, Integer, wrapping          :",
+            Add_32_Wrap'Access, X32.all, Y32.all);
+   Time_32 ("add, Integer, guarded Pre       :",
+            Add_32_Guarded'Access, X32.all, Y32.all);
+   Time_32 ("add, Integer, saturating        :",
+            Add_32_Saturating'Access, X32.all, Y32.all);
+   Time_32 ("mul, Integer, wrapping          :",
+            Mul_32_Wrap'Access, A32.all, B32.all);
+   Time_32 ("mul, Integer, guarded           :",
+            Mul_32_Guarded'Access, A32.all, B32.all);
+   Time_32 ("mul, Integer, saturating        :",
+            Mul_32_Saturating'Access, A32.all, B32.all);
+   Time_64 ("add, Long_Long_Integer, guarded :",
+            Add_64_Guarded'Access, X64.all, Y64.all);
+   Time_64 ("add, Long_Long_Integer, saturate:",
+            Add_64_Saturating'Access, X64.all, Y64.all);
+   Time_64 ("mul, Long_Long_Integer, guarded :",
+            Mul_64_Guarded'Access, A64.all, B64.all);
+   Time_64 ("mul, Long_Long_Integer, saturate:",
+            Mul_64_Saturating'Access, A64.all, B64.all);
+
+   Put_Line ("checksum:" & Long_Long_Integer'Image (Check));
+end Bench;
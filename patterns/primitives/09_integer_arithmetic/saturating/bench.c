@@ -0,0 +1,257 @@
+/*
+ * Benchmark: saturating add and multiply over arrays, against the
+ * guarded form a precondition forces on callers, and plain wrapping
+ * Overflow is frequent and unpredictable: full-range operands for add,
+ * random magnitudes for multiply
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "saturating.h"
+
+#define N      1000000
+#define PASSES 50
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Random sign and a random number of significant bits
+static int32_t random_operand32(void) {
+    int32_t x = (int32_t)(next_random() >> 1 >> (next_random() % 31));
+    return (next_random() & 1) ? -x : x;
+}
+
+static int64_t random_operand64(void) {
+    uint64_t u = ((uint64_t)next_random() << 32) | next_random();
+    int64_t x = (int64_t)(u >> 1 >> (next_random() % 63));
+    return (next_random() & 1) ? -x : x;
+}
+
+/* ---- 32-bit ---- */
+
+// Wrapping: what C code without checks computes (through unsigned, so
+// it is not undefined behaviour)
+__attribute__((noipa)) static void add32_wrap(const int32_t *a, const int32_t *b,
+                                              int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = (int32_t)((uint32_t)a[i] + (uint32_t)b[i]);
+    }
+}
+
+// What a caller of a precondition-guarded Add writes: test, then branch
+__attribute__((noipa)) static void add32_guarded(const int32_t *a, const int32_t *b,
+                                                 int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        if (b[i] > 0 && a[i] > INT32_MAX - b[i]) {
+            r[i] = INT32_MAX;
+        } else if (b[i] < 0 && a[i] < INT32_MIN - b[i]) {
+            r[i] = INT32_MIN;
+        } else {
+            r[i] = a[i] + b[i];
+        }
+    }
+}
+
+__attribute__((noipa)) static void add32_builtin(const int32_t *a, const int32_t *b,
+                                                 int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = sat_add32(a[i], b[i]);
+    }
+}
+
+__attribute__((noipa)) static void add32_wide(const int32_t *a, const int32_t *b,
+                                              int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = sat_add32_wide(a[i], b[i]);
+    }
+}
+
+__attribute__((noipa)) static void mul32_wrap(const int32_t *a, const int32_t *b,
+                                              int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = (int32_t)((uint32_t)a[i] * (uint32_t)b[i]);
+    }
+}
+
+__attribute__((noipa)) static void mul32_guarded(const int32_t *a, const int32_t *b,
+                                                 int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        int64_t p = (int64_t)a[i] * b[i];
+        if (p > INT32_MAX) {
+            r[i] = INT32_MAX;
+        } else if (p < INT32_MIN) {
+            r[i] = INT32_MIN;
+        } else {
+            r[i] = (int32_t)p;
+        }
+    }
+}
+
+__attribute__((noipa)) static void mul32_builtin(const int32_t *a, const int32_t *b,
+                                                 int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = sat_mul32(a[i], b[i]);
+    }
+}
+
+__attribute__((noipa)) static void mul32_wide(const int32_t *a, const int32_t *b,
+                                              int32_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = sat_mul32_wide(a[i], b[i]);
+    }
+}
+
+/* ---- 64-bit ---- */
+
+static inline int64_t clamp64(__int128 x) {
+    x = x < INT64_MIN ? INT64_MIN : x;
+    return (int64_t)(x > INT64_MAX ? INT64_MAX : x);
+}
+
+__attribute__((noipa)) static void add64_guarded(const int64_t *a, const int64_t *b,
+                                                 int64_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        if (b[i] > 0 && a[i] > INT64_MAX - b[i]) {
+            r[i] = INT64_MAX;
+        } else if (b[i] < 0 && a[i] < INT64_MIN - b[i]) {
+            r[i] = INT64_MIN;
+        } else {
+            r[i] = a[i] + b[i];
+        }
+    }
+}
+
+__attribute__((noipa)) static void add64_builtin(const int64_t *a, const int64_t *b,
+                                                 int64_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = sat_add64(a[i], b[i]);
+    }
+}
+
+__attribute__((noipa)) static void add64_wide(const int64_t *a, const int64_t *b,
+                                              int64_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = clamp64((__int128)a[i] + b[i]);
+    }
+}
+
+__attribute__((noipa)) static void mul64_guarded(const int64_t *a, const int64_t *b,
+                                                 int64_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        int64_t p;
+        if (__builtin_mul_overflow(a[i], b[i], &p)) {
+            r[i] = (a[i] ^ b[i]) < 0 ? INT64_MIN : INT64_MAX;
+        } else {
+            r[i] = p;
+        }
+    }
+}
+
+__attribute__((noipa)) static void mul64_builtin(const int64_t *a, const int64_t *b,
+                                                 int64_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = sat_mul64(a[i], b[i]);
+    }
+}
+
+__attribute__((noipa)) static void mul64_wide(const int64_t *a, const int64_t *b,
+                                              int64_t *r, int n) {
+    for (int i = 0; i < n; i++) {
+        r[i] = clamp64((__int128)a[i] * b[i]);
+    }
+}
+
+typedef void (*kernel32)(const int32_t *, const int32_t *, int32_t *, int);
+typedef void (*kernel64)(const int64_t *, const int64_t *, int64_t *, int);
+
+static int64_t checksum;
+
+static void time32(const char *label, kernel32 k, const int32_t *a,
+                   const int32_t *b, int32_t *r) {
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        k(a, b, r, N);
+    }
+    double ns = (now_ns() - start) / ((double)N * PASSES);
+    for (int i = 0; i < N; i++) {
+        checksum += r[i];
+    }
+    printf("%-26s: %.3f ns/element\n", label, ns);
+}
+
+static void time64(const char *label, kernel64 k, const int64_t *a,
+                   const int64_t *b, int64_t *r) {
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        k(a, b, r, N);
+    }
+    double ns = (now_ns() - start) / ((double)N * PASSES);
+    for (int i = 0; i < N; i++) {
+        checksum += r[i];
+    }
+    printf("%-26s: %.3f ns/element\n", label, ns);
+}
+
+int main(void) {
+    int32_t *x32 = malloc(N * sizeof *x32);
+    int32_t *y32 = malloc(N * sizeof *y32);
+    int64_t *x64 = malloc(N * sizeof *x64);
+    int64_t *y64 = malloc(N * sizeof *y64);
+    int32_t *a32 = malloc(N * sizeof *a32);
+    int32_t *b32 = malloc(N * sizeof *b32);
+    int32_t *r32 = malloc(N * sizeof *r32);
+    int64_t *a64 = malloc(N * sizeof *a64);
+    int64_t *b64 = malloc(N * sizeof *b64);
+    int64_t *r64 = malloc(N * sizeof *r64);
+    if (!x32 || !y32 || !x64 || !y64
+        || !a32 || !b32 || !r32 || !a64 || !b64 || !r64) {
+        return 1;
+    }
+    int add_overflows = 0, mul_overflows = 0;
+    for (int i = 0; i < N; i++) {
+        int32_t r;
+        x32[i] = (int32_t)next_random();
+        y32[i] = (int32_t)next_random();
+        x64[i] = (int64_t)(((uint64_t)next_random() << 32) | next_random());
+        y64[i] = (int64_t)(((uint64_t)next_random() << 32) | next_random());
+        a32[i] = random_operand32();
+        b32[i] = random_operand32();
+        a64[i] = random_operand64();
+        b64[i] = random_operand64();
+        add_overflows += __builtin_add_overflow(x32[i], y32[i], &r);
+        mul_overflows += __builtin_mul_overflow(a32[i], b32[i], &r);
+    }
+    printf("32-bit overflow rate: add %.1f%%, mul %.1f%%\n",
+           100.0 * add_overflows / N, 100.0 * mul_overflows / N);
+
+    time32("add32, wrapping", add32_wrap, x32, y32, r32);
+    time32("add32, guarded branches", add32_guarded, x32, y32, r32);
+    time32("add32, overflow builtin", add32_builtin, x32, y32, r32);
+    time32("add32, 64-bit clamp", add32_wide, x32, y32, r32);
+    time32("mul32, wrapping", mul32_wrap, a32, b32, r32);
+    time32("mul32, guarded branches", mul32_guarded, a32, b32, r32);
+    time32("mul32, overflow builtin", mul32_builtin, a32, b32, r32);
+    time32("mul32, 64-bit clamp", mul32_wide, a32, b32, r32);
+    time64("add64, guarded branches", add64_guarded, x64, y64, r64);
+    time64("add64, overflow builtin", add64_builtin, x64, y64, r64);
+    time64("add64, 128-bit clamp", add64_wide, x64, y64, r64);
+    time64("mul64, guarded branches", mul64_guarded, a64, b64, r64);
+    time64("mul64, overflow builtin", mul64_builtin, a64, b64, r64);
+    time64("mul64, 128-bit clamp", mul64_wide, a64, b64, r64);
+
+    printf("checksum: %lld\n", (long long)checksum);
+    return 0;
+}
@@ -0,0 +1,30 @@
+--  Saturating arithmetic: overflow clamps instead of failing a check
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Saturating;  use Saturating;
+
+procedure Example is
+
+   X : constant Integer := Integer'Last;
+
+begin
+   --  Increment (X) has Pre => X < Integer'Last; Add has no precondition
+   Put_Line ("Increment Integer'Last:" & Integer'Image (Add (X, 1)));
+   Put_Line ("Integer'First - 1:     "
+             & Integer'Image (Sub (Integer'First, 1)));
+   Put_Line ("100000 * 100000:       "
+             & Integer'Image (Mul (100_000, 100_000)));
+   Put_Line ("-100000 * 100000:      "
+             & Integer'Image (Mul (-100_000, 100_000)));
+   Put_Line ("-Integer'First:        " & Integer'Image (Neg (Integer'First)));
+   Put_Line ("abs Integer'First:     "
+             & Integer'Image (Absolute (Integer'First)));
+   Put_Line ("In range, 2 + 3:       " & Integer'Image (Add (2, 3)));
+
+   Put_Line ("Long_Long_Integer'Last + 1:"
+             & Long_Long_Integer'Image
+                 (Add (Long_Long_Integer'Last, 1)));
+   Put_Line ("Long_Long_Integer'First * 2:"
+             & Long_Long_Integer'Image
+                 (Mul (Long_Long_Integer'First, 2)));
+end Example;
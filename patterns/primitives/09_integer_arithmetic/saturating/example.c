@@ -0,0 +1,23 @@
+/*
+ * Saturating arithmetic: overflow clamps instead of wrapping
+ */
+
+#include <stdio.h>
+#include "saturating.h"
+
+int main(void) {
+    int32_t x = INT32_MAX;
+
+    // x + 1 is undefined behaviour; the saturating version stays at the top
+    printf("Increment INT32_MAX: %d\n", sat_add32(x, 1));
+    printf("INT32_MIN - 1:       %d\n", sat_sub32(INT32_MIN, 1));
+    printf("100000 * 100000:     %d\n", sat_mul32(100000, 100000));
+    printf("-100000 * 100000:    %d\n", sat_mul32(-100000, 100000));
+    printf("-INT32_MIN:          %d\n", sat_neg32(INT32_MIN));
+    printf("abs(INT32_MIN):      %d\n", sat_abs32(INT32_MIN));
+    printf("In range, 2 + 3:     %d\n", sat_add32(2, 3));
+
+    printf("INT64_MAX + 1:       %lld\n", (long long)sat_add64(INT64_MAX, 1));
+    printf("INT64_MIN * 2:       %lld\n", (long long)sat_mul64(INT64_MIN, 2));
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Saturating arithmetic: results that overflow are clamped to the
+ * nearest representable value instead of wrapping
+ */
+
+#ifndef SATURATING_H
+#define SATURATING_H
+
+#include <stdint.h>
+
+// The saturation value has the sign of a: (a >> 31) is 0 or -1, and
+// xor with the maximum gives the maximum or the minimum, without a branch.
+// GCC turns `overflow ? limit : r` into a branch, which mispredicts on
+// mixed data, so the select is spelled out with a mask: all ones on
+// overflow, zero otherwise
+
+static inline int32_t sat_add32(int32_t a, int32_t b) {
+    int32_t r;
+    int32_t limit = (a >> 31) ^ INT32_MAX;
+    int32_t mask = -(int32_t)__builtin_add_overflow(a, b, &r);
+    return (r & ~mask) | (limit & mask);
+}
+
+static inline int32_t sat_sub32(int32_t a, int32_t b) {
+    int32_t r;
+    int32_t limit = (a >> 31) ^ INT32_MAX;
+    int32_t mask = -(int32_t)__builtin_sub_overflow(a, b, &r);
+    return (r & ~mask) | (limit & mask);
+}
+
+static inline int32_t sat_mul32(int32_t a, int32_t b) {
+    int32_t r;
+    int32_t limit = ((a ^ b) >> 31) ^ INT32_MAX;
+    int32_t mask = -(int32_t)__builtin_mul_overflow(a, b, &r);
+    return (r & ~mask) | (limit & mask);
+}
+
+// -INT32_MIN is the only overflow
+static inline int32_t sat_neg32(int32_t a) {
+    return a == INT32_MIN ? INT32_MAX : -a;
+}
+
+static inline int32_t sat_abs32(int32_t a) {
+    return a == INT32_MIN ? INT32_MAX : (a < 0 ? -a : a);
+}
+
+static inline int64_t sat_add64(int64_t a, int64_t b) {
+    int64_t r;
+    int64_t limit = (a >> 63) ^ INT64_MAX;
+    int64_t mask = -(int64_t)__builtin_add_overflow(a, b, &r);
+    return (r & ~mask) | (limit & mask);
+}
+
+static inline int64_t sat_sub64(int64_t a, int64_t b) {
+    int64_t r;
+    int64_t limit = (a >> 63) ^ INT64_MAX;
+    int64_t mask = -(int64_t)__builtin_sub_overflow(a, b, &r);
+    return (r & ~mask) | (limit & mask);
+}
+
+static inline int64_t sat_mul64(int64_t a, int64_t b) {
+    int64_t r;
+    int64_t limit = ((a ^ b) >> 63) ^ INT64_MAX;
+    int64_t mask = -(int64_t)__builtin_mul_overflow(a, b, &r);
+    return (r & ~mask) | (limit & mask);
+}
+
+static inline int64_t sat_neg64(int64_t a) {
+    return a == INT64_MIN ? INT64_MAX : -a;
+}
+
+static inline int64_t sat_abs64(int64_t a) {
+    return a == INT64_MIN ? INT64_MAX : (a < 0 ? -a : a);
+}
+
+// The same 32-bit operations as the SPARK version computes them: exact
+// in 64 bits, then clamped. Min and max compile to conditional moves
+static inline int32_t clamp32(int64_t x) {
+    x = x < INT32_MIN ? INT32_MIN : x;
+    return (int32_t)(x > INT32_MAX ? INT32_MAX : x);
+}
+
+static inline int32_t sat_add32_wide(int32_t a, int32_t b) {
+    return clamp32((int64_t)a + b);
+}
+
+static inline int32_t sat_mul32_wide(int32_t a, int32_t b) {
+    return clamp32((int64_t)a * b);
+}
+
+#endif
@@ -0,0 +1,169 @@
+--  Benchmark: Float_Format against 'Image, writing the values of bench.c
+--  into one buffer, one per line
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Float_Format;  use Float_Format;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 10;
+
+   LF : constant Character := ASCII.LF;
+
+   type Value_Array is array (1 .. N) of Long_Float;
+
+   type Value_Access is access Value_Array;
+   type Text_Access is access String;
+
+   type Format_Kernel is access function
+     (Text : in out String; Values : Value_Array) return Natural;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   --  Each returns the number of characters written
+
+   function Format_Shortest
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos    : Positive := Text'First;
+      Length : Text_Length;
+   begin
+      for I in Values'Range loop
+         Format (Values (I), Text (Pos .. Text'Last), Length);
+         Text (Pos + Length) := LF;
+         Pos := Pos + Length + 1;
+      end loop;
+      return Pos - Text'First;
+   end Format_Shortest;
+   pragma Machine_Attribute (Format_Shortest, "noipa");
+
+   function Format_Shortest_Float
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos    : Positive := Text'First;
+      Length : Text_Length;
+   begin
+      for I in Values'Range loop
+         Format (Float (Values (I)), Text (Pos .. Text'Last), Length);
+         Text (Pos + Length) := LF;
+         Pos := Pos + Length + 1;
+      end loop;
+      return Pos - Text'First;
+   end Format_Shortest_Float;
+   pragma Machine_Attribute (Format_Shortest_Float, "noipa");
+
+   --  'Image returns a new string on the secondary stack: a blank or a
+   --  sign, then Long_Float'Digits digits in exponent form
+   function Format_Image
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos : Positive := Text'First;
+   begin
+      for I in Values'Range loop
+         declare
+            Image : constant String := Long_Float'Image (Values (I));
+         begin
+            Text (Pos .. Pos + Image'Length - 1) := Image;
+            Text (Pos + Image'Length) := LF;
+            Pos := Pos + Image'Length + 1;
+         end;
+      end loop;
+      return Pos - Text'First;
+   end Format_Image;
+   pragma Machine_Attribute (Format_Image, "noipa");
+
+   function Format_Image_Float
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos : Positive := Text'First;
+   begin
+      for I in Values'Range loop
+         declare
+            Image : constant String := Float'Image (Float (Values (I)));
+         begin
+            Text (Pos .. Pos + Image'Length - 1) := Image;
+            Text (Pos + Image'Length) := LF;
+            Pos := Pos + Image'Length + 1;
+         end;
+      end loop;
+      return Pos - Text'First;
+   end Format_Image_Float;
+   pragma Machine_Attribute (Format_Image_Float, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Full   : constant Value_Access := new Value_Array;
+   Tenths : constant Value_Access := new Value_Array;
+   Text   : constant Text_Access := new String (1 .. N * (Max_Length + 1));
+
+   Check : Unsigned_64 := 0;
+
+   procedure Run (Label : String; K : Format_Kernel; Values : Value_Array)
+   is
+      Bytes : Natural := 0;
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         Bytes := K (Text.all, Values);
+         Check := Check + Unsigned_64 (Bytes)
+                  + Character'Pos (Text (Bytes / 2 + 1));
+      end loop;
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Passes)) &
+                " ns/value" &
+                Long_Float'Image (Long_Float (Bytes) / Long_Float (N)) &
+                " bytes/value");
+   end Run;
+
+   procedure Run_All (Input : String; Values : Value_Array) is
+      Warm_Up : constant Natural := Format_Shortest (Text.all, Values);
+   begin
+      Put_Line (Input & ":" & Natural'Image (Warm_Up) & " bytes");
+      Run ("  Format (Long_Float) :", Format_Shortest'Access, Values);
+      Run ("  Long_Float'Image    :", Format_Image'Access, Values);
+      Run ("  Format (Float)      :", Format_Shortest_Float'Access, Values);
+      Run ("  Float'Image         :", Format_Image_Float'Access, Values);
+   end Run_All;
+
+begin
+   --  -1000 .. 1000: 53 random bits, or a whole number of tenths, as in
+   --  bench.c
+   for I in 1 .. N loop
+      declare
+         High : constant Unsigned_64 := Unsigned_64 (Next_Random);
+         Word : constant Unsigned_64 :=
+           Shift_Left (High, 21) or Shift_Right (Unsigned_64 (Next_Random),
+                                                 11);
+      begin
+         Full (I) := Long_Float (Word) / 2.0 ** 53 * 2000.0 - 1000.0;
+         Tenths (I) :=
+           Long_Float (Integer (Next_Random mod 20_001) - 10_000) / 10.0;
+      end;
+   end loop;
+
+   Run_All ("17 digits", Full.all);
+   Run_All ("tenths", Tenths.all);
+
+   Put_Line ("check:" & Unsigned_64'Image (Check));
+end Bench;
@@ -0,0 +1,142 @@
+/*
+ * Benchmark: float_format.h against printf, writing 1M values into one
+ * output buffer, one per line
+ * Two inputs: random values with all 17 digits significant, and values
+ * with one decimal, like a sensor reading, where the shortest text is
+ * short
+ * - ff_double and ff_float: shortest round-trip text
+ * - snprintf "%.17g" and "%.9g": the precision that always round-trips
+ * - snprintf "%.11f": the fixed precision of variables_types
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "float_format.h"
+
+#define N      1000000
+#define PASSES 10
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* ---- kernels: each writes every value, one per line ---- */
+
+__attribute__((noipa)) static size_t format_shortest(char *out,
+                                                     const double *values,
+                                                     size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += ff_double(p, values[i]);
+        *p++ = '\n';
+    }
+    return (size_t)(p - out);
+}
+
+__attribute__((noipa)) static size_t format_shortest_float(
+    char *out, const double *values, size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += ff_float(p, (float)values[i]);
+        *p++ = '\n';
+    }
+    return (size_t)(p - out);
+}
+
+__attribute__((noipa)) static size_t format_g17(char *out,
+                                                const double *values,
+                                                size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += snprintf(p, FF_MAX_LENGTH + 2, "%.17g\n", values[i]);
+    }
+    return (size_t)(p - out);
+}
+
+__attribute__((noipa)) static size_t format_g9(char *out,
+                                               const double *values,
+                                               size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += snprintf(p, FF_MAX_LENGTH + 2, "%.9g\n", (float)values[i]);
+    }
+    return (size_t)(p - out);
+}
+
+// Fixed point: at most 17 characters for |x| <= 1000
+__attribute__((noipa)) static size_t format_f11(char *out,
+                                                const double *values,
+                                                size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += snprintf(p, 2 * FF_MAX_LENGTH, "%.11f\n", values[i]);
+    }
+    return (size_t)(p - out);
+}
+
+/* ---- driver ---- */
+
+static size_t check;
+
+static void run(const char *label, size_t (*kernel)(char *, const double *,
+                                                    size_t),
+                char *out, const double *values) {
+    double start = now_ns();
+    size_t bytes = 0;
+    for (int p = 0; p < PASSES; p++) {
+        bytes = kernel(out, values, N);
+        check += bytes + (unsigned char)out[bytes / 2];
+    }
+    double elapsed = now_ns() - start;
+    printf("%-22s: %6.1f ns/value  %4.1f bytes/value\n", label,
+           elapsed / ((double)N * PASSES), (double)bytes / N);
+}
+
+static void run_all(const char *input, char *out, const double *values) {
+    // Warm-up: pages in the output buffer
+    printf("%s: %zu bytes\n", input, format_shortest(out, values, N));
+    run("  ff_double", format_shortest, out, values);
+    run("  snprintf \"%.17g\"", format_g17, out, values);
+    run("  snprintf \"%.11f\"", format_f11, out, values);
+    run("  ff_float", format_shortest_float, out, values);
+    run("  snprintf \"%.9g\"", format_g9, out, values);
+}
+
+int main(void) {
+    double *full = malloc(N * sizeof *full);
+    double *tenths = malloc(N * sizeof *tenths);
+    char *out = malloc(N * 2 * FF_MAX_LENGTH);
+    if (!full || !tenths || !out) {
+        return 1;
+    }
+
+    // -1000 .. 1000: 53 random bits, or a whole number of tenths
+    for (size_t i = 0; i < N; i++) {
+        uint64_t high = next_random();
+        uint64_t word = high << 21 | next_random() >> 11;
+        full[i] = (double)word / (double)(1ULL << 53) * 2000.0 - 1000.0;
+        tenths[i] = (double)((int32_t)(next_random() % 20001) - 10000)
+                    / 10.0;
+    }
+
+    run_all("17 digits", out, full);
+    run_all("tenths", out, tenths);
+
+    printf("check: %zu\n", check);
+    free(full);
+    free(tenths);
+    free(out);
+    return 0;
+}
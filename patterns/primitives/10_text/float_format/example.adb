@@ -0,0 +1,35 @@
+--  Float formatting: the values of variables_types, shortest text against
+--  'Image
+
+with Ada.Text_IO;  use Ada.Text_IO;
+with Float_Format; use Float_Format;
+
+procedure Example is
+
+   Temperature   : constant Float := 98.6;
+   Precise_Value : constant Long_Float := 3.14159265359;
+
+   --  Variables, so that 0.1 + 0.2 is a Long_Float addition. As a static
+   --  expression it would be computed exactly, giving 0.3
+   Tenth      : Long_Float := 0.1;
+   Two_Tenths : Long_Float := 0.2;
+
+   Text   : String (1 .. Max_Length) := (others => ' ');
+   Length : Text_Length;
+
+begin
+   Format (Temperature, Text, Length);
+   Put_Line ("Float:      " & Text (1 .. Length)
+             & "  'Image:" & Float'Image (Temperature));
+
+   Format (Precise_Value, Text, Length);
+   Put_Line ("Long_Float: " & Text (1 .. Length)
+             & "  'Image:" & Long_Float'Image (Precise_Value));
+
+   Format (Tenth + Two_Tenths, Text, Length);
+   Put_Line ("0.1 + 0.2:  " & Text (1 .. Length));
+
+   --  'Image gives Float'Digits significant digits, always in exponent
+   --  form: " 9.86000E+01" and " 3.14159265359000E+00". Format gives the
+   --  fewest that read back as the same value
+end Example;
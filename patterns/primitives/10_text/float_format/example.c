@@ -0,0 +1,28 @@
+/*
+ * Float formatting: the values of variables_types, shortest text against
+ * printf's fixed precisions
+ */
+
+#include <stdio.h>
+#include "float_format.h"
+
+static void show(const char *label, double x, bool single) {
+    char text[FF_MAX_LENGTH];
+    size_t n = single ? ff_float(text, (float)x) : ff_double(text, x);
+    printf("%-14s %-22.*s %.11f\n", label, (int)n, text, x);
+}
+
+int main(void) {
+    printf("%-14s %-22s %s\n", "", "shortest", "%.11f");
+    show("temperature", 98.6f, true);
+    show("precise_value", 3.14159265359, false);
+    show("0.1 + 0.2", 0.1 + 0.2, false);
+    show("1e-7", 1e-7, false);
+    show("avogadro", 6.02214076e23, false);
+
+    // 98.6f is exactly 98.59999847412109375. "%.11f" prints eleven of its
+    // decimals, which look like an error; "98.6" is the shortest text
+    // that reads back as the same float. "%.11f" also prints 0.1 + 0.2
+    // as 0.3, which it is not, and keeps five significant digits of 1e-7
+    return 0;
+}
@@ -0,0 +1,345 @@
+with Ada.Unchecked_Conversion;
+with Interfaces;           use Interfaces;
+with Float_Format.Tables;  use Float_Format.Tables;
+with Int_Format;
+
+package body Float_Format is
+
+   function Shift_Right
+     (Value : Unsigned_128; Amount : Natural) return Unsigned_128
+      with Import, Convention => Intrinsic;
+
+   function To_Bits is new Ada.Unchecked_Conversion (Long_Float, Unsigned_64);
+   function To_Bits is new Ada.Unchecked_Conversion (Float, Unsigned_32);
+
+   --  A finite nonzero value is M2 * 2 ** E2, with 2 more bits below the
+   --  mantissa so that the rounding interval's bounds, half a unit in
+   --  the last place away, are whole numbers too
+   subtype Binary_Exponent is Integer range -1_076 .. 969;
+
+   --  The value is Significand * 10 ** Exponent
+   type Decimal is record
+      Significand : Unsigned_64;
+      Exponent    : Integer;
+   end record;
+
+   -----------------
+   -- Logarithms --
+   -----------------
+
+   --  Each is exact over its precondition's range, where the
+   --  multiply-shift approximation has been checked against big numbers
+
+   --  floor (log10 (2 ** E))
+   function Log10_Pow2 (E : Natural) return Natural is
+     (E * 78_913 / 2 ** 18)
+   with Pre => E <= 969;
+
+   --  floor (log10 (5 ** E))
+   function Log10_Pow5 (E : Natural) return Natural is
+     (E * 732_923 / 2 ** 20)
+   with Pre => E <= 1_076;
+
+   --  The bit length of 5 ** E, for E > 0; 1 for E = 0
+   function Pow5_Bits (E : Natural) return Positive is
+     (E * 1_217_359 / 2 ** 19 + 1)
+   with Pre => E <= 1_076;
+
+   --  (M * Mul) / 2 ** J. The product has up to 190 bits; its low 64 are
+   --  dropped first, which J >= 64 allows, and the rest fits 128
+   function Mul_Shift
+     (M : Unsigned_64; Mul : Unsigned_128; J : Natural) return Unsigned_64
+   is
+     (Unsigned_64'Mod
+        (Shift_Right
+           (Shift_Right (Unsigned_128 (M) * (Mul mod 2 ** 64), 64)
+            + Unsigned_128 (M) * Shift_Right (Mul, 64),
+            J - 64)))
+   with Pre => J >= 64;
+
+   --  X is a multiple of 5 ** P. X > 0, so the loop ends by P
+   function Multiple_Of_Pow5 (X : Unsigned_64; P : Natural) return Boolean
+      with Pre => X > 0
+   is
+      V : Unsigned_64 := X;
+   begin
+      for K in 1 .. P loop
+         if V mod 5 /= 0 then
+            return False;
+         end if;
+         V := V / 5;
+      end loop;
+      return True;
+   end Multiple_Of_Pow5;
+
+   --------------
+   -- Shortest --
+   --------------
+
+   --  The shortest decimal in the rounding interval of M2 * 2 ** E2, and
+   --  the closest to it among those. MM_Shift is False only at a power
+   --  of two, where the interval below is half as wide
+   function Shortest
+     (M2 : Unsigned_64; E2 : Binary_Exponent; MM_Shift : Boolean)
+      return Decimal
+      with Pre  => M2 in 1 .. 2 ** 53 - 1,
+           Post => Shortest'Result.Exponent in -326 .. 331
+   is
+      Accept_Bounds : constant Boolean := M2 mod 2 = 0;
+      Mv : constant Unsigned_64 := 4 * M2;
+      Mm : constant Unsigned_64 := Mv - 1 - Boolean'Pos (MM_Shift);
+
+      --  The value and the interval bounds, times 10 ** -E10
+      Vr, Vp, Vm : Unsigned_64;
+      E10        : Integer range -326 .. 291;
+
+      Vm_Trailing_Zeros : Boolean := False;
+      Vr_Trailing_Zeros : Boolean := False;
+      Removed           : Natural range 0 .. 40 := 0;
+      Last_Removed      : Unsigned_64 range 0 .. 9 := 0;
+      Round_Up          : Boolean := False;
+   begin
+      if E2 >= 0 then
+         declare
+            Q : constant Natural := Log10_Pow2 (E2) - Boolean'Pos (E2 > 3);
+            I : constant Natural := Q + 124 + Pow5_Bits (Q) - E2;
+         begin
+            pragma Assert (Q <= 291 and I >= 64);
+            E10 := Q;
+            Vr := Mul_Shift (Mv, Pow5_Inv (Q), I);
+            Vp := Mul_Shift (Mv + 2, Pow5_Inv (Q), I);
+            Vm := Mul_Shift (Mm, Pow5_Inv (Q), I);
+            --  Only here can a bound be exactly a multiple of 10 ** Q
+            if Q <= 21 then
+               if Mv mod 5 = 0 then
+                  Vr_Trailing_Zeros := Multiple_Of_Pow5 (Mv, Q);
+               elsif Accept_Bounds then
+                  Vm_Trailing_Zeros := Multiple_Of_Pow5 (Mm, Q);
+               elsif Multiple_Of_Pow5 (Mv + 2, Q) then
+                  Vp := Vp - 1;
+               end if;
+            end if;
+         end;
+      else
+         declare
+            Q : constant Natural :=
+              Log10_Pow5 (-E2) - Boolean'Pos (-E2 > 1);
+            I : constant Natural := -E2 - Q;
+            J : constant Natural := Q + 125 - Pow5_Bits (I);
+         begin
+            pragma Assert (I <= 325 and J >= 64);
+            E10 := Q + E2;
+            Vr := Mul_Shift (Mv, Pow5 (I), J);
+            Vp := Mul_Shift (Mv + 2, Pow5 (I), J);
+            Vm := Mul_Shift (Mm, Pow5 (I), J);
+            if Q <= 1 then
+               Vr_Trailing_Zeros := True;
+               if Accept_Bounds then
+                  Vm_Trailing_Zeros := MM_Shift;
+               else
+                  Vp := Vp - 1;
+               end if;
+            elsif Q < 63 then
+               Vr_Trailing_Zeros := (Mv and (Shift_Left (1, Q) - 1)) = 0;
+            end if;
+         end;
+      end if;
+
+      --  Drop digits while the interval still holds a shorter number.
+      --  2 ** 64 < 10 ** 20, so each loop stops within 20 steps; the
+      --  bound is there for the proof
+      if Vm_Trailing_Zeros or Vr_Trailing_Zeros then
+         --  Rare: a bound or the value is exact, so ties need care
+         for K in 1 .. 20 loop
+            pragma Loop_Invariant (Removed = K - 1);
+            exit when Vp / 10 <= Vm / 10;
+            Vm_Trailing_Zeros := Vm_Trailing_Zeros and Vm mod 10 = 0;
+            Vr_Trailing_Zeros := Vr_Trailing_Zeros and Last_Removed = 0;
+            Last_Removed := Vr mod 10;
+            Vr := Vr / 10;
+            Vp := Vp / 10;
+            Vm := Vm / 10;
+            Removed := Removed + 1;
+         end loop;
+         if Vm_Trailing_Zeros then
+            for K in 1 .. 20 loop
+               pragma Loop_Invariant (Removed <= 19 + K);
+               exit when Vm mod 10 /= 0;
+               Vr_Trailing_Zeros := Vr_Trailing_Zeros and Last_Removed = 0;
+               Last_Removed := Vr mod 10;
+               Vr := Vr / 10;
+               Vp := Vp / 10;
+               Vm := Vm / 10;
+               Removed := Removed + 1;
+            end loop;
+         end if;
+         if Vr_Trailing_Zeros and Last_Removed = 5 and Vr mod 2 = 0 then
+            Last_Removed := 4;   --  exactly halfway: round to even
+         end if;
+         Round_Up := (Vr = Vm
+                      and (not Accept_Bounds or not Vm_Trailing_Zeros))
+                     or Last_Removed >= 5;
+      else
+         for K in 1 .. 20 loop
+            pragma Loop_Invariant (Removed = K - 1);
+            exit when Vp / 10 <= Vm / 10;
+            Round_Up := Vr mod 10 >= 5;
+            Vr := Vr / 10;
+            Vp := Vp / 10;
+            Vm := Vm / 10;
+            Removed := Removed + 1;
+         end loop;
+         Round_Up := Vr = Vm or Round_Up;
+      end if;
+
+      return (Significand => Vr + Boolean'Pos (Round_Up),
+              Exponent    => E10 + Removed);
+   end Shortest;
+
+   -----------
+   -- Write --
+   -----------
+
+   --  The sign and D at Buffer'First, as described in the spec. '-' is
+   --  always stored, as in Int_Format, and overwritten when X >= 0
+   procedure Write
+     (Negative : Boolean;
+      D        : Decimal;
+      Buffer   : in out String;
+      Length   : out Text_Length)
+      with Pre  => Buffer'Length >= Max_Length
+                   and D.Exponent in -326 .. 331,
+           Post => Buffer (Buffer'First + Length .. Buffer'Last)
+                   = Buffer'Old (Buffer'First + Length .. Buffer'Last)
+   is
+      Sign  : constant Natural := Boolean'Pos (Negative);
+      N     : constant Int_Format.Text_Length :=
+        Int_Format.Digit_Count (D.Significand);
+      X     : constant Integer := D.Exponent + N - 1;   --  of the first
+      P     : constant Positive := Buffer'First + Sign;
+      Last  : Positive;
+      Count : Int_Format.Text_Length;
+   begin
+      Buffer (Buffer'First) := '-';
+      if X in -4 .. -1 then
+         --  "0.", then -X - 1 zeros, then the digits
+         Buffer (P .. P + 1) := "0.";
+         Buffer (P + 2 .. P - X) := (others => '0');
+         Int_Format.Format
+           (D.Significand, Buffer (P - X + 1 .. Buffer'Last), Count);
+         Length := Sign + 1 - X + Count;
+
+      elsif X in 0 .. 15 and then N > X + 1 then
+         --  The digits one place right, then the first X + 1 moved back
+         --  in front of the point
+         Int_Format.Format
+           (D.Significand, Buffer (P + 1 .. Buffer'Last), Count);
+         Buffer (P .. P + X) := Buffer (P + 1 .. P + X + 1);
+         Buffer (P + X + 1) := '.';
+         Length := Sign + N + 1;
+
+      elsif X in 0 .. 15 then
+         --  The digits, zeros up to the point, and ".0"
+         Int_Format.Format (D.Significand, Buffer (P .. Buffer'Last), Count);
+         Buffer (P + N .. P + X) := (others => '0');
+         Buffer (P + X + 1 .. P + X + 2) := ".0";
+         Length := Sign + X + 3;
+
+      else
+         Int_Format.Format
+           (D.Significand, Buffer (P + 1 .. Buffer'Last), Count);
+         Buffer (P) := Buffer (P + 1);
+         Buffer (P + 1) := '.';
+         Last := P + N;
+         if N = 1 then
+            Buffer (P + 2) := '0';
+            Last := P + 2;
+         end if;
+         Buffer (Last + 1) := 'E';
+         Int_Format.Format
+           (Long_Long_Integer (X), Buffer (Last + 2 .. Buffer'Last), Count);
+         Length := Last + 1 + Count - Buffer'First + 1;
+      end if;
+   end Write;
+
+   --  "inf", "-inf" or "nan"
+   procedure Write_Special
+     (Negative : Boolean;
+      Is_NaN   : Boolean;
+      Buffer   : in out String;
+      Length   : out Text_Length)
+      with Pre  => Buffer'Length >= Max_Length,
+           Post => Buffer (Buffer'First + Length .. Buffer'Last)
+                   = Buffer'Old (Buffer'First + Length .. Buffer'Last)
+   is
+   begin
+      if Is_NaN then
+         Buffer (Buffer'First .. Buffer'First + 2) := "nan";
+         Length := 3;
+      elsif Negative then
+         Buffer (Buffer'First .. Buffer'First + 3) := "-inf";
+         Length := 4;
+      else
+         Buffer (Buffer'First .. Buffer'First + 2) := "inf";
+         Length := 3;
+      end if;
+   end Write_Special;
+
+   ------------
+   -- Format --
+   ------------
+
+   procedure Format
+     (X      : Long_Float;
+      Buffer : in out String;
+      Length : out Text_Length)
+   is
+      Bits     : constant Unsigned_64 := To_Bits (X);
+      Negative : constant Boolean := Shift_Right (Bits, 63) = 1;
+      Mantissa : constant Unsigned_64 := Bits and (2 ** 52 - 1);
+      Exponent : constant Natural :=
+        Natural (Shift_Right (Bits, 52) and 16#7FF#);
+   begin
+      if Exponent = 16#7FF# then
+         Write_Special (Negative, Mantissa /= 0, Buffer, Length);
+      elsif Exponent = 0 and Mantissa = 0 then
+         Write (Negative, (0, 0), Buffer, Length);
+      else
+         Write (Negative,
+                Shortest
+                  (M2       => (if Exponent = 0 then Mantissa
+                                else Mantissa or 2 ** 52),
+                   E2       => Integer'Max (Exponent, 1) - 1_023 - 52 - 2,
+                   MM_Shift => Mantissa /= 0 or Exponent <= 1),
+                Buffer, Length);
+      end if;
+   end Format;
+
+   procedure Format
+     (X      : Float;
+      Buffer : in out String;
+      Length : out Text_Length)
+   is
+      Bits     : constant Unsigned_32 := To_Bits (X);
+      Negative : constant Boolean := Shift_Right (Bits, 31) = 1;
+      Mantissa : constant Unsigned_64 :=
+        Unsigned_64 (Bits and (2 ** 23 - 1));
+      Exponent : constant Natural :=
+        Natural (Shift_Right (Bits, 23) and 16#FF#);
+   begin
+      if Exponent = 16#FF# then
+         Write_Special (Negative, Mantissa /= 0, Buffer, Length);
+      elsif Exponent = 0 and Mantissa = 0 then
+         Write (Negative, (0, 0), Buffer, Length);
+      else
+         Write (Negative,
+                Shortest
+                  (M2       => (if Exponent = 0 then Mantissa
+                                else Mantissa or 2 ** 23),
+                   E2       => Integer'Max (Exponent, 1) - 127 - 23 - 2,
+                   MM_Shift => Mantissa /= 0 or Exponent <= 1),
+                Buffer, Length);
+      end if;
+   end Format;
+
+end Float_Format;
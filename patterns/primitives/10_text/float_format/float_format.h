@@ -0,0 +1,249 @@
+/*
+ * Shortest round-trip formatting of float and double (Ryu): the fewest
+ * decimal digits that read back as the same value, with no printf and
+ * no allocation
+ * One core serves both widths: a float is widened to the same mantissa
+ * and binary exponent form, and the 125-bit tables cover both
+ */
+
+#ifndef FLOAT_FORMAT_H
+#define FLOAT_FORMAT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "float_format_tables.h"
+#include "../int_format/int_format.h"
+
+// "-1.2345678901234567E-308"
+#define FF_MAX_LENGTH 24
+
+// The value is digits * 10 ** exponent
+typedef struct {
+    uint64_t digits;
+    int32_t exponent;
+} ff_decimal;
+
+// floor (log10 (2 ** e)), for 0 <= e <= 1650
+static inline int32_t ff_log10_pow2(int32_t e) {
+    return (int32_t)(((uint32_t)e * 78913) >> 18);
+}
+
+// floor (log10 (5 ** e)), for 0 <= e <= 2620
+static inline int32_t ff_log10_pow5(int32_t e) {
+    return (int32_t)(((uint32_t)e * 732923) >> 20);
+}
+
+// The bit length of 5 ** e, for 0 < e <= 3528 (1 for e = 0)
+static inline int32_t ff_pow5_bits(int32_t e) {
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+// (m * mul) >> j for a 125-bit mul and j >= 64: the low 64 bits of the
+// 189-bit product never reach the result
+static inline uint64_t ff_mul_shift(uint64_t m, const uint64_t mul[2],
+                                    int32_t j) {
+    unsigned __int128 b0 = (unsigned __int128)m * mul[0];
+    unsigned __int128 b2 = (unsigned __int128)m * mul[1];
+    return (uint64_t)(((b0 >> 64) + b2) >> (j - 64));
+}
+
+// x is a multiple of 5 ** p; x > 0
+static inline bool ff_multiple_of_pow5(uint64_t x, int32_t p) {
+    for (int32_t k = 0; k < p; k++) {
+        if (x % 5 != 0) {
+            return false;
+        }
+        x /= 5;
+    }
+    return true;
+}
+
+// The shortest decimal in the rounding interval of m2 * 2 ** e2, and the
+// closest to it among those. mm_shift is false only at a power of two,
+// where the interval below is half as wide
+static inline ff_decimal ff_shortest(uint64_t m2, int32_t e2,
+                                     bool mm_shift) {
+    bool accept_bounds = (m2 & 1) == 0;
+    uint64_t mv = 4 * m2;
+    uint64_t vr, vp, vm;
+    int32_t e10;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+
+    // vr, vp and vm: the value and the interval bounds, times 10 ** -e10
+    if (e2 >= 0) {
+        int32_t q = ff_log10_pow2(e2) - (e2 > 3);
+        int32_t i = -e2 + q + 124 + ff_pow5_bits(q);
+        e10 = q;
+        vr = ff_mul_shift(mv, ff_pow5_inv[q], i);
+        vp = ff_mul_shift(mv + 2, ff_pow5_inv[q], i);
+        vm = ff_mul_shift(mv - 1 - mm_shift, ff_pow5_inv[q], i);
+        if (q <= 21) {
+            // Only here can a bound be exactly a multiple of 10 ** q
+            if (mv % 5 == 0) {
+                vr_trailing_zeros = ff_multiple_of_pow5(mv, q);
+            } else if (accept_bounds) {
+                vm_trailing_zeros = ff_multiple_of_pow5(mv - 1 - mm_shift,
+                                                        q);
+            } else {
+                vp -= ff_multiple_of_pow5(mv + 2, q);
+            }
+        }
+    } else {
+        int32_t q = ff_log10_pow5(-e2) - (-e2 > 1);
+        int32_t i = -e2 - q;
+        int32_t j = q - ff_pow5_bits(i) + 125;
+        e10 = q + e2;
+        vr = ff_mul_shift(mv, ff_pow5[i], j);
+        vp = ff_mul_shift(mv + 2, ff_pow5[i], j);
+        vm = ff_mul_shift(mv - 1 - mm_shift, ff_pow5[i], j);
+        if (q <= 1) {
+            vr_trailing_zeros = true;
+            if (accept_bounds) {
+                vm_trailing_zeros = mm_shift;
+            } else {
+                vp--;
+            }
+        } else if (q < 63) {
+            vr_trailing_zeros = (mv & ((1ULL << q) - 1)) == 0;
+        }
+    }
+
+    // Drop digits while the interval still holds a shorter number
+    int32_t removed = 0;
+    uint8_t last_removed = 0;
+    uint64_t output;
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        // Rare: a bound or the value is exact, so ties need care
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed == 0;
+            last_removed = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0) {
+            last_removed = 4;   // exactly halfway: round to even
+        }
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros))
+                       || last_removed >= 5);
+    } else {
+        bool round_up = false;
+        while (vp / 10 > vm / 10) {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || round_up);
+    }
+    return (ff_decimal){output, e10 + removed};
+}
+
+// Writes the sign and d * 10 ** exponent at buf: plain for
+// 1E-4 <= |x| < 1E16, otherwise d.dddE<exponent>. There is always a
+// digit after the point, so the text is also an Ada real literal
+static inline size_t ff_write(char *buf, bool negative, ff_decimal d) {
+    char *p = buf;
+    *p = '-';
+    p += negative;
+    int32_t n = fmt_digit_count(d.digits);
+    int32_t x = d.exponent + n - 1;   // the exponent of the first digit
+
+    if (x >= -4 && x < 0) {
+        memcpy(p, "0.0000", 2 - x - 1);
+        p += 2 - x - 1;
+        p += fmt_u64(p, d.digits);
+    } else if (x >= 0 && x < 16) {
+        if (n > x + 1) {
+            fmt_u64(p + 1, d.digits);
+            memmove(p, p + 1, (size_t)x + 1);
+            p[x + 1] = '.';
+            p += n + 1;
+        } else {
+            p += fmt_u64(p, d.digits);
+            memset(p, '0', (size_t)(x + 1 - n));
+            p += x + 1 - n;
+            memcpy(p, ".0", 2);
+            p += 2;
+        }
+    } else {
+        fmt_u64(p + 1, d.digits);
+        p[0] = p[1];
+        p[1] = '.';
+        if (n == 1) {
+            p[2] = '0';
+            n = 2;
+        }
+        p += n + 1;
+        *p++ = 'E';
+        p += fmt_i64(p, x);
+    }
+    return (size_t)(p - buf);
+}
+
+// Not a number: "inf", "-inf" or "nan", as printf writes them
+static inline size_t ff_write_special(char *buf, bool negative,
+                                      bool is_nan) {
+    const char *text = is_nan ? "nan" : negative ? "-inf" : "inf";
+    size_t n = strlen(text);
+    memcpy(buf, text, n);
+    return n;
+}
+
+// Writes x at buf, at most FF_MAX_LENGTH bytes, and returns the length
+static inline size_t ff_double(char *buf, double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof bits);
+    bool negative = bits >> 63;
+    uint64_t mantissa = bits & ((1ULL << 52) - 1);
+    int32_t exponent = (int32_t)((bits >> 52) & 0x7FF);
+
+    if (exponent == 0x7FF) {
+        return ff_write_special(buf, negative, mantissa != 0);
+    }
+    if (exponent == 0 && mantissa == 0) {
+        return ff_write(buf, negative, (ff_decimal){0, 0});
+    }
+    // 2 more bits for the interval bounds, which lie half an ulp away
+    uint64_t m2 = exponent == 0 ? mantissa : mantissa | (1ULL << 52);
+    int32_t e2 = (exponent == 0 ? 1 : exponent) - 1023 - 52 - 2;
+    return ff_write(buf, negative,
+                    ff_shortest(m2, e2, mantissa != 0 || exponent <= 1));
+}
+
+static inline size_t ff_float(char *buf, float x) {
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof bits);
+    bool negative = bits >> 31;
+    uint32_t mantissa = bits & ((1u << 23) - 1);
+    int32_t exponent = (int32_t)((bits >> 23) & 0xFF);
+
+    if (exponent == 0xFF) {
+        return ff_write_special(buf, negative, mantissa != 0);
+    }
+    if (exponent == 0 && mantissa == 0) {
+        return ff_write(buf, negative, (ff_decimal){0, 0});
+    }
+    uint64_t m2 = exponent == 0 ? mantissa : mantissa | (1u << 23);
+    int32_t e2 = (exponent == 0 ? 1 : exponent) - 127 - 23 - 2;
+    return ff_write(buf, negative,
+                    ff_shortest(m2, e2, mantissa != 0 || exponent <= 1));
+}
+
+#endif
@@ -0,0 +1,94 @@
+--  Round-trip test for Float_Format, the part of its contract the proof
+--  does not cover
+--  - every one of the 2 ** 32 Float bit patterns, except infinities and
+--    NaNs: Format, then strtof, must give the same bits back
+--  - 10M random Long_Float bit patterns, likewise with strtod
+--  strtof and strtod read the text back because they round correctly;
+--  'Value is not required to. Takes several minutes
+--  Test harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Text_IO;  use Ada.Text_IO;
+with Ada.Unchecked_Conversion;
+with Interfaces;   use Interfaces;
+with System;
+with Float_Format; use Float_Format;
+
+procedure Roundtrip is
+
+   Doubles     : constant := 10_000_000;
+   Max_Reports : constant := 10;
+
+   function To_Float is new Ada.Unchecked_Conversion (Unsigned_32, Float);
+   function To_Long_Float is
+     new Ada.Unchecked_Conversion (Unsigned_64, Long_Float);
+   function To_Bits is new Ada.Unchecked_Conversion (Float, Unsigned_32);
+   function To_Bits is
+     new Ada.Unchecked_Conversion (Long_Float, Unsigned_64);
+
+   function strtof
+     (Str : System.Address; Endptr : System.Address) return Float
+      with Import, Convention => C, External_Name => "strtof";
+
+   function strtod
+     (Str : System.Address; Endptr : System.Address) return Long_Float
+      with Import, Convention => C, External_Name => "strtod";
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Room for the NUL strtof needs
+   Text     : String (1 .. Max_Length + 1);
+   Length   : Text_Length;
+   Failures : Natural := 0;
+
+   procedure Report (What : String) is
+   begin
+      Failures := Failures + 1;
+      if Failures <= Max_Reports then
+         Put_Line (What & ": " & Text (1 .. Length));
+      end if;
+   end Report;
+
+begin
+   for Bits in Unsigned_32 loop
+      --  Exponent 255: an infinity or a NaN
+      if (Shift_Right (Bits, 23) and 16#FF#) /= 16#FF# then
+         Format (To_Float (Bits), Text, Length);
+         Text (Length + 1) := ASCII.NUL;
+         if To_Bits (strtof (Text'Address, System.Null_Address)) /= Bits
+         then
+            Report ("Float round trip");
+         end if;
+      end if;
+   end loop;
+   Put_Line ("Floats: all finite values checked");
+
+   for I in 1 .. Doubles loop
+      declare
+         High : constant Unsigned_64 := Unsigned_64 (Next_Random);
+         Word : constant Unsigned_64 :=
+           Shift_Left (High, 32) or Unsigned_64 (Next_Random);
+      begin
+         if (Shift_Right (Word, 52) and 16#7FF#) /= 16#7FF# then
+            Format (To_Long_Float (Word), Text, Length);
+            Text (Length + 1) := ASCII.NUL;
+            if To_Bits (strtod (Text'Address, System.Null_Address)) /= Word
+            then
+               Report ("Long_Float round trip");
+            end if;
+         end if;
+      end;
+   end loop;
+   Put_Line ("Long_Floats:" & Natural'Image (Doubles) & " random checked");
+
+   Put_Line (Natural'Image (Failures) & " failures");
+end Roundtrip;
@@ -0,0 +1,110 @@
+/*
+ * Round-trip test for float_format.h
+ * - every one of the 2 ** 32 float bit patterns: ff_float, then strtof,
+ *   must give the same bits back (NaNs: any NaN)
+ * - 10M random double bit patterns, likewise with strtod
+ * - for every 4096th float and every double above: one digit fewer,
+ *   correctly rounded by printf, must not read back as the same value
+ * Takes several minutes; prints the failures and a summary
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "float_format.h"
+
+#define DOUBLES 10000000
+#define MAX_REPORTS 10
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static long failures = 0;
+
+static void report(const char *what, const char *text, uint64_t bits) {
+    if (failures++ < MAX_REPORTS) {
+        printf("%s: %s (bits %016llx)\n", what, text,
+               (unsigned long long)bits);
+    }
+}
+
+// The length of the text's digits, without sign, point, zeros before the
+// first nonzero digit and exponent
+static int significant_digits(const char *text) {
+    int count = 0;
+    int zeros = 0;
+    bool leading = true;
+    for (const char *p = text; *p && *p != 'E'; p++) {
+        if (*p >= '1' && *p <= '9') {
+            count += zeros + 1;
+            zeros = 0;
+            leading = false;
+        } else if (*p == '0' && !leading) {
+            zeros++;
+        }
+    }
+    return count;
+}
+
+// True if the value has a representation with fewer significant digits
+// than text: the nearest one with one digit fewer reads back the same
+static bool has_shorter(const char *text, double x, bool single) {
+    int n = significant_digits(text);
+    if (n <= 1) {
+        return false;
+    }
+    char shorter[40];
+    snprintf(shorter, sizeof shorter, "%.*e", n - 2, x);
+    return single ? strtof(shorter, NULL) == (float)x
+                  : strtod(shorter, NULL) == x;
+}
+
+int main(void) {
+    char text[FF_MAX_LENGTH + 1];
+
+    uint32_t bits = 0;
+    do {
+        float x;
+        memcpy(&x, &bits, sizeof x);
+        size_t n = ff_float(text, x);
+        text[n] = '\0';
+        float y = strtof(text, NULL);
+        uint32_t back;
+        memcpy(&back, &y, sizeof back);
+        if (back != bits && !(isnan(x) && isnan(y))) {
+            report("float round trip", text, bits);
+        } else if ((bits & 4095) == 0 && isfinite(x)
+                   && has_shorter(text, x, true)) {
+            report("float not shortest", text, bits);
+        }
+        bits++;
+    } while (bits != 0);
+    printf("floats: all 2**32 checked\n");
+
+    for (long i = 0; i < DOUBLES; i++) {
+        uint64_t high = next_random();
+        uint64_t word = high << 32 | next_random();
+        double x;
+        memcpy(&x, &word, sizeof x);
+        size_t n = ff_double(text, x);
+        text[n] = '\0';
+        double y = strtod(text, NULL);
+        uint64_t back;
+        memcpy(&back, &y, sizeof back);
+        if (back != word && !(isnan(x) && isnan(y))) {
+            report("double round trip", text, word);
+        } else if (isfinite(x) && has_shorter(text, x, false)) {
+            report("double not shortest", text, word);
+        }
+    }
+    printf("doubles: %d random checked\n", DOUBLES);
+
+    printf("%ld failures\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,173 @@
+--  Benchmark: Int_Format against Integer'Image and one digit per
+--  division, writing the same values as bench.c into one buffer, one
+--  per line
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Int_Format;    use Int_Format;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 10;
+
+   LF : constant Character := ASCII.LF;
+
+   type Value_Array is array (1 .. N) of Integer;
+
+   type Value_Access is access Value_Array;
+   type Text_Access is access String;
+
+   type Format_Kernel is access function
+     (Text : in out String; Values : Value_Array) return Natural;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Random sign; the sign draw comes after the magnitude, as in bench.c
+   function Signed (Magnitude : Unsigned_32) return Integer is
+      Value : constant Integer := Integer (Magnitude);
+   begin
+      return (if (Next_Random and 1) = 1 then -Value else Value);
+   end Signed;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   --  Each returns the number of characters written
+
+   function Format_Table
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos    : Positive := Text'First;
+      Length : Text_Length;
+   begin
+      for I in Values'Range loop
+         Format (Values (I), Text (Pos .. Text'Last), Length);
+         Text (Pos + Length) := LF;
+         Pos := Pos + Length + 1;
+      end loop;
+      return Pos - Text'First;
+   end Format_Table;
+   pragma Machine_Attribute (Format_Table, "noipa");
+
+   --  The same count-first layout, one digit per division by 10
+   function Format_One_Digit
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos : Positive := Text'First;
+   begin
+      for I in Values'Range loop
+         declare
+            X : constant Long_Long_Integer := Long_Long_Integer (Values (I));
+            V : Unsigned_64 := Magnitude (X);
+            T : Positive;
+         begin
+            if X < 0 then
+               Text (Pos) := '-';
+               Pos := Pos + 1;
+            end if;
+            Pos := Pos + Digit_Count (V);
+            T := Pos;
+            loop
+               T := T - 1;
+               Text (T) := Digit (Natural (V mod 10));
+               V := V / 10;
+               exit when V = 0;
+            end loop;
+            Text (Pos) := LF;
+            Pos := Pos + 1;
+         end;
+      end loop;
+      return Pos - Text'First;
+   end Format_One_Digit;
+   pragma Machine_Attribute (Format_One_Digit, "noipa");
+
+   --  'Image returns a new string on the secondary stack, with a blank
+   --  in place of the sign of a non-negative value
+   function Format_Image
+     (Text : in out String; Values : Value_Array) return Natural
+   is
+      Pos : Positive := Text'First;
+   begin
+      for I in Values'Range loop
+         declare
+            Image : constant String := Integer'Image (Values (I));
+            First : constant Positive :=
+              (if Values (I) < 0 then Image'First else Image'First + 1);
+            Count : constant Natural := Image'Last - First + 1;
+         begin
+            Text (Pos .. Pos + Count - 1) := Image (First .. Image'Last);
+            Text (Pos + Count) := LF;
+            Pos := Pos + Count + 1;
+         end;
+      end loop;
+      return Pos - Text'First;
+   end Format_Image;
+   pragma Machine_Attribute (Format_Image, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Mixed     : constant Value_Access := new Value_Array;
+   Long_Only : constant Value_Access := new Value_Array;
+   Text      : constant Text_Access := new String (1 .. N * (Max_Length + 2));
+
+   Check : Unsigned_64 := 0;
+
+   procedure Run (Label : String; K : Format_Kernel; Values : Value_Array)
+   is
+      Bytes : Natural := 0;
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         Bytes := K (Text.all, Values);
+         Check := Check + Unsigned_64 (Bytes)
+                  + Character'Pos (Text (Bytes / 2 + 1));
+      end loop;
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (N * Passes)) &
+                " ns/value");
+   end Run;
+
+   procedure Run_All (Input : String; Values : Value_Array) is
+      Warm_Up : constant Natural := Format_Table (Text.all, Values);
+   begin
+      Put_Line (Input & ":" & Natural'Image (Warm_Up) & " bytes");
+      Run ("  Format, pair table   :", Format_Table'Access, Values);
+      Run ("  one digit per divide :", Format_One_Digit'Access, Values);
+      Run ("  Integer'Image        :", Format_Image'Access, Values);
+   end Run_All;
+
+begin
+   --  A random word shifted right by a random amount gives every length;
+   --  shifted by one it has 9 or 10 digits. Both signs in both
+   for I in 1 .. N loop
+      declare
+         Word  : constant Unsigned_32 := Next_Random;
+         Shift : constant Natural := Natural (Next_Random mod 31) + 1;
+      begin
+         Mixed (I) := Signed (Shift_Right (Word, Shift));
+      end;
+      Long_Only (I) := Signed (Shift_Right (Next_Random, 1));
+   end loop;
+
+   Run_All ("1-10 digits", Mixed.all);
+   Run_All ("9-10 digits", Long_Only.all);
+
+   Put_Line ("check:" & Unsigned_64'Image (Check));
+end Bench;
@@ -0,0 +1,134 @@
+/*
+ * Benchmark: int_format.h against the usual ways of turning an int into
+ * text, writing 1M integers into one output buffer, one per line
+ * Two inputs: every length from 1 to 10 digits, so the loop exit is
+ * unpredictable, and only 9-10 digit values, so it is not
+ * - fmt_i32: two digits per division, from a pair table
+ * - one digit per division by 10
+ * - snprintf (buf, size, "%d", x)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "int_format.h"
+
+#define N      1000000
+#define PASSES 10
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Random sign: the sign draw comes after the magnitude
+static int32_t signed_value(uint32_t magnitude) {
+    return (next_random() & 1) ? -(int32_t)magnitude : (int32_t)magnitude;
+}
+
+/* ---- kernels: each writes every value, one per line ---- */
+
+__attribute__((noipa)) static size_t format_table(char *out,
+                                                  const int32_t *values,
+                                                  size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += fmt_i32(p, values[i]);
+        *p++ = '\n';
+    }
+    return (size_t)(p - out);
+}
+
+// The same count-first layout, one digit per division by 10
+__attribute__((noipa)) static size_t format_one_digit(char *out,
+                                                      const int32_t *values,
+                                                      size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = values[i];
+        uint64_t v = x < 0 ? -(uint64_t)x : (uint64_t)x;
+        if (x < 0) {
+            *p++ = '-';
+        }
+        p += fmt_digit_count(v);
+        char *t = p;
+        do {
+            *--t = (char)('0' + v % 10);
+            v /= 10;
+        } while (v != 0);
+        *p++ = '\n';
+    }
+    return (size_t)(p - out);
+}
+
+__attribute__((noipa)) static size_t format_snprintf(char *out,
+                                                     const int32_t *values,
+                                                     size_t n) {
+    char *p = out;
+    for (size_t i = 0; i < n; i++) {
+        p += snprintf(p, FMT_MAX_LENGTH + 2, "%d\n", values[i]);
+    }
+    return (size_t)(p - out);
+}
+
+/* ---- driver ---- */
+
+static size_t check;
+
+static void run(const char *label, size_t (*kernel)(char *, const int32_t *,
+                                                    size_t),
+                char *out, const int32_t *values) {
+    double start = now_ns();
+    size_t bytes = 0;
+    for (int p = 0; p < PASSES; p++) {
+        bytes = kernel(out, values, N);
+        check += bytes + (unsigned char)out[bytes / 2];
+    }
+    double elapsed = now_ns() - start;
+    printf("%-22s: %6.1f ns/value\n", label, elapsed / ((double)N * PASSES));
+}
+
+static void run_all(const char *input, char *out, const int32_t *values) {
+    // Warm-up: pages in the output buffer
+    printf("%s: %zu bytes\n", input, format_table(out, values, N));
+    run("  fmt_i32, pair table", format_table, out, values);
+    run("  one digit per divide", format_one_digit, out, values);
+    run("  snprintf \"%d\"", format_snprintf, out, values);
+}
+
+int main(void) {
+    int32_t *mixed = malloc(N * sizeof *mixed);
+    int32_t *long_only = malloc(N * sizeof *long_only);
+    char *out = malloc(N * (FMT_MAX_LENGTH + 2));
+    if (!mixed || !long_only || !out) {
+        return 1;
+    }
+
+    // A random word shifted right by a random amount gives every length;
+    // shifted by one it has 9 or 10 digits. Both signs in both
+    for (size_t i = 0; i < N; i++) {
+        uint32_t word = next_random();
+        uint32_t shift = next_random() % 31 + 1;
+        mixed[i] = signed_value(word >> shift);
+        long_only[i] = signed_value(next_random() >> 1);
+    }
+
+    run_all("1-10 digits", out, mixed);
+    run_all("9-10 digits", out, long_only);
+
+    printf("check: %zu\n", check);
+    free(mixed);
+    free(long_only);
+    free(out);
+    return 0;
+}
@@ -0,0 +1,58 @@
+--  Integer formatting: a log line built in a fixed buffer, with no
+--  'Image and no allocation
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Interfaces;  use Interfaces;
+with Int_Format;  use Int_Format;
+
+procedure Example is
+
+   --  An Integer takes at most 11 characters, so a label of up to 10
+   --  needs 23 with the '=' and the blank
+   Field_Room : constant := 23;
+
+   --  Appends "Label=Value " after Line (Last)
+   procedure Put_Field
+     (Line  : in out String;
+      Last  : in out Natural;
+      Label : String;
+      Value : Integer)
+      with Pre  => Label'Length <= 10
+                   and then Last in Line'First - 1 .. Line'Last - Field_Room,
+           Post => Last in Last'Old + 1 .. Last'Old + Field_Room
+   is
+      Length : Text_Length;
+   begin
+      Line (Last + 1 .. Last + Label'Length) := Label;
+      Last := Last + Label'Length + 1;
+      Line (Last) := '=';
+      Format (Value, Line (Last + 1 .. Line'Last), Length);
+      Last := Last + Length + 1;
+      Line (Last) := ' ';
+   end Put_Field;
+
+   Line   : String (1 .. 80) := (others => ' ');
+   Last   : Natural := 0;
+   Number : String (1 .. Max_Length) := (others => ' ');
+   Length : Text_Length;
+
+begin
+   Put_Field (Line, Last, "id", 4711);
+   Put_Field (Line, Last, "delta", -42);
+   Put_Field (Line, Last, "total", 0);
+   Put_Line (Line (1 .. Last));
+
+   Format (Long_Long_Integer'First, Number, Length);
+   Put_Line ("Long_Long_Integer'First: " & Number (1 .. Length) & " ("
+             & Text_Length'Image (Length) & " characters)");
+   Format (Unsigned_64'Last, Number, Length);
+   Put_Line ("Unsigned_64'Last:        " & Number (1 .. Length) & " ("
+             & Text_Length'Image (Length) & " characters)");
+
+   --  Integer'Image (0) is " 0": a blank where the sign would go
+   Put_Line ("Integer'Image (0): """ & Integer'Image (0) & """");
+
+   --  A fourth Put_Field is rejected by the prover: after three, the
+   --  postconditions bound Last only by 3 * 23 = 69, and the precondition
+   --  needs 57. The proof counts the widest Integer, not these values
+end Example;
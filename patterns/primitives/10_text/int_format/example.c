@@ -0,0 +1,38 @@
+/*
+ * Integer formatting: a log line built in a fixed buffer, with no
+ * printf and no allocation
+ */
+
+#include <stdio.h>
+#include "int_format.h"
+
+// Appends "label=value " at p and returns the new end
+static char *put_field(char *p, const char *label, int64_t value) {
+    size_t n = strlen(label);
+    memcpy(p, label, n);
+    p += n;
+    *p++ = '=';
+    p += fmt_i64(p, value);
+    *p++ = ' ';
+    return p;
+}
+
+int main(void) {
+    char line[80];
+    char *p = line;
+
+    p = put_field(p, "id", 4711);
+    p = put_field(p, "delta", -42);
+    p = put_field(p, "total", 0);
+    printf("%.*s\n", (int)(p - line), line);
+
+    char digits[FMT_MAX_LENGTH];
+    size_t n = fmt_i64(digits, INT64_MIN);
+    printf("INT64_MIN:  %.*s (%zu characters)\n", (int)n, digits, n);
+    n = fmt_u64(digits, UINT64_MAX);
+    printf("UINT64_MAX: %.*s (%zu characters)\n", (int)n, digits, n);
+
+    // put_field is never told how much of line is left: two more fields
+    // run past line[80] with no warning
+    return 0;
+}
@@ -0,0 +1,141 @@
+package body Int_Format is
+
+   ----------------
+   -- Pair table --
+   ----------------
+
+   subtype Digit_Pair is String (1 .. 2);
+
+   type Pair_Table is array (0 .. 99) of Digit_Pair;
+
+   --  Built by a loop rather than written as a 200-character literal, so
+   --  what the table holds is a proven postcondition, not text to check
+   --  by eye. It runs once, at elaboration
+   function Make_Pairs return Pair_Table
+      with Post => (for all R in 0 .. 99 =>
+                      Make_Pairs'Result (R) = (Digit (R / 10),
+                                               Digit (R mod 10)))
+   is
+      Result : Pair_Table := (others => "00");
+   begin
+      for R in Pair_Table'Range loop
+         Result (R) := (Digit (R / 10), Digit (R mod 10));
+         pragma Loop_Invariant
+            (for all Q in 0 .. R =>
+               Result (Q) = (Digit (Q / 10), Digit (Q mod 10)));
+      end loop;
+      return Result;
+   end Make_Pairs;
+
+   Pairs : constant Pair_Table := Make_Pairs;
+
+   ------------
+   -- Lemmas --
+   ------------
+
+   --  Removing one more digit is one more division by 10
+   procedure Lemma_Shift_Step (X : Unsigned_64; K : Natural)
+      with Ghost,
+           Pre                => K < Natural'Last,
+           Post               => Shift_Digits (X, K + 1)
+                                 = Shift_Digits (X, K) / 10,
+           Subprogram_Variant => (Decreases => K)
+   is
+   begin
+      if K > 0 then
+         Lemma_Shift_Step (X / 10, K - 1);
+      end if;
+   end Lemma_Shift_Step;
+
+   --  Dropping two digits from a number of three or more shortens it by
+   --  two. The body is empty: each case of Digit_Count is linear
+   procedure Lemma_Count_Step (V : Unsigned_64)
+      with Ghost,
+           Pre  => V >= 100,
+           Post => Digit_Count (V) = Digit_Count (V / 100) + 2
+   is
+   begin
+      null;
+   end Lemma_Count_Step;
+
+   ------------
+   -- Format --
+   ------------
+
+   procedure Format
+     (X      : Unsigned_64;
+      Buffer : in out String;
+      Length : out Text_Length)
+   is
+      V    : Unsigned_64 := X;
+      Last : Positive;
+      Pos  : Natural;   --  Buffer (Pos + 1 .. Last) is written
+      R    : Natural range 0 .. 99;
+   begin
+      Length := Digit_Count (X);
+      Last := Buffer'First + Length - 1;
+      Pos := Last;
+
+      while V >= 100 loop
+         pragma Loop_Invariant (Pos <= Last);
+         pragma Loop_Invariant
+            (Digit_Count (X) = Last - Pos + Digit_Count (V));
+         pragma Loop_Invariant (V = Shift_Digits (X, Last - Pos));
+         pragma Loop_Invariant
+            (for all K in 0 .. Last - Pos - 1 =>
+               Buffer (Last - K)
+               = Digit (Natural (Shift_Digits (X, K) mod 10)));
+         pragma Loop_Invariant
+            (for all J in Last + 1 .. Buffer'Last =>
+               Buffer (J) = Buffer'Loop_Entry (J));
+         pragma Loop_Variant (Decreases => V);
+
+         Lemma_Count_Step (V);
+         Lemma_Shift_Step (X, Last - Pos);
+         Lemma_Shift_Step (X, Last - Pos + 1);
+         R := Natural (V mod 100);
+         pragma Assert (V mod 10 = Unsigned_64 (R mod 10)
+                        and (V / 10) mod 10 = Unsigned_64 (R / 10)
+                        and V / 100 = (V / 10) / 10);
+         V := V / 100;
+         Buffer (Pos - 1 .. Pos) := Pairs (R);
+         Pos := Pos - 2;
+      end loop;
+
+      --  One or two digits remain, the leading ones
+      Lemma_Shift_Step (X, Last - Pos);
+      if V >= 10 then
+         Buffer (Pos - 1 .. Pos) := Pairs (Natural (V));
+      else
+         Buffer (Pos) := Digit (Natural (V));
+      end if;
+   end Format;
+
+   --  '-' is always stored; for X >= 0 the first digit overwrites it.
+   --  No branch on the sign, which mispredicts half the time on mixed
+   --  signs
+   procedure Format
+     (X      : Long_Long_Integer;
+      Buffer : in out String;
+      Length : out Text_Length)
+   is
+      Negative : constant Natural := Boolean'Pos (X < 0);
+      Count    : Text_Length;
+   begin
+      Buffer (Buffer'First) := '-';
+      Format (Magnitude (X),
+              Buffer (Buffer'First + Negative .. Buffer'Last),
+              Count);
+      Length := Negative + Count;
+   end Format;
+
+   procedure Format
+     (X      : Integer;
+      Buffer : in out String;
+      Length : out Text_Length)
+   is
+   begin
+      Format (Long_Long_Integer (X), Buffer, Length);
+   end Format;
+
+end Int_Format;
@@ -0,0 +1,75 @@
+/*
+ * Integer to decimal text into a caller's buffer: no allocation, no
+ * locale, no format string
+ * Digits are produced from the right, two per division by 100, through
+ * a 200-byte table of the pairs "00" .. "99"
+ */
+
+#ifndef INT_FORMAT_H
+#define INT_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define FMT_MAX_LENGTH 20   // "-9223372036854775808" and UINT64_MAX
+
+static const char fmt_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233"
+    "34353637383940414243444546474849505152535455565758596061626364656667"
+    "6869707172737475767778798081828384858687888990919293949596979899";
+
+static const uint64_t fmt_powers[FMT_MAX_LENGTH] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+    1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// Number of decimal digits of x: 1 .. 20
+static inline int fmt_digit_count(uint64_t x) {
+    int n = 1;
+    while (n < FMT_MAX_LENGTH && x >= fmt_powers[n]) {
+        n++;
+    }
+    return n;
+}
+
+// Writes the digits of x at buf and returns how many. buf must have
+// room for fmt_digit_count (x) bytes: nothing checks it. No terminator
+// Counting first lets the digits go straight to their final place,
+// right to left, with no temporary and no variable-length copy
+static inline size_t fmt_u64(char *buf, uint64_t x) {
+    size_t length = (size_t)fmt_digit_count(x);
+    char *p = buf + length;
+    while (x >= 100) {
+        unsigned r = (unsigned)(x % 100);
+        x /= 100;
+        p -= 2;
+        memcpy(p, fmt_pairs + 2 * r, 2);
+    }
+    if (x >= 10) {
+        memcpy(p - 2, fmt_pairs + 2 * x, 2);
+    } else {
+        p[-1] = (char)('0' + x);
+    }
+    return length;
+}
+
+// The magnitude is taken in unsigned arithmetic, so INT64_MIN works
+// The sign costs no branch: '-' is always stored, and a positive value's
+// first digit overwrites it. With random signs a branch here mispredicts
+// half the time
+static inline size_t fmt_i64(char *buf, int64_t x) {
+    size_t negative = x < 0;
+    uint64_t magnitude = negative ? -(uint64_t)x : (uint64_t)x;
+    *buf = '-';
+    return negative + fmt_u64(buf + negative, magnitude);
+}
+
+static inline size_t fmt_i32(char *buf, int32_t x) {
+    return fmt_i64(buf, x);
+}
+
+#endif
@@ -0,0 +1,188 @@
+--  Benchmark: Int_Parse against Long_Long_Integer'Value and strtoll on
+--  the 10M newline-separated integers of bench.c, held in memory
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Interfaces.C;
+with System;
+with System.Storage_Elements; use System.Storage_Elements;
+with Int_Format;
+with Int_Parse;     use Int_Parse;
+
+procedure Bench is
+
+   N : constant := 10_000_000;
+
+   LF : constant Character := ASCII.LF;
+
+   type Text_Access is access Buffer_Array;
+
+   --  Each kernel returns the sum of the values parsed, modulo 2 ** 64
+   type Parse_Kernel is access function
+     (Text : Buffer_Array) return Unsigned_64;
+
+   function strtoll
+     (Str    : System.Address;
+      Endptr : access System.Address;
+      Base   : Interfaces.C.int) return Long_Long_Integer
+      with Import, Convention => C, External_Name => "strtoll";
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   function Random_Word return Unsigned_64 is
+      High : constant Unsigned_64 := Unsigned_64 (Next_Random);
+   begin
+      return Shift_Left (High, 32) or Unsigned_64 (Next_Random);
+   end Random_Word;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   function Parse_Proven (Text : Buffer_Array) return Unsigned_64 is
+      Sum      : Unsigned_64 := 0;
+      Pos      : Positive := Text'First;
+      Value    : Long_Long_Integer;
+      Consumed : Natural;
+      Overflow : Boolean;
+   begin
+      while Pos <= Text'Last loop
+         Parse (Text, Pos, Value, Consumed, Overflow);
+         Sum := Sum + Unsigned_64'Mod (Value);
+         Pos := Pos + Consumed + 1;
+      end loop;
+      return Sum;
+   end Parse_Proven;
+   pragma Machine_Attribute (Parse_Proven, "noipa");
+
+   --  The usual Ada idiom: find the end of the line, convert the slice
+   --  to a String. 'Value checks the syntax again and raises
+   --  Constraint_Error on overflow
+   function Parse_Value (Text : Buffer_Array) return Unsigned_64 is
+      Sum  : Unsigned_64 := 0;
+      Pos  : Positive := Text'First;
+      Last : Natural;
+   begin
+      while Pos <= Text'Last loop
+         Last := Pos;
+         while Text (Last + 1) /= LF loop
+            Last := Last + 1;
+         end loop;
+         Sum := Sum + Unsigned_64'Mod
+                        (Long_Long_Integer'Value
+                           (String (Text (Pos .. Last))));
+         Pos := Last + 2;
+      end loop;
+      return Sum;
+   end Parse_Value;
+   pragma Machine_Attribute (Parse_Value, "noipa");
+
+   --  Needs the NUL after Text'Last that the driver leaves there
+   function Parse_Strtoll (Text : Buffer_Array) return Unsigned_64 is
+      Sum  : Unsigned_64 := 0;
+      Pos  : Positive := Text'First;
+      Stop : aliased System.Address;
+   begin
+      while Pos <= Text'Last loop
+         Sum := Sum + Unsigned_64'Mod
+                        (strtoll (Text (Pos)'Address, Stop'Access, 10));
+         Pos := Pos + Natural (Stop - Text (Pos)'Address) + 1;
+      end loop;
+      return Sum;
+   end Parse_Strtoll;
+   pragma Machine_Attribute (Parse_Strtoll, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Text : constant Text_Access :=
+     new Buffer_Array (1 .. N * (Int_Format.Max_Length + 1) + 1);
+
+   --  N values of 64 - Min_Shift .. 64 - Max_Shift bits, both signs, one
+   --  per line, as in bench.c. Returns the text length
+   procedure Make_Text
+     (Min_Shift, Max_Shift : Natural;
+      Length               : out Natural;
+      Expected             : out Unsigned_64)
+   is
+      Span   : constant Unsigned_32 := Unsigned_32 (Max_Shift - Min_Shift + 1);
+      Number : String (1 .. Int_Format.Max_Length);
+      Count  : Int_Format.Text_Length;
+   begin
+      Length := 0;
+      Expected := 0;
+      for I in 1 .. N loop
+         declare
+            Word  : constant Unsigned_64 := Random_Word;
+            Shift : constant Natural :=
+              Min_Shift + Natural (Next_Random mod Span);
+            X     : Long_Long_Integer :=
+              Long_Long_Integer (Shift_Right (Word, Shift));
+         begin
+            if (Next_Random and 1) = 1 then
+               X := -X;
+            end if;
+            Int_Format.Format (X, Number, Count);
+            for K in 1 .. Count loop
+               Text (Length + K) := Number (K);
+            end loop;
+            Length := Length + Count + 1;
+            Text (Length) := LF;
+            Expected := Expected + Unsigned_64'Mod (X);
+         end;
+      end loop;
+      Text (Length + 1) := ASCII.NUL;
+   end Make_Text;
+
+   procedure Run
+     (Label    : String;
+      K        : Parse_Kernel;
+      Length   : Natural;
+      Expected : Unsigned_64)
+   is
+      Start   : constant Time := Clock;
+      Sum     : constant Unsigned_64 := K (Text (1 .. Length));
+      Elapsed : constant Long_Float :=
+        Long_Float (To_Duration (Clock - Start)) * 1.0E9;
+   begin
+      Put_Line (Label
+                & Long_Float'Image (Elapsed / Long_Float (N)) & " ns/value"
+                & Long_Float'Image (Elapsed / Long_Float (Length))
+                & " ns/byte  "
+                & (if Sum = Expected then "ok" else "WRONG SUM"));
+   end Run;
+
+   procedure Run_All (Input : String; Min_Shift, Max_Shift : Natural) is
+      Length   : Natural;
+      Expected : Unsigned_64;
+      Warm_Up  : Unsigned_64;
+   begin
+      Make_Text (Min_Shift, Max_Shift, Length, Expected);
+      Put_Line (Input & ":" & Natural'Image (Length / 2 ** 20) & " MB");
+      Warm_Up := Parse_Proven (Text (1 .. Length));
+      pragma Assert (Warm_Up = Expected);
+      Run ("  Int_Parse.Parse         :", Parse_Proven'Access, Length,
+           Expected);
+      Run ("  Long_Long_Integer'Value :", Parse_Value'Access, Length,
+           Expected);
+      Run ("  strtoll                 :", Parse_Strtoll'Access, Length,
+           Expected);
+   end Run_All;
+
+begin
+   Run_All ("1-19 digits", 1, 63);
+   Run_All ("16-19 digits", 1, 10);
+end Bench;
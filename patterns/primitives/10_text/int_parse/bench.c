@@ -0,0 +1,224 @@
+/*
+ * Benchmark: int_parse.h against strtoll on 10M newline-separated
+ * integers held in memory
+ * - ip_parse_i64: eight digits per SWAR step, then one at a time
+ * - eight digits per step, combined lane by lane: the shape of
+ *   Int_Parse.Parse
+ * - the same parser and checks with only the one-digit loop
+ * - strtoll (p, &end, 10)
+ * Two inputs: every length from 1 to 19 digits, and only 16-19 digits,
+ * where most of the digits go through the eight-at-a-time loop
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "int_parse.h"
+#include "../int_format/int_format.h"
+
+#define N 10000000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t random_word(void) {
+    uint64_t hi = next_random();
+    return (hi << 32) | next_random();
+}
+
+/* ---- kernels: each returns the sum of the values parsed ---- */
+
+__attribute__((noipa)) static int64_t parse_swar(const char *p,
+                                                 const char *end) {
+    uint64_t sum = 0;
+    while (p < end) {
+        int64_t value;
+        bool overflow;
+        p += ip_parse_i64(p, end, &value, &overflow) + 1;
+        sum += (uint64_t)value;
+    }
+    return (int64_t)sum;
+}
+
+// What Int_Parse.Parse does: the word built from eight byte loads, which
+// GCC merges into one, and adjacent lanes combined by multiplies by 10,
+// 100 and 10000
+static inline size_t parse_i64_lanes(const char *p, const char *end,
+                                     int64_t *value, bool *overflow) {
+    const char *q = p;
+    bool negative = q < end && *q == '-';
+    q += negative;
+    *value = 0;
+    *overflow = false;
+    if (q == end || !ip_is_digit(*q)) {
+        return 0;
+    }
+    uint64_t v = 0;
+    bool over = false;
+    while (end - q >= 8) {
+        const unsigned char *u = (const unsigned char *)q;
+        uint64_t x = (uint64_t)u[0] | (uint64_t)u[1] << 8
+                   | (uint64_t)u[2] << 16 | (uint64_t)u[3] << 24
+                   | (uint64_t)u[4] << 32 | (uint64_t)u[5] << 40
+                   | (uint64_t)u[6] << 48 | (uint64_t)u[7] << 56;
+        if (!ip_all_digits8(x)) {
+            break;
+        }
+        x &= 0x0F0F0F0F0F0F0F0FULL;
+        x = (x * 10 + (x >> 8)) & 0x00FF00FF00FF00FFULL;
+        x = (x * 100 + (x >> 16)) & 0x0000FFFF0000FFFFULL;
+        uint64_t chunk = (x * 10000 + (x >> 32)) & 0xFFFFFFFFULL;
+        over |= __builtin_mul_overflow(v, 100000000, &v)
+              | __builtin_add_overflow(v, chunk, &v);
+        q += 8;
+    }
+    while (q < end && ip_is_digit(*q)) {
+        over |= __builtin_mul_overflow(v, 10, &v)
+              | __builtin_add_overflow(v, (uint64_t)(*q - '0'), &v);
+        q++;
+    }
+    uint64_t limit = (uint64_t)INT64_MAX + negative;
+    if (over || v > limit) {
+        *overflow = true;
+    } else {
+        *value = negative ? (int64_t)(0 - v) : (int64_t)v;
+    }
+    return (size_t)(q - p);
+}
+
+__attribute__((noipa)) static int64_t parse_lanes(const char *p,
+                                                  const char *end) {
+    uint64_t sum = 0;
+    while (p < end) {
+        int64_t value;
+        bool overflow;
+        p += parse_i64_lanes(p, end, &value, &overflow) + 1;
+        sum += (uint64_t)value;
+    }
+    return (int64_t)sum;
+}
+
+// ip_parse_i64 without the SWAR loop: the same checks, one digit at a
+// time
+static inline size_t parse_i64_bytes(const char *p, const char *end,
+                                     int64_t *value, bool *overflow) {
+    const char *q = p;
+    bool negative = q < end && *q == '-';
+    q += negative;
+    *value = 0;
+    *overflow = false;
+    if (q == end || !ip_is_digit(*q)) {
+        return 0;
+    }
+    uint64_t v = 0;
+    bool over = false;
+    while (q < end && ip_is_digit(*q)) {
+        over |= __builtin_mul_overflow(v, 10, &v)
+              | __builtin_add_overflow(v, (uint64_t)(*q - '0'), &v);
+        q++;
+    }
+    uint64_t limit = (uint64_t)INT64_MAX + negative;
+    if (over || v > limit) {
+        *overflow = true;
+    } else {
+        *value = negative ? (int64_t)(0 - v) : (int64_t)v;
+    }
+    return (size_t)(q - p);
+}
+
+__attribute__((noipa)) static int64_t parse_one_digit(const char *p,
+                                                      const char *end) {
+    uint64_t sum = 0;
+    while (p < end) {
+        int64_t value;
+        bool overflow;
+        p += parse_i64_bytes(p, end, &value, &overflow) + 1;
+        sum += (uint64_t)value;
+    }
+    return (int64_t)sum;
+}
+
+__attribute__((noipa)) static int64_t parse_strtoll(const char *p,
+                                                    const char *end) {
+    uint64_t sum = 0;
+    while (p < end) {
+        char *stop;
+        sum += (uint64_t)strtoll(p, &stop, 10);
+        p = stop + 1;
+    }
+    return (int64_t)sum;
+}
+
+/* ---- driver ---- */
+
+// N values of 64 - min_shift .. 64 - max_shift bits, both signs, one per
+// line. Returns the text length
+static size_t make_text(char *text, int min_shift, int max_shift,
+                        int64_t *expected) {
+    char *p = text;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < N; i++) {
+        uint64_t word = random_word();
+        int shift = min_shift + (int)(next_random()
+                                      % (uint32_t)(max_shift - min_shift + 1));
+        int64_t x = (int64_t)(word >> shift);
+        if (next_random() & 1) {
+            x = -x;
+        }
+        p += fmt_i64(p, x);
+        *p++ = '\n';
+        sum += (uint64_t)x;
+    }
+    *expected = (int64_t)sum;
+    return (size_t)(p - text);
+}
+
+static void run(const char *label, int64_t (*kernel)(const char *,
+                                                    const char *),
+                const char *text, size_t length, int64_t expected) {
+    double start = now_ns();
+    int64_t sum = kernel(text, text + length);
+    double elapsed = now_ns() - start;
+    printf("%-22s: %5.1f ns/value  %5.2f ns/byte  %s\n", label,
+           elapsed / N, elapsed / (double)length,
+           sum == expected ? "ok" : "WRONG SUM");
+}
+
+int main(void) {
+    char *text = malloc((size_t)N * (FMT_MAX_LENGTH + 1));
+    if (!text) {
+        return 1;
+    }
+
+    const struct {
+        const char *name;
+        int min_shift, max_shift;
+    } inputs[] = {{"1-19 digits", 1, 63}, {"16-19 digits", 1, 10}};
+
+    for (int k = 0; k < 2; k++) {
+        int64_t expected;
+        size_t length = make_text(text, inputs[k].min_shift,
+                                  inputs[k].max_shift, &expected);
+        printf("%s: %zu MB\n", inputs[k].name, length >> 20);
+        parse_swar(text, text + length);   // warm-up
+        run("  ip_parse_i64, SWAR", parse_swar, text, length, expected);
+        run("  eight bytes, lanes", parse_lanes, text, length, expected);
+        run("  one digit at a time", parse_one_digit, text, length,
+            expected);
+        run("  strtoll", parse_strtoll, text, length, expected);
+    }
+    free(text);
+    return 0;
+}
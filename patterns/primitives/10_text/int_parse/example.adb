@@ -0,0 +1,46 @@
+--  Integer parsing: the fields of a comma-separated line, read in place,
+--  with the bytes consumed and overflow reported per field
+
+with Ada.Text_IO; use Ada.Text_IO;
+with Int_Parse;   use Int_Parse;
+
+procedure Example is
+
+   --  A string literal is a Buffer_Array too: any array of Character
+   Line : constant Buffer_Array :=
+     "12,-7,-9223372036854775808,9223372036854775808,x,42";
+
+   Pos      : Positive := Line'First;
+   Value    : Long_Long_Integer;
+   Consumed : Natural;
+   Overflow : Boolean;
+
+begin
+   while Pos <= Line'Last loop
+      pragma Loop_Invariant (Pos in Line'Range);
+      pragma Loop_Variant (Increases => Pos);
+
+      Parse (Line, Pos, Value, Consumed, Overflow);
+      if Consumed = 0 then
+         Put_Line ("not a number at offset" & Integer'Image (Pos - 1));
+      elsif Overflow then
+         Put_Line (String (Line (Pos .. Pos + Consumed - 1)) & ": overflow");
+      else
+         Put_Line (String (Line (Pos .. Pos + Consumed - 1)) & ":"
+                   & Long_Long_Integer'Image (Value));
+      end if;
+
+      --  Past the field and its comma
+      Pos := Pos + Consumed;
+      while Pos <= Line'Last and then Line (Pos) /= ',' loop
+         pragma Loop_Invariant (Pos in Line'Range);
+         Pos := Pos + 1;
+      end loop;
+      exit when Pos >= Line'Last;
+      Pos := Pos + 1;
+   end loop;
+
+   --  Long_Long_Integer'Value on the same fields would raise
+   --  Constraint_Error twice, at "9223372036854775808" and at "x", and
+   --  it needs each field copied to a String first
+end Example;
@@ -0,0 +1,35 @@
+/*
+ * Integer parsing: the fields of a comma-separated line, read in place,
+ * with the bytes consumed and overflow reported per field
+ */
+
+#include <stdio.h>
+#include "int_parse.h"
+
+int main(void) {
+    static const char line[] =
+        "12,-7,-9223372036854775808,9223372036854775808,x,42";
+    const char *p = line;
+    const char *end = line + sizeof line - 1;   // the NUL is not part of it
+
+    while (p < end) {
+        int64_t value;
+        bool overflow;
+        size_t n = ip_parse_i64(p, end, &value, &overflow);
+        if (n == 0) {
+            printf("not a number at offset %td\n", p - line);
+        } else if (overflow) {
+            printf("%.*s: overflow\n", (int)n, p);
+        } else {
+            printf("%.*s: %lld\n", (int)n, p, (long long)value);
+        }
+        p += n;
+        while (p < end && *p++ != ',') {
+        }
+    }
+
+    // ip_parse_i64 never reads at or past end, so the same loop works on
+    // a slice of a larger buffer. strtoll needs the NUL, and reports the
+    // overflow only through errno, with the value clamped to INT64_MAX
+    return 0;
+}
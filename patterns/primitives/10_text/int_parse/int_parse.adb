@@ -0,0 +1,248 @@
+with Interfaces; use Interfaces;
+
+package body Int_Parse is
+
+   ------------
+   -- Digits --
+   ------------
+
+   function Digit_At (B : Buffer_Array; J : Positive) return Unsigned_64 is
+     (Unsigned_64 (Character'Pos (B (J)) - Character'Pos ('0')))
+   with Pre  => J in B'Range and then Is_Digit (B (J)),
+        Post => Wider (Digit_At'Result) = Digit_Value (B (J));
+
+   -----------
+   -- Lanes --
+   -----------
+
+   --  A word holds eight bytes of text, the first byte lowest. Each step
+   --  below works on all its lanes at once; the postconditions state what
+   --  it does to each lane, and the bit-vector solver proves them
+
+   --  Ghost: lane K of W, counting lanes of Width bits from bit 0
+   function Lane (W : Unsigned_64; Width, K : Natural) return Unsigned_64 is
+     (Shift_Right (W, Width * K) and (Shift_Left (1, Width) - 1))
+   with Ghost,
+        Pre => Width in 8 | 16 | 32 and K < 64 / Width;
+
+   --  B (J .. J + 7) as one word. GCC merges the eight loads and shifts
+   --  into one 64-bit load
+   function Load_Word (B : Buffer_Array; J : Positive) return Unsigned_64 is
+     (Unsigned_64 (Character'Pos (B (J)))
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 1))), 8)
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 2))), 16)
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 3))), 24)
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 4))), 32)
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 5))), 40)
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 6))), 48)
+      or Shift_Left (Unsigned_64 (Character'Pos (B (J + 7))), 56))
+   with Pre  => J >= B'First and then J <= B'Last - 7,
+        Post => (for all K in 0 .. 7 =>
+                   Lane (Load_Word'Result, 8, K)
+                   = Unsigned_64 (Character'Pos (B (J + K))));
+
+   --  Every lane is '0' .. '9': the high nibble is 3, and adding 6 does
+   --  not carry into it
+   function Digit_Word (W : Unsigned_64) return Boolean is
+     ((W and 16#F0F0_F0F0_F0F0_F0F0#) = 16#3030_3030_3030_3030#
+      and ((W + 16#0606_0606_0606_0606#) and 16#F0F0_F0F0_F0F0_F0F0#)
+          = 16#3030_3030_3030_3030#)
+   with Post => Digit_Word'Result
+                = (for all K in 0 .. 7 => Lane (W, 8, K) in 48 .. 57);
+
+   --  Digit characters to digit values, lane by lane
+   function Low_Nibbles (W : Unsigned_64) return Unsigned_64 is
+     (W and 16#0F0F_0F0F_0F0F_0F0F#)
+   with Pre  => (for all K in 0 .. 7 => Lane (W, 8, K) in 48 .. 57),
+        Post => (for all K in 0 .. 7 =>
+                   Lane (Low_Nibbles'Result, 8, K) = Lane (W, 8, K) - 48)
+                and (Low_Nibbles'Result and 16#F0F0_F0F0_F0F0_F0F0#) = 0;
+
+   --  Adjacent lanes combined, doubling the lane width each time. The
+   --  first lane holds the leading digits, so it is the one scaled
+
+   function Combine_Pairs (X : Unsigned_64) return Unsigned_64 is
+     ((X * 10 + Shift_Right (X, 8)) and 16#00FF_00FF_00FF_00FF#)
+   with Pre  => (X and 16#F0F0_F0F0_F0F0_F0F0#) = 0
+                and (for all K in 0 .. 7 => Lane (X, 8, K) <= 9),
+        Post => (for all K in 0 .. 3 =>
+                   Lane (Combine_Pairs'Result, 16, K)
+                   = 10 * Lane (X, 8, 2 * K) + Lane (X, 8, 2 * K + 1));
+
+   function Combine_Quads (X : Unsigned_64) return Unsigned_64 is
+     ((X * 100 + Shift_Right (X, 16)) and 16#0000_FFFF_0000_FFFF#)
+   with Pre  => (X and 16#FF00_FF00_FF00_FF00#) = 0
+                and (for all K in 0 .. 3 => Lane (X, 16, K) <= 99),
+        Post => (for all K in 0 .. 1 =>
+                   Lane (Combine_Quads'Result, 32, K)
+                   = 100 * Lane (X, 16, 2 * K) + Lane (X, 16, 2 * K + 1));
+
+   function Combine_Halves (X : Unsigned_64) return Unsigned_64 is
+     ((X * 10_000 + Shift_Right (X, 32)) and 16#0000_0000_FFFF_FFFF#)
+   with Pre  => (X and 16#FFFF_0000_FFFF_0000#) = 0
+                and Lane (X, 32, 0) <= 9_999 and Lane (X, 32, 1) <= 9_999,
+        Post => Combine_Halves'Result
+                = 10_000 * Lane (X, 32, 0) + Lane (X, 32, 1);
+
+   --  B (J .. J + 7) are all digits, with one load and two compares
+   function Eight_Digits (B : Buffer_Array; J : Positive) return Boolean is
+     (Digit_Word (Load_Word (B, J)))
+   with Pre  => J >= B'First and then J <= B'Last - 7,
+        Post => Eight_Digits'Result = All_Digits (B, J, J + 7);
+
+   --  B (J .. J + 7) as one number: three multiplies, each combining
+   --  every pair of lanes at once
+   function Chunk_Value (B : Buffer_Array; J : Positive) return Unsigned_64
+   with Pre  => J >= B'First and then J <= B'Last - 7
+                and then All_Digits (B, J, J + 7),
+        Post => Wider (Chunk_Value'Result)
+                = 10_000_000 * Digit_Value (B (J))
+                  + 1_000_000 * Digit_Value (B (J + 1))
+                  + 100_000 * Digit_Value (B (J + 2))
+                  + 10_000 * Digit_Value (B (J + 3))
+                  + 1_000 * Digit_Value (B (J + 4))
+                  + 100 * Digit_Value (B (J + 5))
+                  + 10 * Digit_Value (B (J + 6))
+                  + Digit_Value (B (J + 7))
+   is
+      D : constant Unsigned_64 := Low_Nibbles (Load_Word (B, J));
+      P : constant Unsigned_64 := Combine_Pairs (D);
+      Q : constant Unsigned_64 := Combine_Quads (P);
+   begin
+      pragma Assert (for all K in 0 .. 7 =>
+                       Wider (Lane (D, 8, K)) = Digit_Value (B (J + K)));
+      pragma Assert (for all K in 0 .. 3 => Lane (P, 16, K) <= 99);
+      pragma Assert (for all K in 0 .. 1 => Lane (Q, 32, K) <= 9_999);
+      return Combine_Halves (Q);
+   end Chunk_Value;
+
+   ------------
+   -- Lemmas --
+   ------------
+
+   --  Saturating after every digit or only at the end gives the same
+   --  value: once X reaches Cap, 10 * X + D stays above it
+   procedure Lemma_Min_Step (X, D : Wider)
+      with Ghost,
+           Pre  => X in 0 .. 10 ** 8 * Cap and D in 0 .. 9,
+           Post => Wider'Min (Cap, 10 * Wider'Min (Cap, X) + D)
+                   = Wider'Min (Cap, 10 * X + D)
+   is
+   begin
+      null;
+   end Lemma_Min_Step;
+
+   --  Eight more digits: the ghost value, unrolled one digit at a time,
+   --  equals one multiply by 10 ** 8 and one add of Chunk_Value
+   procedure Lemma_Chunk (B : Buffer_Array; First, J : Positive)
+      with Ghost,
+           Pre  => First <= J
+                   and then J <= B'Last - 7
+                   and then All_Digits (B, First, J + 7),
+           Post => Digits_Value (B, First, J + 7)
+                   = Wider'Min (Cap, 10 ** 8 * Digits_Value (B, First, J - 1)
+                                     + Wider (Chunk_Value (B, J)))
+   is
+      P  : constant Wider := Digits_Value (B, First, J - 1);
+      H1 : constant Wider := 10 * P + Digit_Value (B (J));
+      H2 : constant Wider := 10 * H1 + Digit_Value (B (J + 1));
+      H3 : constant Wider := 10 * H2 + Digit_Value (B (J + 2));
+      H4 : constant Wider := 10 * H3 + Digit_Value (B (J + 3));
+      H5 : constant Wider := 10 * H4 + Digit_Value (B (J + 4));
+      H6 : constant Wider := 10 * H5 + Digit_Value (B (J + 5));
+      H7 : constant Wider := 10 * H6 + Digit_Value (B (J + 6));
+      H8 : constant Wider := 10 * H7 + Digit_Value (B (J + 7));
+   begin
+      pragma Assert (Digits_Value (B, First, J) = Wider'Min (Cap, H1));
+      Lemma_Min_Step (H1, Digit_Value (B (J + 1)));
+      pragma Assert (Digits_Value (B, First, J + 1) = Wider'Min (Cap, H2));
+      Lemma_Min_Step (H2, Digit_Value (B (J + 2)));
+      pragma Assert (Digits_Value (B, First, J + 2) = Wider'Min (Cap, H3));
+      Lemma_Min_Step (H3, Digit_Value (B (J + 3)));
+      pragma Assert (Digits_Value (B, First, J + 3) = Wider'Min (Cap, H4));
+      Lemma_Min_Step (H4, Digit_Value (B (J + 4)));
+      pragma Assert (Digits_Value (B, First, J + 4) = Wider'Min (Cap, H5));
+      Lemma_Min_Step (H5, Digit_Value (B (J + 5)));
+      pragma Assert (Digits_Value (B, First, J + 5) = Wider'Min (Cap, H6));
+      Lemma_Min_Step (H6, Digit_Value (B (J + 6)));
+      pragma Assert (Digits_Value (B, First, J + 6) = Wider'Min (Cap, H7));
+      Lemma_Min_Step (H7, Digit_Value (B (J + 7)));
+      pragma Assert (H8 = 10 ** 8 * P + Wider (Chunk_Value (B, J)));
+   end Lemma_Chunk;
+
+   -----------
+   -- Parse --
+   -----------
+
+   procedure Parse
+     (B        : Buffer_Array;
+      First    : Positive;
+      Value    : out Long_Long_Integer;
+      Consumed : out Natural;
+      Overflow : out Boolean)
+   is
+      Sign  : constant Natural := Sign_Length (B, First);
+      Start : constant Positive := First + Sign;
+      J     : Positive := Start;   --  the next byte to read
+      V     : Unsigned_64 := 0;
+      Over  : Boolean := False;    --  the digits so far exceed 2 ** 64 - 1
+      C     : Unsigned_64;
+   begin
+      Value := 0;
+      Consumed := 0;
+      Overflow := False;
+      if Start > B'Last or else not Is_Digit (B (Start)) then
+         return;
+      end if;
+
+      --  Eight digits per step while eight are there
+      while J <= B'Last - 7 and then Eight_Digits (B, J) loop
+         pragma Loop_Invariant (J >= Start);
+         pragma Loop_Invariant (All_Digits (B, Start, J + 7));
+         pragma Loop_Invariant
+            (if Over then Digits_Value (B, Start, J - 1) = Cap
+             else Wider (V) = Digits_Value (B, Start, J - 1));
+         pragma Loop_Variant (Increases => J);
+
+         Lemma_Chunk (B, Start, J);
+         C := Chunk_Value (B, J);
+         if Over or else V > (Unsigned_64'Last - C) / 10 ** 8 then
+            Over := True;
+         else
+            V := V * 10 ** 8 + C;
+         end if;
+         J := J + 8;
+      end loop;
+
+      --  The last 0 to 7 digits, or all of them near the end of B
+      while J <= B'Last and then Is_Digit (B (J)) loop
+         pragma Loop_Invariant (J >= Start);
+         pragma Loop_Invariant (All_Digits (B, Start, J));
+         pragma Loop_Invariant
+            (if Over then Digits_Value (B, Start, J - 1) = Cap
+             else Wider (V) = Digits_Value (B, Start, J - 1));
+         pragma Loop_Variant (Increases => J);
+
+         C := Digit_At (B, J);
+         if Over or else V > (Unsigned_64'Last - C) / 10 then
+            Over := True;
+         else
+            V := V * 10 + C;
+         end if;
+         J := J + 1;
+      end loop;
+
+      Consumed := J - First;
+      Overflow := Over or else V > 2 ** 63 - 1 + Unsigned_64 (Sign);
+      if not Overflow then
+         if Sign = 0 then
+            Value := Long_Long_Integer (V);
+         elsif V = 2 ** 63 then
+            Value := Long_Long_Integer'First;
+         else
+            Value := -Long_Long_Integer (V);
+         end if;
+      end if;
+   end Parse;
+
+end Int_Parse;
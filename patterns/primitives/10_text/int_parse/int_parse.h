@@ -0,0 +1,82 @@
+/*
+ * Decimal integer parsing from a byte buffer: no terminator needed, no
+ * errno, no locale
+ * Eight digits at a time with SWAR (SIMD within a register): one 64-bit
+ * load, one test for "all eight are digits", three multiplies to
+ * combine them
+ */
+
+#ifndef INT_PARSE_H
+#define INT_PARSE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static inline bool ip_is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// The 8 bytes at p, first byte lowest (x86 is little-endian)
+static inline uint64_t ip_load8(const char *p) {
+    uint64_t x;
+    memcpy(&x, p, 8);
+    return x;
+}
+
+// Every byte is '0' .. '9': the high nibble is 3, and adding 6 does not
+// carry into it
+static inline bool ip_all_digits8(uint64_t x) {
+    return ((x & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL)
+        && (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL)
+            == 0x3030303030303030ULL);
+}
+
+// Eight digit bytes to their value: pairs, then quads, then the whole
+// word, each by one multiply and shift
+static inline uint64_t ip_value8(uint64_t x) {
+    x = (x & 0x0F0F0F0F0F0F0F0FULL) * 2561 >> 8;
+    x = (x & 0x00FF00FF00FF00FFULL) * 6553601 >> 16;
+    return (x & 0x0000FFFF0000FFFFULL) * 42949672960001ULL >> 32;
+}
+
+// Parses an optional '-' and the digits after it, starting at p and not
+// reading at or past end. Returns the bytes consumed, 0 if there are no
+// digits. On overflow every digit is still consumed, *overflow is set
+// and *value is 0
+static inline size_t ip_parse_i64(const char *p, const char *end,
+                                  int64_t *value, bool *overflow) {
+    const char *q = p;
+    bool negative = q < end && *q == '-';
+    q += negative;
+    *value = 0;
+    *overflow = false;
+    if (q == end || !ip_is_digit(*q)) {
+        return 0;
+    }
+
+    uint64_t v = 0;
+    bool over = false;
+    while (end - q >= 8 && ip_all_digits8(ip_load8(q))) {
+        uint64_t chunk = ip_value8(ip_load8(q));
+        over |= __builtin_mul_overflow(v, 100000000, &v)
+              | __builtin_add_overflow(v, chunk, &v);
+        q += 8;
+    }
+    while (q < end && ip_is_digit(*q)) {
+        over |= __builtin_mul_overflow(v, 10, &v)
+              | __builtin_add_overflow(v, (uint64_t)(*q - '0'), &v);
+        q++;
+    }
+
+    uint64_t limit = (uint64_t)INT64_MAX + negative;
+    if (over || v > limit) {
+        *overflow = true;
+    } else {
+        *value = negative ? (int64_t)(0 - v) : (int64_t)v;
+    }
+    return (size_t)(q - p);
+}
+
+#endif
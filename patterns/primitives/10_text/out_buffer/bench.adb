@@ -0,0 +1,134 @@
+--  Benchmark: 10M lines of "row <i> value <x>" written to /dev/null
+--  through Out_Buffers and through Text_IO, with the values of bench.c
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Integer_Text_IO;
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with Interfaces.C;
+with Fd_Output;     use Fd_Output;
+with Out_Buffers;   use Out_Buffers;
+
+procedure Bench is
+
+   Lines : constant := 10_000_000;
+
+   type Value_Array is array (0 .. Lines - 1) of Integer;
+   type Value_Access is access Value_Array;
+
+   function C_Open (Path : Interfaces.C.char_array; Flags : Interfaces.C.int)
+      return Interfaces.C.int
+      with Import, Convention => C, External_Name => "open";
+
+   O_WRONLY : constant := 1;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Random sign; the sign draw comes after the magnitude, as in bench.c
+   function Signed (Magnitude : Unsigned_32) return Integer is
+      Value : constant Integer := Integer (Magnitude);
+   begin
+      return (if (Next_Random and 1) = 1 then -Value else Value);
+   end Signed;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   procedure Write_Buffered (Fd : File_Descriptor; Values : Value_Array) is
+      Output : Out_Buffer (Fd);
+   begin
+      for I in Values'Range loop
+         Append_String (Output, "row ");
+         Append_Integer (Output, I);
+         Append_String (Output, " value ");
+         Append_Integer (Output, Values (I));
+         Append_Char (Output, ASCII.LF);
+      end loop;
+      Flush (Output);
+   end Write_Buffered;
+   pragma Machine_Attribute (Write_Buffered, "noipa");
+
+   --  The usual Ada idiom. 'Image puts a blank before a non-negative
+   --  value, so the text differs from the others for negative values
+   procedure Write_Image (F : File_Type; Values : Value_Array) is
+   begin
+      for I in Values'Range loop
+         Put_Line (F, "row" & Integer'Image (I)
+                   & " value" & Integer'Image (Values (I)));
+      end loop;
+      Flush (F);
+   end Write_Image;
+   pragma Machine_Attribute (Write_Image, "noipa");
+
+   --  The same bytes as Write_Buffered, one Text_IO call per piece
+   procedure Write_Pieces (F : File_Type; Values : Value_Array) is
+   begin
+      for I in Values'Range loop
+         Put (F, "row ");
+         Ada.Integer_Text_IO.Put (F, I, Width => 0);
+         Put (F, " value ");
+         Ada.Integer_Text_IO.Put (F, Values (I), Width => 0);
+         New_Line (F);
+      end loop;
+      Flush (F);
+   end Write_Pieces;
+   pragma Machine_Attribute (Write_Pieces, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Values : constant Value_Access := new Value_Array;
+   Null_F : File_Type;
+   Fd     : File_Descriptor;
+   Start  : Time;
+
+   procedure Report (Label : String) is
+   begin
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 / Long_Float (Lines)) &
+                " ns/line");
+   end Report;
+
+begin
+   --  Every length from 1 to 10 digits, both signs, as in int_format
+   for I in Values'Range loop
+      declare
+         Word  : constant Unsigned_32 := Next_Random;
+         Shift : constant Natural := Natural (Next_Random mod 31) + 1;
+      begin
+         Values (I) := Signed (Shift_Right (Word, Shift));
+      end;
+   end loop;
+
+   Fd := File_Descriptor
+     (C_Open (Interfaces.C.To_C ("/dev/null"), O_WRONLY));
+   Open (Null_F, Out_File, "/dev/null");
+
+   Start := Clock;
+   Write_Buffered (Fd, Values.all);
+   Report ("Out_Buffers, write (2)     :");
+
+   Start := Clock;
+   Write_Image (Null_F, Values.all);
+   Report ("Text_IO, Put_Line & 'Image :");
+
+   Start := Clock;
+   Write_Pieces (Null_F, Values.all);
+   Report ("Text_IO, Put per piece     :");
+
+   Close (Null_F);
+end Bench;
@@ -0,0 +1,120 @@
+/*
+ * Benchmark: 10M lines of "row <i> value <x>" written to /dev/null
+ * - out_buffer.h: one write (2) per 64 KB
+ * - fprintf (f, "row %d value %d\n", ...)
+ * - the same digits from fmt_i32, then one fwrite per line: the cost of
+ *   going through stdio once per line, without printf's formatting
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "out_buffer.h"
+
+#define LINES 10000000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Random sign: the sign draw comes after the magnitude
+static int32_t signed_value(uint32_t magnitude) {
+    return (next_random() & 1) ? -(int32_t)magnitude : (int32_t)magnitude;
+}
+
+/* ---- kernels: the stdio ones return the number of bytes written ---- */
+
+static out_buffer buffer;
+
+__attribute__((noipa)) static void write_out_buffer(int fd,
+                                                    const int32_t *values,
+                                                    size_t n) {
+    ob_init(&buffer, fd);
+    for (size_t i = 0; i < n; i++) {
+        ob_append(&buffer, "row ", 4);
+        ob_append_int(&buffer, (int32_t)i);
+        ob_append(&buffer, " value ", 7);
+        ob_append_int(&buffer, values[i]);
+        ob_append_char(&buffer, '\n');
+    }
+    ob_flush(&buffer);
+}
+
+__attribute__((noipa)) static size_t write_fprintf(FILE *f,
+                                                   const int32_t *values,
+                                                   size_t n) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < n; i++) {
+        bytes += (size_t)fprintf(f, "row %d value %d\n", (int)i, values[i]);
+    }
+    fflush(f);
+    return bytes;
+}
+
+__attribute__((noipa)) static size_t write_fwrite(FILE *f,
+                                                  const int32_t *values,
+                                                  size_t n) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < n; i++) {
+        char line[64];
+        char *p = line;
+        memcpy(p, "row ", 4);
+        p += 4;
+        p += fmt_i32(p, (int32_t)i);
+        memcpy(p, " value ", 7);
+        p += 7;
+        p += fmt_i32(p, values[i]);
+        *p++ = '\n';
+        bytes += fwrite(line, 1, (size_t)(p - line), f);
+    }
+    fflush(f);
+    return bytes;
+}
+
+int main(void) {
+    int32_t *values = malloc(LINES * sizeof *values);
+    int fd = open("/dev/null", O_WRONLY);
+    FILE *f = fopen("/dev/null", "w");
+    if (!values || fd < 0 || !f) {
+        return 1;
+    }
+
+    // Every length from 1 to 10 digits, both signs, as in int_format
+    for (size_t i = 0; i < LINES; i++) {
+        uint32_t word = next_random();
+        uint32_t shift = next_random() % 31 + 1;
+        values[i] = signed_value(word >> shift);
+    }
+
+    double start = now_ns();
+    write_out_buffer(fd, values, LINES);
+    printf("%-25s: %5.1f ns/line\n", "out_buffer, write (2)",
+           (now_ns() - start) / LINES);
+
+    start = now_ns();
+    size_t bytes = write_fprintf(f, values, LINES);
+    printf("%-25s: %5.1f ns/line  (%zu bytes)\n", "fprintf",
+           (now_ns() - start) / LINES, bytes);
+
+    start = now_ns();
+    bytes = write_fwrite(f, values, LINES);
+    printf("%-25s: %5.1f ns/line  (%zu bytes)\n", "fmt_i32 + fwrite per line",
+           (now_ns() - start) / LINES, bytes);
+
+    fclose(f);
+    close(fd);
+    free(values);
+    return 0;
+}
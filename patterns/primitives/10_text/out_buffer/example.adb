@@ -0,0 +1,44 @@
+--  Buffered output: a small report written through Out_Buffers, or
+--  through Text_IO when Buffered is False. Both print the same bytes
+
+with Ada.Integer_Text_IO;
+with Ada.Text_IO;
+with Fd_Output;   use Fd_Output;
+with Out_Buffers; use Out_Buffers;
+
+procedure Example is
+
+   --  False sends every piece through Text_IO, as the other examples do
+   Buffered : constant Boolean := True;
+
+   Output : Out_Buffer (Standard_Output);
+   Total  : Natural := 0;
+
+begin
+   for N in 1 .. 10 loop
+      Total := Total + N * N;
+      if Buffered then
+         Append_String (Output, "n=");
+         Append_Integer (Output, N);
+         Append_String (Output, " square=");
+         Append_Integer (Output, N * N);
+         Append_String (Output, " sum of squares=");
+         Append_Integer (Output, Total);
+         Append_Char (Output, ASCII.LF);
+      else
+         Ada.Text_IO.Put ("n=");
+         Ada.Integer_Text_IO.Put (N, Width => 0);
+         Ada.Text_IO.Put (" square=");
+         Ada.Integer_Text_IO.Put (N * N, Width => 0);
+         Ada.Text_IO.Put (" sum of squares=");
+         Ada.Integer_Text_IO.Put (Total, Width => 0);
+         Ada.Text_IO.New_Line;
+      end if;
+   end loop;
+
+   --  The 10 lines are still in Output: this is the only write (2)
+   Flush (Output);
+
+   --  Text_IO keeps a buffer of its own. Interleaving it with Output on
+   --  the same descriptor reorders lines unless each side flushes first
+end Example;
@@ -0,0 +1,37 @@
+/*
+ * Buffered output: a small report written through out_buffer.h, or
+ * through printf when BUFFERED is 0. Both print the same bytes
+ */
+
+#include <stdio.h>
+#include "out_buffer.h"
+
+#define BUFFERED 1   // 0: one printf per line, as the other examples do
+
+int main(void) {
+    static out_buffer output;
+    int total = 0;
+
+    ob_init(&output, STDOUT_FILENO);
+    for (int n = 1; n <= 10; n++) {
+        total += n * n;
+        if (BUFFERED) {
+            ob_append(&output, "n=", 2);
+            ob_append_int(&output, n);
+            ob_append(&output, " square=", 8);
+            ob_append_int(&output, n * n);
+            ob_append(&output, " sum of squares=", 16);
+            ob_append_int(&output, total);
+            ob_append_char(&output, '\n');
+        } else {
+            printf("n=%d square=%d sum of squares=%d\n", n, n * n, total);
+        }
+    }
+
+    // The 10 lines are still in output: this is the only write (2)
+    ob_flush(&output);
+
+    // Leaving out ob_flush loses them silently. stdio's buffer is
+    // flushed by exit, this one is not
+    return 0;
+}
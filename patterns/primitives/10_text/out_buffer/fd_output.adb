@@ -0,0 +1,27 @@
+with Interfaces.C; use Interfaces.C;
+with System;
+
+package body Fd_Output
+   with SPARK_Mode => Off
+is
+
+   --  ssize_t write (int fd, const void *buf, size_t count)
+   function Write
+     (Fd    : int;
+      Buf   : System.Address;
+      Count : size_t) return long
+      with Import, Convention => C, External_Name => "write";
+
+   procedure Write_All (Fd : File_Descriptor; Data : String) is
+      First : Positive := Data'First;
+      Done  : long;
+   begin
+      while First <= Data'Last loop
+         Done := Write (int (Fd), Data (First)'Address,
+                        size_t (Data'Last - First + 1));
+         exit when Done <= 0;
+         First := First + Natural (Done);
+      end loop;
+   end Write_All;
+
+end Fd_Output;
@@ -0,0 +1,75 @@
+/*
+ * Output collected in a fixed block and handed to the kernel with one
+ * write (2) per block, instead of one stdio call per piece
+ * Integers are formatted in place by ../int_format/int_format.h
+ */
+
+#ifndef OUT_BUFFER_H
+#define OUT_BUFFER_H
+
+#include <string.h>
+#include <unistd.h>
+#include "../int_format/int_format.h"
+
+#define OB_CAPACITY 65536
+
+typedef struct {
+    int fd;
+    size_t length;   // bytes waiting in data
+    char data[OB_CAPACITY];
+} out_buffer;
+
+static inline void ob_init(out_buffer *b, int fd) {
+    b->fd = fd;
+    b->length = 0;
+}
+
+// Writes all of data, retrying short writes. An error drops the rest,
+// as stdio does until someone calls ferror
+static inline void ob_write_all(int fd, const char *data, size_t n) {
+    while (n > 0) {
+        ssize_t done = write(fd, data, n);
+        if (done <= 0) {
+            return;
+        }
+        data += done;
+        n -= (size_t)done;
+    }
+}
+
+// Nothing flushes on exit: forgetting this loses the last block
+static inline void ob_flush(out_buffer *b) {
+    ob_write_all(b->fd, b->data, b->length);
+    b->length = 0;
+}
+
+// A string larger than the whole buffer goes straight to write
+static inline void ob_append(out_buffer *b, const char *s, size_t n) {
+    if (n > OB_CAPACITY - b->length) {
+        ob_flush(b);
+        if (n > OB_CAPACITY) {
+            ob_write_all(b->fd, s, n);
+            return;
+        }
+    }
+    memcpy(b->data + b->length, s, n);
+    b->length += n;
+}
+
+static inline void ob_append_char(out_buffer *b, char c) {
+    if (b->length == OB_CAPACITY) {
+        ob_flush(b);
+    }
+    b->data[b->length++] = c;
+}
+
+// Flushes when fewer than FMT_MAX_LENGTH bytes are left, so the digits
+// can be written in place without counting them first
+static inline void ob_append_int(out_buffer *b, int32_t x) {
+    if (OB_CAPACITY - b->length < FMT_MAX_LENGTH) {
+        ob_flush(b);
+    }
+    b->length += fmt_i32(b->data + b->length, x);
+}
+
+#endif
@@ -0,0 +1,43 @@
+package body Out_Buffers is
+
+   procedure Flush (B : in out Out_Buffer) is
+   begin
+      if B.Last > 0 then
+         Write_All (B.Fd, B.Data (1 .. B.Last));
+         B.Last := 0;
+      end if;
+   end Flush;
+
+   procedure Append_String (B : in out Out_Buffer; S : String) is
+   begin
+      if S'Length > Capacity - B.Last then
+         Flush (B);
+         if S'Length > Capacity then
+            Write_All (B.Fd, S);
+            return;
+         end if;
+      end if;
+      B.Data (B.Last + 1 .. B.Last + S'Length) := S;
+      B.Last := B.Last + S'Length;
+   end Append_String;
+
+   procedure Append_Char (B : in out Out_Buffer; C : Character) is
+   begin
+      if B.Last = Capacity then
+         Flush (B);
+      end if;
+      B.Last := B.Last + 1;
+      B.Data (B.Last) := C;
+   end Append_Char;
+
+   procedure Append_Integer (B : in out Out_Buffer; X : Integer) is
+      Count : Text_Length;
+   begin
+      if Capacity - B.Last < Max_Length then
+         Flush (B);
+      end if;
+      Format (X, B.Data (B.Last + 1 .. Capacity), Count);
+      B.Last := B.Last + Count;
+   end Append_Integer;
+
+end Out_Buffers;
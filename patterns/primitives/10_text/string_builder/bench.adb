@@ -0,0 +1,192 @@
+--  Benchmark: building the lines of bench.c by `&` over 'Image, by
+--  Unbounded_String appends and by String_Builders
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time;         use Ada.Real_Time;
+with Ada.Strings.Unbounded; use Ada.Strings.Unbounded;
+with Ada.Text_IO;           use Ada.Text_IO;
+with Interfaces;            use Interfaces;
+with Int_Format;
+with String_Builders;       use String_Builders;
+
+procedure Bench is
+
+   N      : constant := 1_000_000;
+   Passes : constant := 10;
+   Width  : constant := 8;
+
+   type Value_Array is array (0 .. N - 1) of Integer;
+   type Value_Access is access Value_Array;
+
+   type Kernel is access function (V : Value_Array) return Natural;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Random sign and a random number of digits, 1 .. 10, as in bench.c
+   function Random_Value return Integer is
+      Magnitude : constant Unsigned_32 := Next_Random;
+      Bits      : constant Unsigned_32 :=
+        Shift_Right (Magnitude, Natural (Next_Random mod 32));
+      X         : constant Integer := Integer (Shift_Right (Bits, 1));
+   begin
+      return (if (Next_Random and 1) = 1 then -X else X);
+   end Random_Value;
+
+   --  Length and last character, as in bench.c
+   function Digest (S : String) return Natural is
+     (S'Length + Character'Pos (S (S'Last)));
+
+   B : Builder (Width * (Int_Format.Max_Length + 2));
+
+   ----------
+   -- Swap --
+   ----------
+
+   --  The line of parameters/example.adb: each 'Image and the result go
+   --  on the secondary stack, released at the end of each iteration
+   function Swap_Concatenation (V : Value_Array) return Natural is
+      Check : Natural := 0;
+   begin
+      for I in 0 .. N / 2 - 1 loop
+         Check := Check + Digest ("Before swap: a=" & Integer'Image (V (2 * I))
+                                  & ", b=" & Integer'Image (V (2 * I + 1)));
+      end loop;
+      return Check;
+   end Swap_Concatenation;
+   pragma Machine_Attribute (Swap_Concatenation, "noipa");
+
+   function Swap_Unbounded (V : Value_Array) return Natural is
+      Check : Natural := 0;
+      U     : Unbounded_String;
+   begin
+      for I in 0 .. N / 2 - 1 loop
+         U := To_Unbounded_String ("Before swap: a=");
+         Append (U, Integer'Image (V (2 * I)));
+         Append (U, ", b=");
+         Append (U, Integer'Image (V (2 * I + 1)));
+         Check := Check + Length (U) + Character'Pos (Element (U, Length (U)));
+      end loop;
+      return Check;
+   end Swap_Unbounded;
+   pragma Machine_Attribute (Swap_Unbounded, "noipa");
+
+   function Swap_Builder (V : Value_Array) return Natural is
+      Check : Natural := 0;
+   begin
+      for I in 0 .. N / 2 - 1 loop
+         Clear (B);
+         Append (B, "Before swap: a=");
+         Append (B, V (2 * I));
+         Append (B, ", b=");
+         Append (B, V (2 * I + 1));
+         Check := Check + Length (B) + Character'Pos (Element (B, Length (B)));
+      end loop;
+      return Check;
+   end Swap_Builder;
+   pragma Machine_Attribute (Swap_Builder, "noipa");
+
+   ---------
+   -- Row --
+   ---------
+
+   function Row_Concatenation (V : Value_Array) return Natural is
+      Check : Natural := 0;
+   begin
+      for I in 0 .. N / Width - 1 loop
+         declare
+            J : constant Natural := Width * I;
+         begin
+            Check := Check + Digest
+              (Integer'Image (V (J)) & ", " & Integer'Image (V (J + 1))
+               & ", " & Integer'Image (V (J + 2))
+               & ", " & Integer'Image (V (J + 3))
+               & ", " & Integer'Image (V (J + 4))
+               & ", " & Integer'Image (V (J + 5))
+               & ", " & Integer'Image (V (J + 6))
+               & ", " & Integer'Image (V (J + 7)));
+         end;
+      end loop;
+      return Check;
+   end Row_Concatenation;
+   pragma Machine_Attribute (Row_Concatenation, "noipa");
+
+   function Row_Unbounded (V : Value_Array) return Natural is
+      Check : Natural := 0;
+      U     : Unbounded_String;
+   begin
+      for I in 0 .. N / Width - 1 loop
+         U := Null_Unbounded_String;
+         for K in 0 .. Width - 1 loop
+            if K > 0 then
+               Append (U, ", ");
+            end if;
+            Append (U, Integer'Image (V (Width * I + K)));
+         end loop;
+         Check := Check + Length (U) + Character'Pos (Element (U, Length (U)));
+      end loop;
+      return Check;
+   end Row_Unbounded;
+   pragma Machine_Attribute (Row_Unbounded, "noipa");
+
+   function Row_Builder (V : Value_Array) return Natural is
+      Check : Natural := 0;
+   begin
+      for I in 0 .. N / Width - 1 loop
+         Clear (B);
+         for K in 0 .. Width - 1 loop
+            if K > 0 then
+               Append (B, ", ");
+            end if;
+            Append (B, V (Width * I + K));
+         end loop;
+         Check := Check + Length (B) + Character'Pos (Element (B, Length (B)));
+      end loop;
+      return Check;
+   end Row_Builder;
+   pragma Machine_Attribute (Row_Builder, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Values : constant Value_Access := new Value_Array;
+
+   Check : Unsigned_64 := 0;
+
+   procedure Run (Label : String; K : Kernel; Per_Line : Positive) is
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         Check := Check + Unsigned_64 (K (Values.all));
+      end loop;
+      Put_Line (Label &
+                Long_Float'Image (Long_Float (To_Duration (Clock - Start))
+                                  * 1.0E9 * Long_Float (Per_Line)
+                                  / Long_Float (N * Passes)) &
+                " ns/line");
+   end Run;
+
+begin
+   for I in Values'Range loop
+      Values (I) := Random_Value;
+   end loop;
+
+   Run ("swap, & and 'Image     :", Swap_Concatenation'Access, 2);
+   Run ("swap, Unbounded_String :", Swap_Unbounded'Access, 2);
+   Run ("swap, Builder          :", Swap_Builder'Access, 2);
+   Run ("row of 8, & and 'Image :", Row_Concatenation'Access, Width);
+   Run ("row of 8, Unbounded    :", Row_Unbounded'Access, Width);
+   Run ("row of 8, Builder      :", Row_Builder'Access, Width);
+
+   Put_Line ("checksum:" & Unsigned_64'Image (Check));
+end Bench;
@@ -0,0 +1,178 @@
+/*
+ * Benchmark: building one line at a time, 1M lines, two shapes
+ * - "Before swap: a=<a>, b=<b>": the line of parameters/example.adb,
+ *   four pieces
+ * - eight integers joined by ", ": fifteen pieces
+ * Each line is built into the same buffer and only its length and last
+ * character are used
+ * - snprintf with one format string
+ * - strcat of each piece, integers through sprintf: the C spelling of a
+ *   concatenation chain, rescanning the line for every piece
+ * - string_builder.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "string_builder.h"
+
+#define N      1000000
+#define PASSES 10
+#define WIDTH  8
+#define LINE   (WIDTH * (FMT_MAX_LENGTH + 2))
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Random sign and a random number of digits, 1 .. 10
+static int32_t random_value(void) {
+    uint32_t magnitude = next_random() >> (next_random() % 32);
+    int32_t x = (int32_t)(magnitude >> 1);
+    return (next_random() & 1) ? -x : x;
+}
+
+/* ---- kernels: each returns a checksum of the lines it built ---- */
+
+static char line[LINE];
+
+__attribute__((noipa)) static size_t swap_snprintf(const int32_t *v,
+                                                   size_t n) {
+    size_t check = 0;
+    for (size_t i = 0; i < n; i += 2) {
+        int length = snprintf(line, sizeof line, "Before swap: a=%d, b=%d",
+                              v[i], v[i + 1]);
+        check += (size_t)length + (unsigned char)line[length - 1];
+    }
+    return check;
+}
+
+__attribute__((noipa)) static size_t swap_strcat(const int32_t *v,
+                                                 size_t n) {
+    size_t check = 0;
+    char digits[FMT_MAX_LENGTH + 1];
+    for (size_t i = 0; i < n; i += 2) {
+        line[0] = '\0';
+        strcat(line, "Before swap: a=");
+        sprintf(digits, "%d", v[i]);
+        strcat(line, digits);
+        strcat(line, ", b=");
+        sprintf(digits, "%d", v[i + 1]);
+        strcat(line, digits);
+        size_t length = strlen(line);
+        check += length + (unsigned char)line[length - 1];
+    }
+    return check;
+}
+
+__attribute__((noipa)) static size_t swap_builder(const int32_t *v,
+                                                  size_t n) {
+    size_t check = 0;
+    string_builder b;
+    sb_init(&b, line, sizeof line);
+    for (size_t i = 0; i < n; i += 2) {
+        sb_clear(&b);
+        sb_append(&b, "Before swap: a=", 15);
+        sb_append_int(&b, v[i]);
+        sb_append(&b, ", b=", 4);
+        sb_append_int(&b, v[i + 1]);
+        check += b.length + (unsigned char)b.data[b.length - 1];
+    }
+    return check;
+}
+
+__attribute__((noipa)) static size_t row_snprintf(const int32_t *v,
+                                                  size_t n) {
+    size_t check = 0;
+    for (size_t i = 0; i < n; i += WIDTH) {
+        int length = snprintf(line, sizeof line,
+                              "%d, %d, %d, %d, %d, %d, %d, %d",
+                              v[i], v[i + 1], v[i + 2], v[i + 3],
+                              v[i + 4], v[i + 5], v[i + 6], v[i + 7]);
+        check += (size_t)length + (unsigned char)line[length - 1];
+    }
+    return check;
+}
+
+__attribute__((noipa)) static size_t row_strcat(const int32_t *v,
+                                                size_t n) {
+    size_t check = 0;
+    char digits[FMT_MAX_LENGTH + 1];
+    for (size_t i = 0; i < n; i += WIDTH) {
+        line[0] = '\0';
+        for (size_t k = 0; k < WIDTH; k++) {
+            if (k > 0) {
+                strcat(line, ", ");
+            }
+            sprintf(digits, "%d", v[i + k]);
+            strcat(line, digits);
+        }
+        size_t length = strlen(line);
+        check += length + (unsigned char)line[length - 1];
+    }
+    return check;
+}
+
+__attribute__((noipa)) static size_t row_builder(const int32_t *v,
+                                                 size_t n) {
+    size_t check = 0;
+    string_builder b;
+    sb_init(&b, line, sizeof line);
+    for (size_t i = 0; i < n; i += WIDTH) {
+        sb_clear(&b);
+        for (size_t k = 0; k < WIDTH; k++) {
+            if (k > 0) {
+                sb_append(&b, ", ", 2);
+            }
+            sb_append_int(&b, v[i + k]);
+        }
+        check += b.length + (unsigned char)b.data[b.length - 1];
+    }
+    return check;
+}
+
+/* ---- driver ---- */
+
+static size_t checksum;
+
+static void run(const char *label, size_t (*kernel)(const int32_t *, size_t),
+                const int32_t *values, size_t per_line) {
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        checksum += kernel(values, N);
+    }
+    double lines = (double)N / per_line * PASSES;
+    printf("%-22s: %6.1f ns/line\n", label, (now_ns() - start) / lines);
+}
+
+int main(void) {
+    int32_t *values = malloc(N * sizeof *values);
+    if (!values) {
+        return 1;
+    }
+    for (size_t i = 0; i < N; i++) {
+        values[i] = random_value();
+    }
+
+    run("swap, snprintf", swap_snprintf, values, 2);
+    run("swap, strcat chain", swap_strcat, values, 2);
+    run("swap, string_builder", swap_builder, values, 2);
+    run("row of 8, snprintf", row_snprintf, values, WIDTH);
+    run("row of 8, strcat chain", row_strcat, values, WIDTH);
+    run("row of 8, builder", row_builder, values, WIDTH);
+
+    printf("checksum: %zu\n", checksum);
+    free(values);
+    return 0;
+}
@@ -0,0 +1,59 @@
+--  String building: the output lines of parameters/example.adb, built in
+--  place instead of by `&` over 'Image
+
+with Ada.Text_IO;     use Ada.Text_IO;
+with String_Builders; use String_Builders;
+
+procedure Example is
+
+   Line : Builder (Capacity => 80);
+
+   --  Put_Line on the slice itself: no String is returned by value
+   procedure Put_Text is new Query_Text (Put_Line);
+
+   A : Integer := 10;
+   B : Integer := 20;
+
+   procedure Put_Swap_Line (Label : String; A, B : Integer)
+      with Pre => Label'Length <= 40
+   is
+   begin
+      Clear (Line);
+      Append (Line, Label);
+      Append (Line, " a=");
+      Append (Line, A);
+      Append (Line, ", b=");
+      Append (Line, B);
+      Put_Text (Line);
+   end Put_Swap_Line;
+
+   Temp : Integer;
+
+begin
+   --  'Image puts a blank before non-negative numbers; Append does not:
+   --  "a=10", not "a= 10"
+   Put_Swap_Line ("Before swap:", A, B);
+   Temp := A;
+   A := B;
+   B := Temp;
+   Put_Swap_Line ("After swap:", A, B);
+
+   --  The extremes still fit: Image_Length (Integer'First) is 11
+   Put_Swap_Line ("Extremes:", Integer'First, Integer'Last);
+
+   --  Any number of pieces, one Put_Line of the slice built so far
+   Clear (Line);
+   Append (Line, 17);
+   Append (Line, " / ");
+   Append (Line, 5);
+   Append (Line, " = ");
+   Append (Line, 17 / 5);
+   Append (Line, " remainder ");
+   Append (Line, 17 rem 5);
+   Put_Text (Line);
+   Put_Line ("Length:" & Natural'Image (Length (Line))
+             & ", available:" & Natural'Image (Available (Line)));
+
+   --  A piece that does not fit is a failed precondition, not a shorter
+   --  line: gnatprove rejects Append (Line, (1 .. 100 => '0')) here
+end Example;
@@ -0,0 +1,56 @@
+/*
+ * String building: the output lines of parameters/example.c, built in
+ * place instead of by printf
+ */
+
+#include <stdio.h>
+#include "string_builder.h"
+
+static char storage[80];
+
+static void put_swap_line(string_builder *line, const char *label, int a,
+                          int b) {
+    sb_clear(line);
+    sb_append(line, label, strlen(label));
+    sb_append(line, " a=", 3);
+    sb_append_int(line, a);
+    sb_append(line, ", b=", 4);
+    sb_append_int(line, b);
+    printf("%.*s\n", (int)line->length, line->data);
+}
+
+int main(void) {
+    string_builder line;
+    sb_init(&line, storage, sizeof storage);
+
+    int a = 10, b = 20;
+    put_swap_line(&line, "Before swap:", a, b);
+    int temp = a;
+    a = b;
+    b = temp;
+    put_swap_line(&line, "After swap:", a, b);
+    put_swap_line(&line, "Extremes:", INT32_MIN, INT32_MAX);
+
+    sb_clear(&line);
+    sb_append_int(&line, 17);
+    sb_append(&line, " / ", 3);
+    sb_append_int(&line, 5);
+    sb_append(&line, " = ", 3);
+    sb_append_int(&line, 17 / 5);
+    sb_append(&line, " remainder ", 11);
+    sb_append_int(&line, 17 % 5);
+    printf("%.*s\n", (int)line.length, line.data);
+    printf("Length: %zu, available: %zu\n", line.length,
+           sb_available(&line));
+
+    // Nothing stops a piece that does not fit: it is dropped, and the
+    // result says so
+    sb_clear(&line);
+    bool fits = true;
+    for (int i = 0; i < 10; i++) {
+        fits = sb_append(&line, "0123456789", 10) && fits;
+    }
+    printf("100 characters into 80: %s, length %zu\n",
+           fits ? "fits" : "does not fit", line.length);
+    return 0;
+}
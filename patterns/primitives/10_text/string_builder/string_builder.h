@@ -0,0 +1,65 @@
+/*
+ * A line of text built in place in a caller's block, instead of by
+ * snprintf or a chain of strcat calls
+ * Integers are formatted in place by ../int_format/int_format.h
+ */
+
+#ifndef STRING_BUILDER_H
+#define STRING_BUILDER_H
+
+#include <stdbool.h>
+#include <string.h>
+#include "../int_format/int_format.h"
+
+typedef struct {
+    char *data;
+    size_t capacity;
+    size_t length;   // characters appended; data is not terminated
+} string_builder;
+
+static inline void sb_init(string_builder *b, char *data, size_t capacity) {
+    b->data = data;
+    b->capacity = capacity;
+    b->length = 0;
+}
+
+static inline void sb_clear(string_builder *b) {
+    b->length = 0;
+}
+
+static inline size_t sb_available(const string_builder *b) {
+    return b->capacity - b->length;
+}
+
+// Each append returns false and adds nothing when the piece does not
+// fit. Callers that ignore the result get a silently shortened line
+static inline bool sb_append(string_builder *b, const char *s, size_t n) {
+    if (n > sb_available(b)) {
+        return false;
+    }
+    memcpy(b->data + b->length, s, n);
+    b->length += n;
+    return true;
+}
+
+static inline bool sb_append_char(string_builder *b, char c) {
+    if (sb_available(b) < 1) {
+        return false;
+    }
+    b->data[b->length++] = c;
+    return true;
+}
+
+// Needs room for the exact image, not FMT_MAX_LENGTH: the digits are
+// counted first so a nearly full builder can still take a short number
+static inline bool sb_append_int(string_builder *b, int32_t x) {
+    uint32_t magnitude = x < 0 ? -(uint32_t)x : (uint32_t)x;
+    size_t n = (size_t)fmt_digit_count(magnitude) + (x < 0);
+    if (n > sb_available(b)) {
+        return false;
+    }
+    b->length += fmt_i32(b->data + b->length, x);
+    return true;
+}
+
+#endif
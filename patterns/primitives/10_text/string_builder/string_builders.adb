@@ -0,0 +1,34 @@
+package body String_Builders is
+
+   procedure Clear (B : in out Builder) is
+   begin
+      B.Last := 0;
+   end Clear;
+
+   procedure Append (B : in out Builder; S : String) is
+   begin
+      B.Data (B.Last + 1 .. B.Last + S'Length) := S;
+      B.Last := B.Last + S'Length;
+   end Append;
+
+   procedure Append (B : in out Builder; C : Character) is
+   begin
+      B.Last := B.Last + 1;
+      B.Data (B.Last) := C;
+   end Append;
+
+   --  The digits go straight into Data; Format leaves the rest of it,
+   --  including the text before, unchanged
+   procedure Append (B : in out Builder; X : Integer) is
+      Count : Text_Length;
+   begin
+      Format (X, B.Data (B.Last + 1 .. B.Capacity), Count);
+      B.Last := B.Last + Count;
+   end Append;
+
+   procedure Query_Text (B : Builder) is
+   begin
+      Process (B.Data (1 .. B.Last));
+   end Query_Text;
+
+end String_Builders;
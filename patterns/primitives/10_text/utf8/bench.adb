@@ -0,0 +1,154 @@
+--  Benchmark: UTF8.Validate against a byte-wise state machine on 1 MB of
+--  ASCII, European names and CJK text, in GB/s, as bench.c
+--  Timing harness only, so it is excluded from proof
+
+pragma SPARK_Mode (Off);
+
+with Ada.Real_Time; use Ada.Real_Time;
+with Ada.Text_IO;   use Ada.Text_IO;
+with Interfaces;    use Interfaces;
+with UTF8;          use UTF8;
+
+procedure Bench is
+
+   Size   : constant := 2 ** 20;
+   Passes : constant := 200;
+
+   subtype Text is String (1 .. Size);
+   type Text_Access is access Text;
+
+   type Count_Kernel is access function (S : Text) return Natural;
+
+   Seed : Unsigned_32 := 12345;
+
+   function Next_Random return Unsigned_32 is
+   begin
+      Seed := Seed xor Shift_Left (Seed, 13);
+      Seed := Seed xor Shift_Right (Seed, 17);
+      Seed := Seed xor Shift_Left (Seed, 5);
+      return Seed;
+   end Next_Random;
+
+   --  Whole characters; one in Wide has Bytes bytes (2 or 3), the others
+   --  are ASCII letters. Wide = 0 is ASCII only. The end is padded with
+   --  spaces
+   procedure Fill (T : out Text; Wide : Natural; Bytes : Positive) is
+      I  : Positive := 1;
+      R  : Unsigned_32;
+      CP : Unsigned_32;
+   begin
+      while I + 3 <= Size loop
+         R := Next_Random;
+         if Wide = 0 or else R mod Unsigned_32 (Wide) /= 0 then
+            T (I) := Character'Val (Character'Pos ('a') + R mod 26);
+            I := I + 1;
+         elsif Bytes = 2 then
+            CP := 16#C0# + Shift_Right (R, 8) mod 16#40#;
+            T (I) := Character'Val (16#C0# or Shift_Right (CP, 6));
+            T (I + 1) := Character'Val (16#80# or (CP and 16#3F#));
+            I := I + 2;
+         else
+            CP := 16#4E00# + Shift_Right (R, 8) mod 16#5200#;
+            T (I) := Character'Val (16#E0# or Shift_Right (CP, 12));
+            T (I + 1) :=
+              Character'Val (16#80# or (Shift_Right (CP, 6) and 16#3F#));
+            T (I + 2) := Character'Val (16#80# or (CP and 16#3F#));
+            I := I + 3;
+         end if;
+      end loop;
+      T (I .. Size) := (others => ' ');
+   end Fill;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   --  The state is the number of continuation bytes still expected and
+   --  the range the next one must fall in; 0 if ill-formed
+   function Run_State_Machine (S : Text) return Natural is
+      Need  : Natural := 0;
+      Lo    : Natural := 16#80#;
+      Hi    : Natural := 16#BF#;
+      B     : Natural;
+      Count : Natural := 0;
+   begin
+      for I in S'Range loop
+         B := Character'Pos (S (I));
+         if Need > 0 then
+            if B not in Lo .. Hi then
+               return 0;
+            end if;
+            Lo := 16#80#;
+            Hi := 16#BF#;
+            Need := Need - 1;
+         else
+            Count := Count + 1;
+            case B is
+               when 16#00# .. 16#7F# =>
+                  null;
+               when 16#C2# .. 16#DF# =>
+                  Need := 1;
+               when 16#E0# .. 16#EF# =>
+                  Need := 2;
+                  Lo := (if B = 16#E0# then 16#A0# else 16#80#);
+                  Hi := (if B = 16#ED# then 16#9F# else 16#BF#);
+               when 16#F0# .. 16#F4# =>
+                  Need := 3;
+                  Lo := (if B = 16#F0# then 16#90# else 16#80#);
+                  Hi := (if B = 16#F4# then 16#8F# else 16#BF#);
+               when others =>
+                  return 0;
+            end case;
+         end if;
+      end loop;
+      return (if Need = 0 then Count else 0);
+   end Run_State_Machine;
+   pragma Machine_Attribute (Run_State_Machine, "noipa");
+
+   function Run_Validate (S : Text) return Natural is
+      Valid : Boolean;
+      Count : Natural;
+   begin
+      Validate (S, Valid, Count);
+      return (if Valid then Count else 0);
+   end Run_Validate;
+   pragma Machine_Attribute (Run_Validate, "noipa");
+
+   ------------
+   -- Driver --
+   ------------
+
+   Buffer : constant Text_Access := new Text;
+
+   Checksum : Natural := 0;
+
+   procedure Run (Label : String; K : Count_Kernel) is
+      Count : Natural := 0;
+      Start : constant Time := Clock;
+   begin
+      for P in 1 .. Passes loop
+         Count := K (Buffer.all);
+         Checksum := (Checksum + Count) mod 2 ** 30;
+      end loop;
+      Put_Line ("  " & Label &
+                Long_Float'Image (Long_Float (Size) * Long_Float (Passes)
+                                  / Long_Float (To_Duration (Clock - Start))
+                                  / 1.0E9) &
+                " GB/s " & Natural'Image (Count) & " code points");
+   end Run;
+
+   procedure Run_Text (Name : String; Wide : Natural; Bytes : Positive) is
+   begin
+      Fill (Buffer.all, Wide, Bytes);
+      Put_Line (Name);
+      Run ("state machine :", Run_State_Machine'Access);
+      Run ("Validate      :", Run_Validate'Access);
+   end Run_Text;
+
+begin
+   Run_Text ("ASCII", 0, 2);
+   Run_Text ("European names", 8, 2);
+   Run_Text ("CJK", 1, 3);
+
+   Put_Line ("checksum:" & Natural'Image (Checksum));
+end Bench;
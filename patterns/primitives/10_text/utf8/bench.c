@@ -0,0 +1,124 @@
+/*
+ * Benchmark: UTF-8 validation and counting of 1 MB of text, in GB/s
+ * - utf8_validate_bytewise: the state machine, one byte per step
+ * - one sequence per step with utf8_sequence_length, no ASCII step
+ * - utf8_validate: 16 ASCII bytes per step, then one sequence
+ * Three texts: ASCII, European names (1 character in 8 is 2 bytes) and
+ * CJK (3 bytes per character)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "utf8.h"
+
+#define SIZE   (1 << 20)
+#define PASSES 200
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Fills SIZE bytes with whole characters; one in `wide` has `bytes`
+// bytes (2 or 3), the others are ASCII letters. The end is padded with
+// spaces
+static void fill(uint8_t *p, int wide, int bytes) {
+    size_t i = 0;
+    while (i + 3 < SIZE) {
+        uint32_t r = next_random();
+        if (wide == 0 || r % wide != 0) {
+            p[i++] = (uint8_t)('a' + r % 26);
+        } else if (bytes == 2) {
+            uint32_t cp = 0xc0 + (r >> 8) % 0x40;   // U+00C0 .. U+00FF
+            p[i++] = (uint8_t)(0xc0 | cp >> 6);
+            p[i++] = (uint8_t)(0x80 | (cp & 0x3f));
+        } else {
+            uint32_t cp = 0x4e00 + (r >> 8) % 0x5200;   // CJK ideographs
+            p[i++] = (uint8_t)(0xe0 | cp >> 12);
+            p[i++] = (uint8_t)(0x80 | ((cp >> 6) & 0x3f));
+            p[i++] = (uint8_t)(0x80 | (cp & 0x3f));
+        }
+    }
+    while (i < SIZE) {
+        p[i++] = ' ';
+    }
+}
+
+/* ---- kernels: each returns the code points, or 0 if ill-formed ---- */
+
+__attribute__((noipa)) static size_t run_bytewise(const uint8_t *p,
+                                                  size_t n) {
+    size_t count;
+    return utf8_validate_bytewise(p, n, &count) ? count : 0;
+}
+
+__attribute__((noipa)) static size_t run_sequences(const uint8_t *p,
+                                                   size_t n) {
+    size_t i = 0;
+    size_t count = 0;
+    while (i < n) {
+        size_t length = utf8_sequence_length(p, n, i);
+        if (length == 0) {
+            return 0;
+        }
+        i += length;
+        count++;
+    }
+    return count;
+}
+
+__attribute__((noipa)) static size_t run_fast(const uint8_t *p, size_t n) {
+    size_t count;
+    return utf8_validate(p, n, &count) ? count : 0;
+}
+
+/* ---- driver ---- */
+
+static size_t checksum;
+
+static void run(const char *label, size_t (*kernel)(const uint8_t *,
+                                                    size_t),
+                const uint8_t *text) {
+    size_t count = 0;
+    double start = now_ns();
+    for (int p = 0; p < PASSES; p++) {
+        count = kernel(text, SIZE);
+        checksum += count;
+    }
+    double elapsed = now_ns() - start;
+    printf("  %-22s: %6.2f GB/s  %zu code points\n", label,
+           (double)SIZE * PASSES / elapsed, count);
+}
+
+int main(void) {
+    static const char *names[] = {"ASCII", "European names", "CJK"};
+    static const int wide[] = {0, 8, 1};
+    static const int bytes[] = {2, 2, 3};
+
+    uint8_t *text = malloc(SIZE);
+    if (!text) {
+        return 1;
+    }
+    for (int t = 0; t < 3; t++) {
+        fill(text, wide[t], bytes[t]);
+        printf("%s\n", names[t]);
+        run("state machine", run_bytewise, text);
+        run("sequences", run_sequences, text);
+        run("ASCII step + sequences", run_fast, text);
+    }
+
+    printf("checksum: %zu\n", checksum);
+    free(text);
+    return 0;
+}
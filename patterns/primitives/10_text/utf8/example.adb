@@ -0,0 +1,50 @@
+--  UTF-8: names that are not Latin-1, the ill-formed sequences that must
+--  be rejected, and a name cut in the middle of a character
+
+with Ada.Text_IO; use Ada.Text_IO;
+with UTF8;        use UTF8;
+
+procedure Example is
+
+   function C (Pos : Natural) return Character is (Character'Val (Pos))
+   with Pre => Pos <= 16#FF#;
+
+   Zoe     : constant String := "Zo" & C (16#C3#) & C (16#AB#);
+   Nihongo : constant String :=
+     C (16#E6#) & C (16#97#) & C (16#A5#) & C (16#E6#) & C (16#9C#)
+     & C (16#AC#) & C (16#E8#) & C (16#AA#) & C (16#9E#);
+
+   procedure Put_Text (Label : String; S : String) is
+      Valid : Boolean;
+      Count : Natural;
+   begin
+      Validate (S, Valid, Count);
+      Put (Label);
+      Set_Col (30);
+      if Valid then
+         Put_Line (Natural'Image (S'Length) & " bytes," &
+                   Natural'Image (Count) & " code points");
+      else
+         Put_Line (Natural'Image (S'Length) & " bytes, ill-formed");
+      end if;
+   end Put_Text;
+
+begin
+   Put_Text ("Zoe, diaeresis", Zoe);
+   Put_Text ("Zoe, Latin-1", "Zo" & C (16#EB#));
+   Put_Text ("Nihongo", Nihongo);
+   Put_Text ("Emoji", C (16#F0#) & C (16#9F#) & C (16#99#) & C (16#82#));
+   Put_Text ("Overlong '/'", C (16#C0#) & C (16#AF#));
+   Put_Text ("Surrogate U+D800", C (16#ED#) & C (16#A0#) & C (16#80#));
+   Put_Text ("Above U+10FFFF",
+             C (16#F4#) & C (16#90#) & C (16#80#) & C (16#80#));
+   Put_Text ("Long ASCII, then a name", "The quick brown fox: " & Zoe);
+
+   --  A fixed-size name field cut by bytes can end inside a character
+   Put_Text ("Zoe cut to 3 bytes", Zoe (1 .. 3));
+
+   if Is_Valid (Nihongo) then
+      Put_Line ("Nihongo: 'Length" & Natural'Image (Nihongo'Length) &
+                ", Code_Points" & Natural'Image (Code_Points (Nihongo)));
+   end if;
+end Example;
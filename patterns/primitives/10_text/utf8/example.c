@@ -0,0 +1,68 @@
+/*
+ * UTF-8: names that are not Latin-1, the ill-formed sequences that must
+ * be rejected, and the two validators against each other
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "utf8.h"
+
+static void put(const char *label, const char *s) {
+    size_t count;
+    bool valid = utf8_validate((const uint8_t *)s, strlen(s), &count);
+    if (valid) {
+        printf("%-28s %2zu bytes, %2zu code points\n", label, strlen(s),
+               count);
+    } else {
+        printf("%-28s %2zu bytes, ill-formed\n", label, strlen(s));
+    }
+}
+
+int main(void) {
+    put("Zoe, diaeresis", "Zo\xc3\xab");
+    put("Zoe, Latin-1", "Zo\xeb");
+    put("Nihongo", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e");
+    put("Emoji", "\xf0\x9f\x99\x82");
+    put("Overlong '/'", "\xc0\xaf");
+    put("Surrogate U+D800", "\xed\xa0\x80");
+    put("Above U+10FFFF", "\xf4\x90\x80\x80");
+    put("Zoe cut to 3 bytes", "Zo\xc3");
+    put("Long ASCII, then a name", "The quick brown fox: Zo\xc3\xab");
+
+    // Every sequence of 1 to 3 bytes, then with 16 ASCII bytes before it
+    // so the fast path runs first
+    uint8_t buf[19];
+    memset(buf, 'a', 16);
+    int mismatches = 0;
+    for (int n = 1; n <= 3; n++) {
+        for (uint32_t x = 0; x < 1u << (8 * n); x++) {
+            for (int k = 0; k < n; k++) {
+                buf[16 + k] = (uint8_t)(x >> (8 * k));
+            }
+            for (size_t skip = 0; skip <= 16; skip += 16) {
+                size_t c1 = 0, c2 = 0;
+                bool v1 = utf8_validate(buf + 16 - skip, n + skip, &c1);
+                bool v2 = utf8_validate_bytewise(buf + 16 - skip, n + skip,
+                                                 &c2);
+                mismatches += v1 != v2 || (v1 && c1 != c2);
+            }
+        }
+    }
+    // Four bytes: every lead from 0xf0 and second byte, and the bytes
+    // at the edges of the continuation range after them
+    const uint8_t edges[] = {0x7f, 0x80, 0xbf, 0xc0};
+    for (int lead = 0xf0; lead <= 0xff; lead++) {
+        for (int b1 = 0; b1 <= 0xff; b1++) {
+            for (int k = 0; k < 16; k++) {
+                const uint8_t seq[4] = {lead, b1, edges[k % 4],
+                                        edges[k / 4]};
+                size_t c1 = 0, c2 = 0;
+                bool v1 = utf8_validate(seq, 4, &c1);
+                bool v2 = utf8_validate_bytewise(seq, 4, &c2);
+                mismatches += v1 != v2 || (v1 && c1 != c2);
+            }
+        }
+    }
+    printf("Mismatches with the state machine: %d\n", mismatches);
+    return 0;
+}
@@ -0,0 +1,124 @@
+with Interfaces; use Interfaces;
+
+package body UTF8 is
+
+   --  Bytes per ASCII step
+   Block : constant := 16;
+
+   High_Bits : constant Unsigned_64 := 16#8080_8080_8080_8080#;
+
+   function Byte (S : String; Offset : Natural) return Unsigned_64 is
+     (Unsigned_64 (Character'Pos (S (S'First + Offset))))
+   with Pre => Offset < S'Length;
+
+   --  The 8 bytes from Offset, little-endian: GCC merges the ors into
+   --  one load
+   function Read_64 (S : String; Offset : Natural) return Unsigned_64 is
+     (Byte (S, Offset)
+      or Shift_Left (Byte (S, Offset + 1), 8)
+      or Shift_Left (Byte (S, Offset + 2), 16)
+      or Shift_Left (Byte (S, Offset + 3), 24)
+      or Shift_Left (Byte (S, Offset + 4), 32)
+      or Shift_Left (Byte (S, Offset + 5), 40)
+      or Shift_Left (Byte (S, Offset + 6), 48)
+      or Shift_Left (Byte (S, Offset + 7), 56))
+   with Pre => Offset <= S'Length and then S'Length - Offset >= 8;
+
+   --  The Block bytes from Offset are ASCII: two loads, an or and a
+   --  test. The bit-vector solver proves the Post
+   function Is_ASCII_Block (S : String; Offset : Natural) return Boolean
+   is
+     (((Read_64 (S, Offset) or Read_64 (S, Offset + 8)) and High_Bits) = 0)
+   with Pre  => Offset <= S'Length and then S'Length - Offset >= Block,
+        Post => Is_ASCII_Block'Result
+                = (for all K in 0 .. Block - 1 =>
+                     Character'Pos (S (S'First + Offset + K)) < 16#80#);
+
+   ------------
+   -- Lemmas --
+   ------------
+
+   --  An ASCII byte is a sequence of its own, so Block of them are Block
+   --  steps of the definition. Each loop step unfolds it once
+   procedure Lemma_ASCII_Block (S : String; Offset : Natural)
+   with Ghost,
+        Pre  => Offset <= S'Length
+                and then S'Length - Offset >= Block
+                and then (for all K in 0 .. Block - 1 =>
+                            Character'Pos (S (S'First + Offset + K))
+                            < 16#80#),
+        Post => Valid_From (S, Offset) = Valid_From (S, Offset + Block)
+                and then (if Valid_From (S, Offset + Block) then
+                            Count_From (S, Offset)
+                            = Block + Count_From (S, Offset + Block))
+   is
+   begin
+      for K in reverse 0 .. Block - 1 loop
+         pragma Loop_Invariant
+           (Valid_From (S, Offset + K) = Valid_From (S, Offset + Block));
+         pragma Loop_Invariant
+           (if Valid_From (S, Offset + Block) then
+              Count_From (S, Offset + K)
+              = Block - K + Count_From (S, Offset + Block));
+      end loop;
+   end Lemma_ASCII_Block;
+
+   -------------
+   -- Kernels --
+   -------------
+
+   procedure Validate (S : String; Valid : out Boolean; Count : out Natural)
+   is
+      N      : constant Natural := S'Length;
+      Offset : Natural := 0;
+      Length : Natural;
+   begin
+      Count := 0;
+      while Offset < N loop
+         pragma Loop_Invariant (Count <= Offset);
+         pragma Loop_Invariant (Valid_From (S, 0) = Valid_From (S, Offset));
+         pragma Loop_Invariant
+           (if Valid_From (S, Offset) then
+              Count_From (S, 0) = Count + Count_From (S, Offset));
+         pragma Loop_Variant (Increases => Offset);
+
+         --  Only tried at an ASCII byte: in CJK text it would fail every
+         --  time
+         if Character'Pos (S (S'First + Offset)) < 16#80#
+           and then N - Offset >= Block
+           and then Is_ASCII_Block (S, Offset)
+         then
+            Lemma_ASCII_Block (S, Offset);
+            Offset := Offset + Block;
+            Count := Count + Block;
+         else
+            Length := Sequence_Length (S, Offset);
+            if Length = 0 then
+               Valid := False;
+               return;
+            end if;
+            Offset := Offset + Length;
+            Count := Count + 1;
+         end if;
+      end loop;
+      Valid := True;
+   end Validate;
+
+   function Is_Valid (S : String) return Boolean is
+      Valid : Boolean;
+      Count : Natural;
+   begin
+      Validate (S, Valid, Count);
+      return Valid;
+   end Is_Valid;
+
+   function Code_Points (S : String) return Natural is
+      Valid : Boolean;
+      Count : Natural;
+   begin
+      Validate (S, Valid, Count);
+      pragma Assert (Valid);
+      return Count;
+   end Code_Points;
+
+end UTF8;
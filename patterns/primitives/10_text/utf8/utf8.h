@@ -0,0 +1,120 @@
+/*
+ * UTF-8 validation and code-point counting over a byte buffer, with the
+ * well-formed sequences of the Unicode Standard, table 3-7: no overlong
+ * forms, no surrogates, nothing above U+10FFFF
+ * - utf8_validate: 16 ASCII bytes per step with SWAR (SIMD within a
+ *   register), one sequence at a time otherwise
+ * - utf8_validate_bytewise: the usual state machine, one byte per step
+ */
+
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static inline bool utf8_in(const uint8_t *p, size_t n, size_t i,
+                           uint8_t lo, uint8_t hi) {
+    return i < n && p[i] >= lo && p[i] <= hi;
+}
+
+// Length of the well-formed sequence at p[i], 0 if there is none
+static inline size_t utf8_sequence_length(const uint8_t *p, size_t n,
+                                          size_t i) {
+    uint8_t b = p[i];
+    if (b < 0x80) {
+        return 1;
+    }
+    if (b >= 0xc2 && b <= 0xdf) {
+        return utf8_in(p, n, i + 1, 0x80, 0xbf) ? 2 : 0;
+    }
+    if (b >= 0xe0 && b <= 0xef) {
+        uint8_t lo = b == 0xe0 ? 0xa0 : 0x80;   // overlong below U+0800
+        uint8_t hi = b == 0xed ? 0x9f : 0xbf;   // surrogates
+        return utf8_in(p, n, i + 1, lo, hi)
+               && utf8_in(p, n, i + 2, 0x80, 0xbf) ? 3 : 0;
+    }
+    if (b >= 0xf0 && b <= 0xf4) {
+        uint8_t lo = b == 0xf0 ? 0x90 : 0x80;   // overlong below U+10000
+        uint8_t hi = b == 0xf4 ? 0x8f : 0xbf;   // above U+10FFFF
+        return utf8_in(p, n, i + 1, lo, hi)
+               && utf8_in(p, n, i + 2, 0x80, 0xbf)
+               && utf8_in(p, n, i + 3, 0x80, 0xbf) ? 4 : 0;
+    }
+    return 0;   // a continuation byte, 0xc0, 0xc1 or 0xf5 .. 0xff
+}
+
+// The 16 bytes at p have no high bit: two loads, an or and a test
+static inline bool utf8_ascii16(const uint8_t *p) {
+    uint64_t lo, hi;
+    memcpy(&lo, p, 8);
+    memcpy(&hi, p + 8, 8);
+    return ((lo | hi) & 0x8080808080808080u) == 0;
+}
+
+// Returns whether p[0 .. n - 1] is well-formed; if it is, *count is the
+// number of code points
+static inline bool utf8_validate(const uint8_t *p, size_t n,
+                                 size_t *count) {
+    size_t i = 0;
+    size_t c = 0;
+    while (i < n) {
+        // Only tried at an ASCII byte: in CJK text it would fail every time
+        if (p[i] < 0x80 && n - i >= 16 && utf8_ascii16(p + i)) {
+            i += 16;
+            c += 16;
+        } else {
+            size_t length = utf8_sequence_length(p, n, i);
+            if (length == 0) {
+                return false;
+            }
+            i += length;
+            c++;
+        }
+    }
+    *count = c;
+    return true;
+}
+
+// The state is the number of continuation bytes still expected and the
+// range the next one must fall in
+static inline bool utf8_validate_bytewise(const uint8_t *p, size_t n,
+                                          size_t *count) {
+    int need = 0;
+    uint8_t lo = 0x80, hi = 0xbf;
+    size_t c = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint8_t b = p[i];
+        if (need > 0) {
+            if (b < lo || b > hi) {
+                return false;
+            }
+            lo = 0x80;
+            hi = 0xbf;
+            need--;
+            continue;
+        }
+        c++;
+        if (b < 0x80) {
+            continue;
+        } else if (b >= 0xc2 && b <= 0xdf) {
+            need = 1;
+        } else if (b >= 0xe0 && b <= 0xef) {
+            need = 2;
+            lo = b == 0xe0 ? 0xa0 : 0x80;
+            hi = b == 0xed ? 0x9f : 0xbf;
+        } else if (b >= 0xf0 && b <= 0xf4) {
+            need = 3;
+            lo = b == 0xf0 ? 0x90 : 0x80;
+            hi = b == 0xf4 ? 0x8f : 0xbf;
+        } else {
+            return false;
+        }
+    }
+    *count = c;
+    return need == 0;
+}
+
+#endif